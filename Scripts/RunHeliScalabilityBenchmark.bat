@@ -0,0 +1,5 @@
+@echo off
+echo Running PACS helicopter scalability benchmark (50/100/250/500)...
+"C:\Devops\UESource\Engine\Binaries\Win64\UnrealEditor.exe" "C:\Devops\Projects\POLAIR_CS\POLAIR_CS.uproject" -ExecCmds="Automation RunTests PACS.Heli.Perf.Scalability" -unattended -nopause -NullRHI -testexit="Automation Test Queue Empty" -log -log=HeliScalability.log -stdout -FullStdOutLogOutput
+echo Benchmark complete. CSVs are in Saved\Automation\PACS, log in Saved\Logs\HeliScalability.log.
+echo To refresh the checked-in baseline, rerun with -PACSUpdateHeliBaseline appended.
@@ -11,6 +11,7 @@
 #include "Engine/StreamableManager.h"
 #include "Engine/AssetManager.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Data/Settings/PACS_CustomSignificanceManager.h"
 
 APACS_NPC_Base_Char::APACS_NPC_Base_Char()
 {
@@ -110,40 +111,30 @@ void APACS_NPC_Base_Char::ApplyCachedProfileData()
 	}
 
 	// Apply selection plane settings from cached data (client-side)
-	if (SelectionPlaneComponent && SelectionPlaneComponent->GetSelectionPlane())
+	if (SelectionPlaneComponent && (SelectionPlaneComponent->GetSelectionPlane() || SelectionPlaneComponent->IsInstancedPlane()))
 	{
-		UStaticMeshComponent* SelectionPlane = SelectionPlaneComponent->GetSelectionPlane();
+		UStaticMesh* PlaneMesh = !CachedProfileData.SelectionStaticMesh.IsNull()
+			? CachedProfileData.SelectionStaticMesh.LoadSynchronous() : nullptr;
+		UMaterialInterface* Material = !CachedProfileData.SelectionMaterialInstance.IsNull()
+			? CachedProfileData.SelectionMaterialInstance.LoadSynchronous() : nullptr;
 
-		// Apply mesh
-		if (!CachedProfileData.SelectionStaticMesh.IsNull())
+		// Apply mesh and material (per-NPC mesh component or shared instanced batch)
+		SelectionPlaneComponent->ApplyPlaneAssets(PlaneMesh, Material, CachedProfileData.SelectionStaticMeshTransform);
+
+		// Force update the CPD again after material application to ensure it takes effect
+		if (Material)
 		{
-			if (UStaticMesh* PlaneMesh = CachedProfileData.SelectionStaticMesh.LoadSynchronous())
-			{
-				SelectionPlane->SetStaticMesh(PlaneMesh);
-				SelectionPlane->SetRelativeTransform(CachedProfileData.SelectionStaticMeshTransform);
-			}
+			SelectionPlaneComponent->UpdateSelectionPlaneCPD();
 		}
 
-		// Apply material
-		if (!CachedProfileData.SelectionMaterialInstance.IsNull())
+		if (UStaticMeshComponent* SelectionPlane = SelectionPlaneComponent->GetSelectionPlane())
 		{
-			if (UMaterialInterface* Material = CachedProfileData.SelectionMaterialInstance.LoadSynchronous())
-			{
-				SelectionPlane->SetMaterial(0, Material);
+			// Apply collision - Always use SelectionTrace channel (ECC_GameTraceChannel1) for blocking
+			SelectionPlane->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Block);
 
-				// Force update the CPD again after material application to ensure it takes effect
-				if (SelectionPlaneComponent)
-				{
-					SelectionPlaneComponent->UpdateSelectionPlaneCPD();
-				}
-			}
+			// Selection plane is always visible - state controlled by material/CPD
+			SelectionPlane->SetVisibility(true);
 		}
-
-		// Apply collision - Always use SelectionTrace channel (ECC_GameTraceChannel1) for blocking
-		SelectionPlane->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Block);
-
-		// Selection plane is always visible - state controlled by material/CPD
-		SelectionPlane->SetVisibility(true);
 	}
 }
 
@@ -167,6 +158,20 @@ void APACS_NPC_Base_Char::BeginPlay()
 	{
 		ApplyCachedProfileData();
 	}
+
+	// Tick rates follow distance from the local views (no manager on dedicated servers)
+	if (UPACS_CustomSignificanceManager* SignificanceManager = UPACS_CustomSignificanceManager::Get(GetWorld()))
+	{
+		SignificanceManager->RegisterNPC(this);
+	}
+}
+
+void APACS_NPC_Base_Char::RefreshSignificance()
+{
+	if (UPACS_CustomSignificanceManager* SignificanceManager = UPACS_CustomSignificanceManager::Get(GetWorld()))
+	{
+		SignificanceManager->RefreshNPC(this);
+	}
 }
 
 void APACS_NPC_Base_Char::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -180,6 +185,11 @@ void APACS_NPC_Base_Char::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	// Stop any movement
 	StopMovement();
 
+	if (UPACS_CustomSignificanceManager* SignificanceManager = UPACS_CustomSignificanceManager::Get(GetWorld()))
+	{
+		SignificanceManager->UnregisterNPC(this);
+	}
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -266,6 +276,8 @@ void APACS_NPC_Base_Char::SetSelected(bool bNewSelected, APlayerState* Selector)
 	{
 		SelectionPlaneComponent->SetSelectionState(bIsSelected ? ESelectionVisualState::Selected : ESelectionVisualState::Available);
 	}
+
+	RefreshSignificance();
 }
 
 void APACS_NPC_Base_Char::MoveToLocation(const FVector& TargetLocation)
@@ -375,6 +387,8 @@ void APACS_NPC_Base_Char::SetLocalHover(bool bHovered)
 	{
 		SelectionPlaneComponent->SetHoverState(bHovered);
 	}
+
+	RefreshSignificance();
 }
 
 void APACS_NPC_Base_Char::OnRep_CurrentSelector()
@@ -384,6 +398,8 @@ void APACS_NPC_Base_Char::OnRep_CurrentSelector()
 	{
 		SelectionPlaneComponent->UpdateVisuals();
 	}
+
+	RefreshSignificance();
 }
 
 void APACS_NPC_Base_Char::UpdateSelectionVisuals()
@@ -6,6 +6,7 @@
 
 #include "Core/PACS_PlayerController.h"
 #include "Components/PACS_InputHandlerComponent.h"
+#include "Data/PACS_InputActionIds.h"
 #include "Data/Configs/AssessorPawnConfig.h"
 
 APACS_AssessorPawn::APACS_AssessorPawn()
@@ -215,7 +216,14 @@ void APACS_AssessorPawn::StepZoom(float AxisValue)
 }
 
 // ===== IPACS_InputReceiver =====
-EPACS_InputHandleResult APACS_AssessorPawn::HandleInputAction(FName ActionName, const FInputActionValue& Value)
+void APACS_AssessorPawn::GetSubscribedActions(TArray<FName>& OutActions) const
+{
+    using namespace PACS_InputActions;
+    OutActions.Append({ Assessor_MoveForward.GetName(), Assessor_MoveRight.GetName(), Assessor_Zoom.GetName(),
+                        Assessor_RotateLeft.GetName(), Assessor_RotateRight.GetName() });
+}
+
+EPACS_InputHandleResult APACS_AssessorPawn::HandleInputActionId(uint16 ActionId, FName ActionName, const FInputActionValue& Value)
 {
 #if !UE_SERVER
     
@@ -224,27 +232,27 @@ EPACS_InputHandleResult APACS_AssessorPawn::HandleInputAction(FName ActionName,
         return EPACS_InputHandleResult::NotHandled;
     }
 
-    if (ActionName == TEXT("Assessor.MoveForward"))
+    if (ActionId == PACS_InputActions::Assessor_MoveForward)
     {
         InputForward += Value.Get<float>();
         return EPACS_InputHandleResult::HandledConsume;
     }
-    if (ActionName == TEXT("Assessor.MoveRight"))
+    if (ActionId == PACS_InputActions::Assessor_MoveRight)
     {
         InputRight += Value.Get<float>();
         return EPACS_InputHandleResult::HandledConsume;
     }
-    if (ActionName == TEXT("Assessor.Zoom"))
+    if (ActionId == PACS_InputActions::Assessor_Zoom)
     {
         StepZoom(Value.Get<float>());
         return EPACS_InputHandleResult::HandledConsume;
     }
-    if (ActionName == TEXT("Assessor.RotateLeft"))
+    if (ActionId == PACS_InputActions::Assessor_RotateLeft)
     {
         AddRotationInput(1.0f);
         return EPACS_InputHandleResult::HandledConsume;
     }
-    if (ActionName == TEXT("Assessor.RotateRight"))
+    if (ActionId == PACS_InputActions::Assessor_RotateRight)
     {
         AddRotationInput(-1.0f);
         return EPACS_InputHandleResult::HandledConsume;
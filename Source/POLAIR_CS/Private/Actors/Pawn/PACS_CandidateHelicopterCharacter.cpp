@@ -7,12 +7,21 @@
 #include "HeadMountedDisplayFunctionLibrary.h"
 #include "Net/UnrealNetwork.h"
 #include "Components/PACS_InputHandlerComponent.h"
+#include "Data/PACS_InputActionIds.h"
 #include "Core/PACS_PlayerController.h"
 #include "GameFramework/PlayerController.h"
-#include "GameFramework/GameStateBase.h"
+#include "Subsystems/PACS_ServerClockSubsystem.h"
 #include "Components/SceneCaptureComponent2D.h"
 #include "Engine/TextureRenderTarget2D.h"
 #include "Materials/MaterialInstanceDynamic.h"
+#include "Settings/PACS_NetPerfSettings.h"
+#include "Subsystems/PACS_CCTVCaptureScheduler.h"
+#include "Subsystems/PACS_OrbitCenterGrid.h"
+#include "Data/Settings/PACS_CustomSignificanceManager.h"
+#include "Data/PACS_SignificanceViewpoints.h"
+#include "TimerManager.h"
+
+const FName APACS_CandidateHelicopterCharacter::SignificanceTag(TEXT("PACS.Helicopter"));
 
 APACS_CandidateHelicopterCharacter::APACS_CandidateHelicopterCharacter(const FObjectInitializer& OI)
 : Super(OI.SetDefaultSubobjectClass<UPACS_HeliMovementComponent>(ACharacter::CharacterMovementComponentName))
@@ -74,6 +83,7 @@ void APACS_CandidateHelicopterCharacter::BeginPlay()
     // Setup both CCTV systems
     SetupCCTV();
     SetupCCTV2();
+    RegisterCCTVFeeds();
 
     // Initialize static camera world rotation with configurable settings
     if (ExternalCam2)
@@ -104,6 +114,29 @@ void APACS_CandidateHelicopterCharacter::BeginPlay()
             int32(CMC->CustomMovementMode),
             CMC->Data ? TEXT("OK") : TEXT("NULL"));
     }
+
+    DisableActorTickIfUnused();
+    RegisterSignificance();
+}
+
+void APACS_CandidateHelicopterCharacter::DisableActorTickIfUnused()
+{
+    if (!GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(AActor, ReceiveTick)))
+    {
+        SetActorTickEnabled(false);
+    }
+}
+
+void APACS_CandidateHelicopterCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UPACS_CCTVCaptureScheduler* Scheduler = GetWorld() ? GetWorld()->GetSubsystem<UPACS_CCTVCaptureScheduler>() : nullptr)
+    {
+        Scheduler->UnregisterFeed(ExternalCam);
+        Scheduler->UnregisterFeed(ExternalCam2);
+    }
+    UnregisterSignificance();
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void APACS_CandidateHelicopterCharacter::PossessedBy(AController* NewController)
@@ -130,13 +163,6 @@ void APACS_CandidateHelicopterCharacter::OnRep_Controller()
     RegisterAsReceiverIfLocal();
 }
 
-void APACS_CandidateHelicopterCharacter::Tick(float DeltaSeconds)
-{
-    Super::Tick(DeltaSeconds);
-    UpdateBankVisual(DeltaSeconds);
-    UpdateStaticCameraPosition(DeltaSeconds);
-}
-
 void APACS_CandidateHelicopterCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -148,8 +174,7 @@ void APACS_CandidateHelicopterCharacter::GetLifetimeReplicatedProps(TArray<FLife
 
 static float NowS(const UWorld* W)
 {
-    if (const AGameStateBase* GS = W->GetGameState()) return GS->GetServerWorldTimeSeconds();
-    return W->GetTimeSeconds();
+    return UPACS_ServerClockSubsystem::GetServerNowS(W);
 }
 
 // ----- VR Seat -----
@@ -188,32 +213,132 @@ void APACS_CandidateHelicopterCharacter::NudgeSeatX(float S){ SeatLocalOffsetCm.
 void APACS_CandidateHelicopterCharacter::NudgeSeatY(float S){ SeatLocalOffsetCm.Y += S; ApplySeatOffset(); }
 void APACS_CandidateHelicopterCharacter::NudgeSeatZ(float S){ SeatLocalOffsetCm.Z += S; ApplySeatOffset(); }
 
-// ----- Banking (visual only) -----
-void APACS_CandidateHelicopterCharacter::UpdateBankVisual(float Dt)
+// ----- Banking (visual only; computed in UPACS_HeliMovementComponent::UpdateBank) -----
+void APACS_CandidateHelicopterCharacter::RegisterSignificance()
+{
+    if (bSignificanceRegistered || GetLocalRole() != ROLE_SimulatedProxy) return;
+
+    UPACS_CustomSignificanceManager* SignificanceManager = UPACS_CustomSignificanceManager::Get(GetWorld());
+    if (!SignificanceManager) return;
+
+    SignificanceManager->RegisterObject(this, SignificanceTag,
+        [](USignificanceManager::FManagedObjectInfo* Info, const FTransform& Viewpoint)
+        {
+            const AActor* Heli = Cast<AActor>(Info->GetObject());
+            return Heli ? FPACS_SignificanceViewpoints::DistanceSignificance(Heli->GetActorLocation(), Viewpoint) : 0.f;
+        },
+        USignificanceManager::EPostSignificanceType::Sequential,
+        [](USignificanceManager::FManagedObjectInfo* Info, float OldSignificance, float Significance, bool bFinal)
+        {
+            const APACS_CandidateHelicopterCharacter* Heli = Cast<APACS_CandidateHelicopterCharacter>(Info->GetObject());
+            UPACS_HeliMovementComponent* CMC = Heli ? Cast<UPACS_HeliMovementComponent>(Heli->GetCharacterMovement()) : nullptr;
+            if (!CMC || !CMC->Data) return;
+
+            const float DistantSignificance = 1.f / (1.f + CMC->Data->DistantBankDistanceCm * 0.001f);
+            CMC->BankUpdateInterval = (Significance < DistantSignificance) ? CMC->Data->DistantBankUpdateIntervalS : 0.f;
+        });
+    bSignificanceRegistered = true;
+}
+
+void APACS_CandidateHelicopterCharacter::GetSignificanceViewpoints(TArray<FTransform>& Out) const
 {
-    const auto* CMC = Cast<UPACS_HeliMovementComponent>(GetCharacterMovement());
-    if (!CMC || !Data || !HelicopterFrame) return;
-    const float Target = -(CMC->SpeedCms / FMath::Max(Data->MaxSpeedCms,1.f)) * Data->MaxBankDeg; //<-------- Change bank direction
-    CurrentBankDeg = FMath::FInterpTo(CurrentBankDeg, Target, Dt, BankInterpSpeed);
-    HelicopterFrame->SetRelativeRotation(FRotator(0, 0, CurrentBankDeg));
+    // VRCamera follows the HMD (bLockToHmd), so its world transform is the head pose
+    const FTransform HMDPose = VRCamera ? VRCamera->GetComponentTransform() : GetActorTransform();
+    const UPACS_HeliMovementComponent* CMC = Cast<UPACS_HeliMovementComponent>(GetCharacterMovement());
+    FPACS_SignificanceViewpoints::BuildHeliViewpoints(HMDPose, OrbitTargets, CMC ? CMC->AngleRad : 0.f,
+        FPACS_HeliViewParams::FromSettings(), Out);
+}
+
+void APACS_CandidateHelicopterCharacter::UnregisterSignificance()
+{
+    // Keyed on the registration, not the role: a proxy possessed on this client is no longer simulated
+    if (!bSignificanceRegistered) return;
+    bSignificanceRegistered = false;
+    if (UPACS_CustomSignificanceManager* SignificanceManager = UPACS_CustomSignificanceManager::Get(GetWorld()))
+    {
+        SignificanceManager->UnregisterObject(this);
+    }
 }
 
 // ----- Param Validation -----
 bool APACS_CandidateHelicopterCharacter::ValidateOrbitCenter(const FVector& Proposed) const
 {
-    FCollisionQueryParams Q(SCENE_QUERY_STAT(OrbitCenter), false, this);
-    const FCollisionShape Probe = FCollisionShape::MakeSphere(50.f);
-    return !GetWorld()->OverlapAnyTestByChannel(Proposed, FQuat::Identity, ECC_WorldStatic, Probe, Q);
+    // Grid lookup in open cells; the overlap only runs near collision or outside the grid
+    if (UPACS_OrbitCenterGrid* Grid = GetWorld()->GetSubsystem<UPACS_OrbitCenterGrid>())
+    {
+        return Grid->IsCenterValid(Proposed, this);
+    }
+    return UPACS_OrbitCenterGrid::OverlapCenter(GetWorld(), Proposed, this);
 }
 
 // ----- Reliable batched edits -----
+void APACS_CandidateHelicopterCharacter::QueueOrbitEdit(const FPACS_OrbitEdit& Edit)
+{
+    if (!Edit.HasAnyChange()) return;
+    OrbitEditAccumulator.Add(Edit);
+    FlushOrbitEdits();
+}
+
+void APACS_CandidateHelicopterCharacter::FlushOrbitEdits()
+{
+    if (!OrbitEditAccumulator.HasPending()) return;
+
+    const float MaxPerSecond = UPACS_NetPerfSettings::Get()->MaxOrbitEditsPerSecond;
+    const double Now = GetWorld()->GetTimeSeconds();
+    const double Delay = OrbitEditAccumulator.GetSendDelay(Now, MaxPerSecond);
+    if (Delay > 0.0)
+    {
+        // Trailing send so the last value of a scrub is never lost
+        if (!GetWorldTimerManager().IsTimerActive(OrbitEditSendTimer))
+        {
+            GetWorldTimerManager().SetTimer(OrbitEditSendTimer, this, &APACS_CandidateHelicopterCharacter::FlushOrbitEdits, (float)Delay, false);
+        }
+        return;
+    }
+
+    ++OrbitEditRPCsSent;
+    Server_ApplyOrbitParams(OrbitEditAccumulator.Consume(Now));
+}
+
 void APACS_CandidateHelicopterCharacter::Server_ApplyOrbitParams_Implementation(const FPACS_OrbitEdit& E)
 {
     if (!HasAuthority() || (SelectedBy == nullptr)) return;
-    if (E.TransactionId <= LastAppliedTxnId) return;
+    // Ids wrap, so order them as serial numbers; 0 is never sent and means nothing applied yet
+    if (LastAppliedTxnId != 0 && !FPACS_OrbitEdit::IsNewerTransaction(E.TransactionId, LastAppliedTxnId)) return;
     LastAppliedTxnId = E.TransactionId;
 
-    if (E.bHasCenter && !ValidateOrbitCenter(E.NewCenterCm)) return;
+    // Everything arriving this tick is merged and applied once next tick
+    if (bHasPendingServerEdit)
+    {
+        PendingServerEdit.MergeFrom(E);
+        return;
+    }
+    PendingServerEdit = E;
+    bHasPendingServerEdit = true;
+    OrbitEditApplyTimer = GetWorldTimerManager().SetTimerForNextTick(this, &APACS_CandidateHelicopterCharacter::ApplyPendingOrbitEdits);
+}
+
+void APACS_CandidateHelicopterCharacter::ApplyPendingOrbitEdits()
+{
+    if (!bHasPendingServerEdit) return;
+    FPACS_OrbitEdit E = PendingServerEdit;
+    PendingServerEdit = FPACS_OrbitEdit();
+    bHasPendingServerEdit = false;
+    GetWorldTimerManager().ClearTimer(OrbitEditApplyTimer);
+
+    if (!HasAuthority() || (SelectedBy == nullptr)) return;
+
+    // A rejected centre drops only the centre; other fields merged with it still apply
+    if (E.bHasCenter)
+    {
+        ++OrbitCenterValidations;
+        if (!ValidateOrbitCenter(E.NewCenterCm))
+        {
+            E.bHasCenter = false;
+            if (!E.HasAnyChange()) return;
+        }
+    }
+
     if (E.bHasCenter) OrbitTargets.CenterCm = E.NewCenterCm;
     if (E.bHasAlt)    OrbitTargets.AltitudeCm = FMath::Clamp(E.NewAltCm, 100.f, 1'000'000.f);
     if (E.bHasRadius) OrbitTargets.RadiusCm   = FMath::Clamp(E.NewRadiusCm, 100.f, 1'000'000.f);
@@ -249,7 +374,11 @@ void APACS_CandidateHelicopterCharacter::Server_ApplyOrbitParams_Implementation(
 void APACS_CandidateHelicopterCharacter::Server_RequestSelect_Implementation(APlayerState* Requestor)
 {
     if (!HasAuthority()) return;
-    if (SelectedBy == nullptr) SelectedBy = Requestor;
+    if (SelectedBy != nullptr) return;
+    SelectedBy = Requestor;
+
+    // The new selector numbers its edits from its own counter
+    LastAppliedTxnId = 0;
 }
 
 void APACS_CandidateHelicopterCharacter::Server_ReleaseSelect_Implementation(APlayerState* Requestor)
@@ -297,9 +426,8 @@ void APACS_CandidateHelicopterCharacter::ApplyOffsetsThenSeed(const FPACS_OrbitO
     OrbitAnchors.SpeedStartS  = OrbitAnchors.OrbitStartS = S;
     OrbitAnchors.AngleAtStart = 0.f;
 
-    const FVector StartPos = FVector(OrbitTargets.CenterCm.X,
-                                     OrbitTargets.CenterCm.Y + OrbitTargets.RadiusCm,
-                                     OrbitTargets.AltitudeCm);
+    const FVector StartPos = UPACS_HeliMovementComponent::OrbitPositionAt(
+        OrbitTargets.CenterCm, OrbitTargets.RadiusCm, OrbitAnchors.AngleAtStart, OrbitTargets.AltitudeCm);
     SetActorLocation(StartPos, /*bSweep=*/false);
 
     if (auto* CMC = Cast<UPACS_HeliMovementComponent>(GetCharacterMovement()))
@@ -383,26 +511,34 @@ void APACS_CandidateHelicopterCharacter::UnregisterAsReceiver()
 }
 
 // ---- Input Receiver ----
-EPACS_InputHandleResult APACS_CandidateHelicopterCharacter::HandleInputAction(FName ActionName, const FInputActionValue& Value)
+void APACS_CandidateHelicopterCharacter::GetSubscribedActions(TArray<FName>& OutActions) const
+{
+    // Keep in step with HandleInputActionId
+    using namespace PACS_InputActions;
+    OutActions.Append({ VRSeat_Center.GetName(), VRSeat_X.GetName(), VRSeat_Y.GetName(), VRSeat_Z.GetName(),
+                        Cam_ZoomToggle.GetName(), Cam2_ZoomToggle.GetName() });
+}
+
+EPACS_InputHandleResult APACS_CandidateHelicopterCharacter::HandleInputActionId(uint16 ActionId, FName ActionName, const FInputActionValue& Value)
 {
     // Debug: Log ALL actions received by helicopter
-    UE_LOG(LogPACSInput, Warning, TEXT("Helicopter received action: %s (Value: %s, Type: %s)"), 
+    PACS_LOG_HOT(LogPACSInput, Log, TEXT("Helicopter received action: %s (Value: %s, Type: %s)"), 
         *ActionName.ToString(), *Value.ToString(), 
         Value.GetValueType() == EInputActionValueType::Axis1D ? TEXT("Axis1D") :
         Value.GetValueType() == EInputActionValueType::Boolean ? TEXT("Boolean") : TEXT("Other"));
 
-    // The router already resolves UInputAction* -> FName via config
-    if (ActionName == TEXT("VRSeat.Center"))
+    // The router already resolves UInputAction* -> action ID via config
+    if (ActionId == PACS_InputActions::VRSeat_Center)
     {
-        UE_LOG(LogPACSInput, Warning, TEXT("EXECUTING VRSeat.Center"));
+        PACS_LOG_HOT(LogPACSInput, Log, TEXT("EXECUTING VRSeat.Center"));
         Seat_Center();
         return EPACS_InputHandleResult::HandledConsume;
     }
-    else if (ActionName == TEXT("VRSeat.X"))
+    else if (ActionId == PACS_InputActions::VRSeat_X)
     {
-        UE_LOG(LogPACSInput, Warning, TEXT("PROCESSING VRSeat.X"));
+        PACS_LOG_HOT(LogPACSInput, Log, TEXT("PROCESSING VRSeat.X"));
         float AxisValue = Value.Get<float>();
-        UE_LOG(LogPACSInput, Warning, TEXT("VRSeat.X AxisValue: %f (abs: %f)"), AxisValue, FMath::Abs(AxisValue));
+        PACS_LOG_HOT(LogPACSInput, Log, TEXT("VRSeat.X AxisValue: %f (abs: %f)"), AxisValue, FMath::Abs(AxisValue));
         
         // Test: Move even with zero values to check if keys are working at all
         if (HelicopterFrame)
@@ -413,20 +549,20 @@ EPACS_InputHandleResult APACS_CandidateHelicopterCharacter::HandleInputAction(FN
             float MovementValue = (FMath::Abs(AxisValue) > 0.001f) ? AxisValue : 1.0f;
             NewPos.X += MovementValue * 4.0f; // Larger step for visibility
             HelicopterFrame->SetRelativeLocation(NewPos);
-            UE_LOG(LogPACSInput, Error, TEXT("VRSeat.X MOVED: %f -> Frame X: %f to %f (using movement: %f)"), AxisValue, CurrentPos.X, NewPos.X, MovementValue);
+            PACS_LOG_HOT(LogPACSInput, Log, TEXT("VRSeat.X MOVED: %f -> Frame X: %f to %f (using movement: %f)"), AxisValue, CurrentPos.X, NewPos.X, MovementValue);
         }
         else
         {
-            UE_LOG(LogPACSInput, Error, TEXT("VRSeat.X NOT MOVED: HelicopterFrame=%s, AxisValue=%f"), 
+            PACS_LOG_HOT(LogPACSInput, Log, TEXT("VRSeat.X NOT MOVED: HelicopterFrame=%s, AxisValue=%f"), 
                 HelicopterFrame ? TEXT("Valid") : TEXT("NULL"), AxisValue);
         }
         return EPACS_InputHandleResult::HandledConsume;
     }
-    else if (ActionName == TEXT("VRSeat.Y"))
+    else if (ActionId == PACS_InputActions::VRSeat_Y)
     {
-        UE_LOG(LogPACSInput, Warning, TEXT("PROCESSING VRSeat.Y"));
+        PACS_LOG_HOT(LogPACSInput, Log, TEXT("PROCESSING VRSeat.Y"));
         float AxisValue = Value.Get<float>();
-        UE_LOG(LogPACSInput, Warning, TEXT("VRSeat.Y AxisValue: %f"), AxisValue);
+        PACS_LOG_HOT(LogPACSInput, Log, TEXT("VRSeat.Y AxisValue: %f"), AxisValue);
         
         if (HelicopterFrame)
         {
@@ -435,20 +571,20 @@ EPACS_InputHandleResult APACS_CandidateHelicopterCharacter::HandleInputAction(FN
             float MovementValue = (FMath::Abs(AxisValue) > 0.001f) ? AxisValue : 1.0f;
             NewPos.Y += MovementValue * 4.0f;
             HelicopterFrame->SetRelativeLocation(NewPos);
-            UE_LOG(LogPACSInput, Error, TEXT("VRSeat.Y MOVED: %f -> Frame Y: %f to %f (using movement: %f)"), AxisValue, CurrentPos.Y, NewPos.Y, MovementValue);
+            PACS_LOG_HOT(LogPACSInput, Log, TEXT("VRSeat.Y MOVED: %f -> Frame Y: %f to %f (using movement: %f)"), AxisValue, CurrentPos.Y, NewPos.Y, MovementValue);
         }
         else
         {
-            UE_LOG(LogPACSInput, Error, TEXT("VRSeat.Y NOT MOVED: HelicopterFrame=%s, AxisValue=%f"), 
+            PACS_LOG_HOT(LogPACSInput, Log, TEXT("VRSeat.Y NOT MOVED: HelicopterFrame=%s, AxisValue=%f"), 
                 HelicopterFrame ? TEXT("Valid") : TEXT("NULL"), AxisValue);
         }
         return EPACS_InputHandleResult::HandledConsume;
     }
-    else if (ActionName == TEXT("VRSeat.Z"))
+    else if (ActionId == PACS_InputActions::VRSeat_Z)
     {
-        UE_LOG(LogPACSInput, Warning, TEXT("PROCESSING VRSeat.Z"));
+        PACS_LOG_HOT(LogPACSInput, Log, TEXT("PROCESSING VRSeat.Z"));
         float AxisValue = Value.Get<float>();
-        UE_LOG(LogPACSInput, Warning, TEXT("VRSeat.Z AxisValue: %f"), AxisValue);
+        PACS_LOG_HOT(LogPACSInput, Log, TEXT("VRSeat.Z AxisValue: %f"), AxisValue);
         
         if (HelicopterFrame)
         {
@@ -457,19 +593,19 @@ EPACS_InputHandleResult APACS_CandidateHelicopterCharacter::HandleInputAction(FN
             float MovementValue = (FMath::Abs(AxisValue) > 0.001f) ? AxisValue : 1.0f;
             NewPos.Z += MovementValue * 4.0f;
             HelicopterFrame->SetRelativeLocation(NewPos);
-            UE_LOG(LogPACSInput, Error, TEXT("VRSeat.Z MOVED: %f -> Frame Z: %f to %f (using movement: %f)"), AxisValue, CurrentPos.Z, NewPos.Z, MovementValue);
+            PACS_LOG_HOT(LogPACSInput, Log, TEXT("VRSeat.Z MOVED: %f -> Frame Z: %f to %f (using movement: %f)"), AxisValue, CurrentPos.Z, NewPos.Z, MovementValue);
         }
         else
         {
-            UE_LOG(LogPACSInput, Error, TEXT("VRSeat.Z NOT MOVED: HelicopterFrame=%s, AxisValue=%f"), 
+            PACS_LOG_HOT(LogPACSInput, Log, TEXT("VRSeat.Z NOT MOVED: HelicopterFrame=%s, AxisValue=%f"), 
                 HelicopterFrame ? TEXT("Valid") : TEXT("NULL"), AxisValue);
         }
         return EPACS_InputHandleResult::HandledConsume;
     }
-    else if (ActionName == TEXT("Cam.ZoomToggle"))
+    else if (ActionId == PACS_InputActions::Cam_ZoomToggle)
     {
         const bool bPressed = Value.Get<bool>();
-        UE_LOG(LogPACSInput, Warning, TEXT("CCTV: Cam.ZoomToggle received - Value: %s"), bPressed ? TEXT("true") : TEXT("false"));
+        PACS_LOG_HOT(LogPACSInput, Log, TEXT("CCTV: Cam.ZoomToggle received - Value: %s"), bPressed ? TEXT("true") : TEXT("false"));
 
         // Since we're only receiving 'false' (release) events, toggle on release instead
         if (!bPressed)
@@ -480,10 +616,10 @@ EPACS_InputHandleResult APACS_CandidateHelicopterCharacter::HandleInputAction(FN
         // Always consume the action whether pressed or released
         return EPACS_InputHandleResult::HandledConsume;
     }
-    else if (ActionName == TEXT("Cam2.ZoomToggle"))
+    else if (ActionId == PACS_InputActions::Cam2_ZoomToggle)
     {
         const bool bPressed = Value.Get<bool>();
-        UE_LOG(LogPACSInput, Warning, TEXT("CCTV2: Cam2.ZoomToggle received - Value: %s"), bPressed ? TEXT("true") : TEXT("false"));
+        PACS_LOG_HOT(LogPACSInput, Log, TEXT("CCTV2: Cam2.ZoomToggle received - Value: %s"), bPressed ? TEXT("true") : TEXT("false"));
 
         // Toggle on release to match behavior of Cam1
         if (!bPressed)
@@ -495,7 +631,7 @@ EPACS_InputHandleResult APACS_CandidateHelicopterCharacter::HandleInputAction(FN
     }
     
     // Log unhandled actions
-    UE_LOG(LogPACSInput, Warning, TEXT("Helicopter did NOT handle action: %s"), *ActionName.ToString());
+    PACS_LOG_HOT(LogPACSInput, Log, TEXT("Helicopter did NOT handle action: %s"), *ActionName.ToString());
     return EPACS_InputHandleResult::NotHandled;
 }
 
@@ -518,6 +654,18 @@ void APACS_CandidateHelicopterCharacter::Seat_Z(float Axis)
 }
 
 // ---- CCTV System ----
+void APACS_CandidateHelicopterCharacter::RegisterCCTVFeeds()
+{
+    if (!UPACS_NetPerfSettings::Get()->bScheduleCCTVCaptures) return;
+
+    if (UPACS_CCTVCaptureScheduler* Scheduler = GetWorld()->GetSubsystem<UPACS_CCTVCaptureScheduler>())
+    {
+        // Displayed while a cockpit monitor is on screen for anyone; assessor UI marks what it shows
+        Scheduler->RegisterFeed(ExternalCam,  false, MonitorPlane);
+        Scheduler->RegisterFeed(ExternalCam2, false, MonitorPlane2);
+    }
+}
+
 void APACS_CandidateHelicopterCharacter::SetupCCTV()
 {
     // Create render target with proper settings
@@ -4,11 +4,62 @@
 #include "Actors/Pawn/PACS_AssessorPawn.h"
 #include "Data/Configs/AssessorPawnConfig.h"
 #include "Engine/LocalPlayer.h"
+#include "Engine/GameViewportClient.h"
 #include "Framework/Application/SlateApplication.h"
+#include "Framework/Application/IInputProcessor.h"
+#include "Misc/CoreDelegates.h"
+#include "UnrealClient.h"
 #include "Widgets/SViewport.h"
 
 #if !UE_SERVER
 #include "Blueprint/WidgetLayoutLibrary.h"
+
+/**
+ * Forwards mouse activity to the component without consuming it
+ */
+class FPACS_EdgeScrollInputProcessor : public IInputProcessor
+{
+public:
+    explicit FPACS_EdgeScrollInputProcessor(UPACS_EdgeScrollComponent* InOwner)
+        : Owner(InOwner)
+    {}
+
+    virtual void Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor) override {}
+
+    virtual bool HandleMouseMoveEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override
+    {
+        if (UPACS_EdgeScrollComponent* Component = Owner.Get())
+        {
+            Component->NotifyCursorActivity();
+        }
+        return false;
+    }
+
+    virtual bool HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override
+    {
+        if (UPACS_EdgeScrollComponent* Component = Owner.Get())
+        {
+            Component->NotifyMouseButtons(true);
+        }
+        return false;
+    }
+
+    virtual bool HandleMouseButtonUpEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override
+    {
+        if (UPACS_EdgeScrollComponent* Component = Owner.Get())
+        {
+            TSet<FKey> StillPressed = MouseEvent.GetPressedButtons();
+            StillPressed.Remove(MouseEvent.GetEffectingButton());
+            Component->NotifyMouseButtons(StillPressed.Num() > 0);
+        }
+        return false;
+    }
+
+    virtual const TCHAR* GetDebugName() const override { return TEXT("PACS_EdgeScroll"); }
+
+private:
+    TWeakObjectPtr<UPACS_EdgeScrollComponent> Owner;
+};
 #endif
 
 UPACS_EdgeScrollComponent::UPACS_EdgeScrollComponent()
@@ -16,13 +67,9 @@ UPACS_EdgeScrollComponent::UPACS_EdgeScrollComponent()
     PrimaryComponentTick.bCanEverTick = true;
     PrimaryComponentTick.TickGroup = TG_PostUpdateWork; // After input processing
 
-    // Only tick on clients
+    // Only tick on clients, and only while the cursor is in the edge margin (see NotifyCursorActivity)
     PrimaryComponentTick.bTickEvenWhenPaused = false;
-    SetComponentTickEnabled(true);
-
-#if UE_SERVER
-    SetComponentTickEnabled(false);
-#endif
+    PrimaryComponentTick.bStartWithTickEnabled = false;
 }
 
 void UPACS_EdgeScrollComponent::BeginPlay()
@@ -30,7 +77,16 @@ void UPACS_EdgeScrollComponent::BeginPlay()
     Super::BeginPlay();
 
 #if !UE_SERVER
-    // No ViewportResizedEvent in UE5.5 - use tick-based viewport checking instead
+    APlayerController* PC = GetPlayerController();
+    if (!PC || !PC->IsLocalController())
+    {
+        return;
+    }
+
+    BindSlateEvents();
+
+    // Evaluate wherever the cursor starts
+    NotifyCursorActivity();
 
     UE_LOG(LogTemp, Log, TEXT("EdgeScrollComponent initialized on %s"),
         *GetNameSafe(GetOwner()));
@@ -40,65 +96,183 @@ void UPACS_EdgeScrollComponent::BeginPlay()
 void UPACS_EdgeScrollComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 #if !UE_SERVER
-    // No viewport delegate cleanup needed in UE5.5
+    UnbindSlateEvents();
 #endif
 
     Super::EndPlay(EndPlayReason);
 }
 
+void UPACS_EdgeScrollComponent::BindSlateEvents()
+{
+#if !UE_SERVER
+    if (!FSlateApplication::IsInitialized() || InputProcessor.IsValid())
+    {
+        return;
+    }
+
+    FSlateApplication& SlateApp = FSlateApplication::Get();
+
+    InputProcessor = MakeShared<FPACS_EdgeScrollInputProcessor>(this);
+    SlateApp.RegisterInputPreProcessor(InputProcessor);
+
+    // Anything that can change focus, menus, modality or capture invalidates the cached Slate permission
+    ActivationChangedHandle = SlateApp.OnApplicationActivationStateChanged().AddWeakLambda(this,
+        [this](const bool bIsActive) { MarkSlatePermissionDirty(); NotifyCursorActivity(); });
+    FocusChangingHandle = SlateApp.OnFocusChanging().AddWeakLambda(this,
+        [this](const FFocusEvent&, const FWeakWidgetPath&, const TSharedPtr<SWidget>&, const FWidgetPath&, const TSharedPtr<SWidget>&)
+        {
+            MarkSlatePermissionDirty();
+        });
+    PreModalHandle = FCoreDelegates::PreModal.AddWeakLambda(this, [this]() { MarkSlatePermissionDirty(); });
+    PostModalHandle = FCoreDelegates::PostModal.AddWeakLambda(this, [this]() { MarkSlatePermissionDirty(); });
+    ViewportResizedHandle = FViewport::ViewportResizedEvent.AddUObject(this, &UPACS_EdgeScrollComponent::HandleViewportResized);
+#endif
+}
+
+void UPACS_EdgeScrollComponent::UnbindSlateEvents()
+{
+#if !UE_SERVER
+    FCoreDelegates::PreModal.Remove(PreModalHandle);
+    FCoreDelegates::PostModal.Remove(PostModalHandle);
+    FViewport::ViewportResizedEvent.Remove(ViewportResizedHandle);
+
+    if (FSlateApplication::IsInitialized())
+    {
+        FSlateApplication& SlateApp = FSlateApplication::Get();
+        SlateApp.OnApplicationActivationStateChanged().Remove(ActivationChangedHandle);
+        SlateApp.OnFocusChanging().Remove(FocusChangingHandle);
+        if (InputProcessor.IsValid())
+        {
+            SlateApp.UnregisterInputPreProcessor(InputProcessor);
+        }
+    }
+    InputProcessor.Reset();
+#endif
+}
+
+void UPACS_EdgeScrollComponent::HandleViewportResized(FViewport* Viewport, uint32 Unused)
+{
+    bViewportCacheValid = false;
+    NotifyCursorActivity();
+}
+
+void UPACS_EdgeScrollComponent::SetEnabled(bool bNewEnabled)
+{
+    bEnabled = bNewEnabled;
+    if (bEnabled)
+    {
+        NotifyCursorActivity();
+    }
+    else
+    {
+        bIsActivelyScrolling = false;
+        SetComponentTickEnabled(false);
+    }
+}
+
+void UPACS_EdgeScrollComponent::NotifyCursorActivity()
+{
+#if !UE_SERVER
+    if (bEnabled && !IsComponentTickEnabled())
+    {
+        SetComponentTickEnabled(true);
+    }
+#endif
+}
+
+void UPACS_EdgeScrollComponent::NotifyMouseButtons(bool bAnyHeld)
+{
+    bMouseButtonHeld = bAnyHeld;
+    MarkSlatePermissionDirty();
+    NotifyCursorActivity();
+}
+
+void UPACS_EdgeScrollComponent::SetViewportMetrics(const FVector2D& SizePx, float DPIScale)
+{
+    CachedViewportSize = SizePx;
+    CachedDPIScale = DPIScale;
+    bViewportCacheValid = SizePx.X > 0 && SizePx.Y > 0;
+}
+
 void UPACS_EdgeScrollComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 #if !UE_SERVER
-    if (!bEnabled)
+    ++ActiveTickCount;
+
+    FVector2D MousePos;
+    if (!bEnabled || !UpdateViewportCache() || !GetDPIAwareMousePosition(MousePos))
     {
+        // Nothing to evaluate until the next mouse or viewport event
         bIsActivelyScrolling = false;
+        SetComponentTickEnabled(false);
         return;
     }
 
-    UpdateComponentReadiness();
+    ProcessCursor(MousePos);
 
-    if (!bComponentReady)
+    // Draw debug visualization if enabled
+    if (bShowDebugVisualization)
     {
-        bIsActivelyScrolling = false;
-        return;
+        DrawDebugVisualization();
     }
+#endif
+}
 
-    // Check if edge scrolling should be allowed
-    if (!ShouldAllowEdgeScrolling())
+bool UPACS_EdgeScrollComponent::IsCursorInEdgeZone(const FVector2D& MousePos) const
+{
+    if (!bViewportCacheValid)
     {
-        bIsActivelyScrolling = false;
-        return;
+        return false;
     }
 
-    // Compute edge scroll input
-    FVector2D EdgeAxis = ComputeEdgeScrollInput();
+    const float EdgeMargin = static_cast<float>(GetEdgeMarginPx()) * CachedDPIScale;
+    return MousePos.X <= EdgeMargin || MousePos.X >= CachedViewportSize.X - EdgeMargin ||
+           MousePos.Y <= EdgeMargin || MousePos.Y >= CachedViewportSize.Y - EdgeMargin;
+}
 
+void UPACS_EdgeScrollComponent::ProcessCursor(const FVector2D& MousePos)
+{
+#if !UE_SERVER
     const bool bWasActivelyScrolling = bIsActivelyScrolling;
-    bIsActivelyScrolling = !EdgeAxis.IsNearlyZero();
 
-    // Log state changes
-    if (bIsActivelyScrolling != bWasActivelyScrolling)
+    if (!bEnabled || !IsCursorInEdgeZone(MousePos))
     {
-        UE_LOG(LogTemp, VeryVerbose, TEXT("Edge scrolling %s"),
-            bIsActivelyScrolling ? TEXT("started") : TEXT("stopped"));
+        // At rest away from the edges: no tick until the mouse moves again
+        bIsActivelyScrolling = false;
+        SetComponentTickEnabled(false);
     }
-
-    // Apply edge scroll input to pawn
-    if (bIsActivelyScrolling)
+    else
     {
-        if (APACS_AssessorPawn* AssessorPawn = GetAssessorPawn())
+        // Stay awake while the cursor rests on an edge
+        SetComponentTickEnabled(true);
+
+        UpdateComponentReadiness();
+
+        FVector2D EdgeAxis = FVector2D::ZeroVector;
+        if (bComponentReady && ShouldAllowEdgeScrolling())
         {
-            AssessorPawn->AddPlanarInput(EdgeAxis);
-            UE_LOG(LogTemp, VeryVerbose, TEXT("Applied edge scroll input: %s"), *EdgeAxis.ToString());
+            EdgeAxis = ComputeEdgeScrollInput(MousePos);
+        }
+        bIsActivelyScrolling = !EdgeAxis.IsNearlyZero();
+
+        // Apply edge scroll input to pawn
+        if (bIsActivelyScrolling)
+        {
+            if (APACS_AssessorPawn* AssessorPawn = GetAssessorPawn())
+            {
+                AssessorPawn->AddPlanarInput(EdgeAxis);
+                UE_LOG(LogTemp, VeryVerbose, TEXT("Applied edge scroll input: %s"), *EdgeAxis.ToString());
+            }
         }
     }
 
-    // Draw debug visualization if enabled
-    if (bShowDebugVisualization)
+    // Log state changes
+    if (bIsActivelyScrolling != bWasActivelyScrolling)
     {
-        DrawDebugVisualization();
+        UE_LOG(LogTemp, VeryVerbose, TEXT("Edge scrolling %s"),
+            bIsActivelyScrolling ? TEXT("started") : TEXT("stopped"));
     }
 #endif
 }
@@ -109,15 +283,8 @@ bool UPACS_EdgeScrollComponent::ShouldAllowEdgeScrolling() const
     return false;
 #endif
 
-    // Use cached result if still valid (performance optimization)
-    const float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
-    if (bPermissionCacheValid && (CurrentTime - PermissionCacheTime) < PermissionCacheLifetime)
-    {
-        return bCachedPermissionResult;
-    }
-
     bool bAllowed = false;
-    FString DisallowReason;
+    const TCHAR* DisallowReason = TEXT("");
 
     // Check InputHandler permission (read-only queries - no modifications)
     UPACS_InputHandlerComponent* InputHandler = GetInputHandler();
@@ -137,93 +304,95 @@ bool UPACS_EdgeScrollComponent::ShouldAllowEdgeScrolling() const
     {
         DisallowReason = TEXT("ContextNotAllowed");
     }
+    else if (!GetSlatePermission())
+    {
+        DisallowReason = TEXT("SlateBlocked");
+    }
     else
     {
-        // Check window focus and mouse state
-        if (!FSlateApplication::IsInitialized())
+        // Check pawn and config
+        const UAssessorPawnConfig* Config = GetAssessorConfig();
+        if (!Config || !Config->bEdgeScrollEnabled)
         {
-            DisallowReason = TEXT("SlateNotInitialized");
+            DisallowReason = TEXT("ConfigDisabled");
         }
         else
         {
-            TSharedPtr<SWindow> ActiveWindow = FSlateApplication::Get().GetActiveTopLevelWindow();
-            if (!ActiveWindow.IsValid() || !ActiveWindow->HasFocusedDescendants())
-            {
-                DisallowReason = TEXT("WindowNotFocused");
-            }
-            else if (IsMouseCapturedOrButtonPressed())
-            {
-                DisallowReason = TEXT("MouseCaptured");
-            }
-            else
-            {
-                // Check pawn and config
-                const UAssessorPawnConfig* Config = GetAssessorConfig();
-                if (!Config || !Config->bEdgeScrollEnabled)
-                {
-                    DisallowReason = TEXT("ConfigDisabled");
-                }
-                else
-                {
-                    bAllowed = true;
-                }
-            }
+            bAllowed = true;
         }
     }
 
-    // Cache the result
-    bCachedPermissionResult = bAllowed;
-    bPermissionCacheValid = true;
-    PermissionCacheTime = CurrentTime;
-
-    // Log state changes (throttled)
+    // Log state changes
     static bool bLastAllowed = false;
-    static float LastLogTime = 0.0f;
-    const bool bShouldLog = (bAllowed != bLastAllowed) ||
-                           ((CurrentTime - LastLogTime) > 5.0f && !DisallowReason.IsEmpty());
-
-    if (bShouldLog)
+    if (bAllowed != bLastAllowed)
     {
         UE_LOG(LogTemp, Log, TEXT("Edge scrolling %s%s"),
             bAllowed ? TEXT("ALLOWED") : TEXT("BLOCKED"),
-            bAllowed ? TEXT("") : *FString::Printf(TEXT(" (%s)"), *DisallowReason));
+            bAllowed ? TEXT("") : *FString::Printf(TEXT(" (%s)"), DisallowReason));
 
         bLastAllowed = bAllowed;
-        LastLogTime = CurrentTime;
     }
 
     return bAllowed;
 }
 
-FVector2D UPACS_EdgeScrollComponent::ComputeEdgeScrollInput() const
+bool UPACS_EdgeScrollComponent::GetSlatePermission() const
 {
 #if UE_SERVER
-    return FVector2D::ZeroVector;
-#endif
+    return false;
+#else
+    if (!bSlatePermissionDirty)
+    {
+        return bCachedSlatePermission;
+    }
 
-    const UAssessorPawnConfig* Config = GetAssessorConfig();
-    if (!Config)
+    bSlatePermissionDirty = false;
+    bCachedSlatePermission = false;
+
+    if (!FSlateApplication::IsInitialized())
     {
-        return FVector2D::ZeroVector;
+        return false;
     }
 
-    // Update viewport cache if needed
-    if (!UpdateViewportCache())
+    FSlateApplication& SlateApp = FSlateApplication::Get();
+    ++SlateQueryCount;
+
+    // Window focus
+    TSharedPtr<SWindow> ActiveWindow = SlateApp.GetActiveTopLevelWindow();
+    if (!ActiveWindow.IsValid() || !ActiveWindow->HasFocusedDescendants())
     {
-        return FVector2D::ZeroVector;
+        UE_LOG(LogTemp, VeryVerbose, TEXT("Edge scroll blocked: window not focused"));
+        return false;
     }
 
-    // Get DPI-aware mouse position
-    FVector2D MousePos;
-    if (!GetDPIAwareMousePosition(MousePos))
+    // Modal windows and open menus always block edge scrolling
+    if (SlateApp.GetActiveModalWindow().IsValid() || SlateApp.AnyMenusVisible())
     {
-        return FVector2D::ZeroVector;
+        UE_LOG(LogTemp, VeryVerbose, TEXT("Edge scroll blocked: modal window or menu"));
+        return false;
+    }
+
+    // Mouse buttons held (tracked from button events) or mouse captured
+    if (bMouseButtonHeld || SlateApp.GetMouseCaptureWindow() != nullptr)
+    {
+        UE_LOG(LogTemp, VeryVerbose, TEXT("Edge scroll blocked: mouse captured"));
+        return false;
     }
 
-    // Check for UI hover blocking (only when near edges for performance)
-    if (IsMouseOverInteractiveUI(MousePos, CachedViewportSize, Config->EdgeMarginPx))
+    bCachedSlatePermission = true;
+    return true;
+#endif
+}
+
+FVector2D UPACS_EdgeScrollComponent::ComputeEdgeScrollInput(const FVector2D& MousePos) const
+{
+#if UE_SERVER
+    return FVector2D::ZeroVector;
+#endif
+
+    const UAssessorPawnConfig* Config = GetAssessorConfig();
+    if (!Config || !bViewportCacheValid)
     {
-        UE_LOG(LogTemp, VeryVerbose, TEXT("Edge scroll blocked by UI hover"));
         return FVector2D::ZeroVector;
     }
 
@@ -289,6 +458,8 @@ bool UPACS_EdgeScrollComponent::GetDPIAwareMousePosition(FVector2D& OutMousePos)
     return false;
 #endif
 
+    ++SlateQueryCount;
+
     // Epic's recommended pattern: Use UGameViewportClient for viewport-local mouse coordinates
     if (UGameViewportClient* ViewportClient = GetWorld()->GetGameViewport())
     {
@@ -314,87 +485,6 @@ bool UPACS_EdgeScrollComponent::GetDPIAwareMousePosition(FVector2D& OutMousePos)
     return false;
 }
 
-bool UPACS_EdgeScrollComponent::IsMouseOverInteractiveUI(const FVector2D& MousePos, const FVector2D& ViewportSize, int32 EdgeMarginPx) const
-{
-#if UE_SERVER
-    return false;
-#endif
-
-    // Performance optimization: only check UI if mouse is actually near edges
-    const float EdgeMargin = static_cast<float>(EdgeMarginPx) * CachedDPIScale;
-    const bool bNearEdge = (MousePos.X <= EdgeMargin) ||
-                          (MousePos.X >= ViewportSize.X - EdgeMargin) ||
-                          (MousePos.Y <= EdgeMargin) ||
-                          (MousePos.Y >= ViewportSize.Y - EdgeMargin);
-
-    if (!bNearEdge)
-    {
-        return false;
-    }
-
-    // UE5.5 simplified approach: Check for modal windows or active menus
-    FSlateApplication& SlateApp = FSlateApplication::Get();
-
-    // Check for modal windows (always block edge scrolling)
-    if (SlateApp.GetActiveModalWindow().IsValid())
-    {
-        UE_LOG(LogTemp, VeryVerbose, TEXT("Edge scroll blocked: Modal window active"));
-        return true;
-    }
-
-    // Check if any menus are open
-    if (SlateApp.AnyMenusVisible())
-    {
-        UE_LOG(LogTemp, VeryVerbose, TEXT("Edge scroll blocked: Menu visible"));
-        return true;
-    }
-
-    // Check if mouse is in edge margin area - if not, we dont care about UI detection
-    const float LeftEdge = EdgeMarginPx;
-    const float RightEdge = ViewportSize.X - EdgeMarginPx;
-    const float TopEdge = EdgeMarginPx;
-    const float BottomEdge = ViewportSize.Y - EdgeMarginPx;
-
-    bool bInEdgeArea = (MousePos.X <= LeftEdge || MousePos.X >= RightEdge ||
-                       MousePos.Y <= TopEdge || MousePos.Y >= BottomEdge);
-
-    if (!bInEdgeArea)
-    {
-        return false; // Not in edge area, no need to check for UI
-    }
-
-    // For edge areas, use conservative approach - only allow if no UI interaction is happening
-    return false; // Allow edge scrolling in edge areas if no modal/menu
-}
-
-bool UPACS_EdgeScrollComponent::IsMouseCapturedOrButtonPressed() const
-{
-#if UE_SERVER
-    return false;
-#endif
-
-    if (!FSlateApplication::IsInitialized())
-    {
-        return false;
-    }
-
-    const FSlateApplication& SlateApp = FSlateApplication::Get();
-
-    // Check if any mouse buttons are pressed
-    if (SlateApp.GetPressedMouseButtons().Num() > 0)
-    {
-        return true;
-    }
-
-    // Check if mouse is captured (UE5.5 API)
-    if (SlateApp.GetMouseCaptureWindow() != nullptr)
-    {
-        return true;
-    }
-
-    return false;
-}
-
 bool UPACS_EdgeScrollComponent::IsCurrentContextAllowedForEdgeScrolling() const
 {
 #if UE_SERVER
@@ -483,31 +573,35 @@ bool UPACS_EdgeScrollComponent::UpdateViewportCache() const
     }
 
     // Epic's recommended pattern: Use UGameViewportClient for exact render dimensions
-    if (UGameViewportClient* ViewportClient = GetWorld()->GetGameViewport())
-    {
-        // Epic's preferred method - gets actual render target size, not widget geometry
-        FVector2D NewViewportSize;
-        ViewportClient->GetViewportSize(NewViewportSize);
-        CachedViewportSize = NewViewportSize;
-        CachedDPIScale = ViewportClient->GetDPIScale();
-    }
-    else
+    UGameViewportClient* ViewportClient = GetWorld()->GetGameViewport();
+    if (!ViewportClient)
     {
         return false;
     }
 
-    if (CachedViewportSize.X <= 0 || CachedViewportSize.Y <= 0)
+    // Read once; HandleViewportResized invalidates
+    ++SlateQueryCount;
+    FVector2D NewViewportSize;
+    ViewportClient->GetViewportSize(NewViewportSize);
+    const_cast<UPACS_EdgeScrollComponent*>(this)->SetViewportMetrics(NewViewportSize, ViewportClient->GetDPIScale());
+
+    if (!bViewportCacheValid)
     {
         return false;
     }
 
-    bViewportCacheValid = true;
     UE_LOG(LogTemp, VeryVerbose, TEXT("Updated viewport cache: Size=%s, DPI=%.2f"),
         *CachedViewportSize.ToString(), CachedDPIScale);
 
     return true;
 }
 
+int32 UPACS_EdgeScrollComponent::GetEdgeMarginPx() const
+{
+    const UAssessorPawnConfig* Config = GetAssessorConfig();
+    return Config ? Config->EdgeMarginPx : GetDefault<UAssessorPawnConfig>()->EdgeMarginPx;
+}
+
 void UPACS_EdgeScrollComponent::UpdateComponentReadiness()
 {
 #if !UE_SERVER
@@ -533,7 +627,7 @@ void UPACS_EdgeScrollComponent::UpdateComponentReadiness()
 
 void UPACS_EdgeScrollComponent::InvalidateCaches()
 {
-    bPermissionCacheValid = false;
+    bSlatePermissionDirty = true;
     bViewportCacheValid = false;
 
     // Clear weak references to force re-lookup
@@ -666,5 +760,3 @@ void UPACS_EdgeScrollComponent::DrawDebugVisualization() const
     }
 #endif
 }
-
-// Viewport resize handling moved to UpdateViewportCache() method in UE5.5
\ No newline at end of file
@@ -1,15 +1,19 @@
 #include "Components/PACS_HeliMovementComponent.h"
-#include "GameFramework/GameStateBase.h"
+#include "Components/PACS_HeliPhaseTimings.h"
+#include "Subsystems/PACS_ServerClockSubsystem.h"
+#include "Subsystems/PACS_HeliOrbitSolver.h"
 #include "Actors/Pawn/PACS_CandidateHelicopterCharacter.h"
 #include "Data/Configs/PACS_CandidateHelicopterData.h"
 #include "Data/PACS_HeliSavedMove.h"
 #include "Curves/CurveFloat.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
 
-static float Eval01(float StartS, float DurS, UCurveFloat* Curve, float NowS)
+static float Eval01(float StartS, float DurS, const UPACS_CandidateHelicopterData& D, EPACS_OrbitCurve Which, float NowS)
 {
     if (DurS <= 0.f) return 1.f;
     const float T = FMath::Clamp((NowS - StartS)/DurS, 0.f, 1.f);
-    return Curve ? Curve->GetFloatValue(T) : T;
+    return D.EvalOrbitCurve01(Which, T);
 }
 
 void UPACS_HeliMovementComponent::OnRegister()
@@ -17,6 +21,26 @@ void UPACS_HeliMovementComponent::OnRegister()
     Super::OnRegister();
     SetMovementMode(MOVE_Custom, (uint8)EPACS_HeliMoveMode::CMOVE_HeliOrbit);
     bConstrainToPlane = true;
+
+    if (UWorld* World = GetWorld())
+    {
+        if (UPACS_HeliOrbitSolver* Solver = World->GetSubsystem<UPACS_HeliOrbitSolver>())
+        {
+            Solver->RegisterComponent(this);
+        }
+    }
+}
+
+void UPACS_HeliMovementComponent::OnUnregister()
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (UPACS_HeliOrbitSolver* Solver = World->GetSubsystem<UPACS_HeliOrbitSolver>())
+        {
+            Solver->UnregisterComponent(this);
+        }
+    }
+    Super::OnUnregister();
 }
 
 void UPACS_HeliMovementComponent::OnMovementModeChanged(EMovementMode Prev, uint8 PrevCustom)
@@ -62,24 +86,146 @@ void UPACS_HeliMovementComponent::PhysCustom(float Dt, int32 Iter)
 
     if (Role == ROLE_Authority)
     {
-        TickClock_Server();   Eval_Server();   ApplyAltitudePlane();   UpdateAngle_Server();   StepKinematics(Dt);
+        if (ConsumeSolvedOrbit())
+        {
+            ApplyAltitudePlane();   StepKinematics(Dt);
+        }
+        else
+        {
+            TickClock_Server();   Eval_Server();   ApplyAltitudePlane();   UpdateAngle_Server();   StepKinematics(Dt);
+        }
+        PostStepVisuals(Dt);
         return;
     }
     if (Role == ROLE_AutonomousProxy)
     {
         TickClock_Client();   Eval_Client();   ApplyAltitudePlane();   UpdateAngle_Client();   StepKinematics(Dt);
+        PostStepVisuals(Dt);
+        return;
+    }
+
+    if (Data && Data->bAnalyticProxyMovement)
+    {
+        SimulateProxyStep(Dt);
         return;
     }
 
-    TickClock_Proxy();        Eval_Proxy();    ApplyAltitudePlane();   UpdateAngle_Proxy();    StepKinematics(Dt);
+    if (ConsumeSolvedOrbit())
+    {
+        ApplyAltitudePlane();   StepKinematics(Dt);
+    }
+    else
+    {
+        TickClock_Proxy();    Eval_Proxy();    ApplyAltitudePlane();   UpdateAngle_Proxy();    StepKinematics(Dt);
+    }
+    PostStepVisuals(Dt);
 }
 
-void UPACS_HeliMovementComponent::TickClock_Server()
+void UPACS_HeliMovementComponent::SimulateProxyStep(float Dt)
 {
-    if (const AGameStateBase* GS = GetWorld()->GetGameState())
-        ServerNowS = GS->GetServerWorldTimeSeconds();
+    if (ConsumeSolvedOrbit())
+    {
+        ApplyAltitudePlane();   StepAnalytic(Dt);
+    }
     else
-        ServerNowS = GetWorld()->GetTimeSeconds();
+    {
+        TickClock_Proxy();    Eval_Proxy();    ApplyAltitudePlane();   UpdateAngle_Proxy();    StepAnalytic(Dt);
+    }
+    PostStepVisuals(Dt);
+}
+
+bool UPACS_HeliMovementComponent::IsOrbitSolverEligible() const
+{
+    // Owners replay saved moves through PhysCustom with a per-move dt, so they keep the per-component path
+    const ENetRole Role = CharacterOwner ? CharacterOwner->GetLocalRole() : ROLE_None;
+    return Data && Role != ROLE_AutonomousProxy && Role != ROLE_None
+        && MovementMode == MOVE_Custom && CustomMovementMode == (uint8)EPACS_HeliMoveMode::CMOVE_HeliOrbit
+        && Cast<APACS_CandidateHelicopterCharacter>(CharacterOwner) != nullptr;
+}
+
+void UPACS_HeliMovementComponent::GatherOrbitState(FPACS_HeliOrbitState& Out) const
+{
+    const APACS_CandidateHelicopterCharacter* C = CastChecked<APACS_CandidateHelicopterCharacter>(CharacterOwner);
+    Out.Data       = Data;
+    Out.Targets    = C->OrbitTargets;
+    Out.Anchors    = C->OrbitAnchors;
+    Out.CenterCm   = CenterCm;
+    Out.AltitudeCm = AltitudeCm;
+    Out.RadiusCm   = RadiusCm;
+    Out.SpeedCms   = SpeedCms;
+    Out.AngleRad   = AngleRad;
+}
+
+void UPACS_HeliMovementComponent::ApplyOrbitState(const FPACS_HeliOrbitState& In, double InSolvedAtS)
+{
+    CenterCm   = In.CenterCm;
+    AltitudeCm = In.AltitudeCm;
+    RadiusCm   = In.RadiusCm;
+    SpeedCms   = In.SpeedCms;
+    AngleRad   = In.AngleRad;
+    ServerNowS = In.NowS;
+    SolvedAtS  = InSolvedAtS;
+}
+
+bool UPACS_HeliMovementComponent::ConsumeSolvedOrbit()
+{
+    UWorld* World = GetWorld();
+    UPACS_HeliOrbitSolver* Solver = World ? World->GetSubsystem<UPACS_HeliOrbitSolver>() : nullptr;
+    if (!Solver || !Solver->IsEnabled()) return false;
+
+    Solver->SolveFrame();
+    return SolvedAtS == Solver->GetLastSolveTime();
+}
+
+void UPACS_HeliMovementComponent::PostStepVisuals(float Dt)
+{
+    // Saved-move replay re-runs PhysCustom several times in one frame; bank and camera smoothing
+    // are per-frame visuals, so only the live move drives them
+    if (CharacterOwner && CharacterOwner->bClientUpdating) return;
+
+    UpdateBank(Dt);
+    if (APACS_CandidateHelicopterCharacter* C = Cast<APACS_CandidateHelicopterCharacter>(CharacterOwner))
+    {
+        C->UpdateStaticCameraPosition(Dt);
+    }
+}
+
+float UPACS_HeliMovementComponent::ComputeBankTargetDeg(float InSpeedCms, float InRadiusCm, float MaxBankDeg)
+{
+    if (InSpeedCms <= KINDA_SMALL_NUMBER || InRadiusCm <= 1.f) return 0.f;
+
+    // Coordinated turn: tan(bank) = v * omega / g
+    const float Omega = InSpeedCms / InRadiusCm;
+    const float BankDeg = FMath::RadiansToDegrees(FMath::Atan(InSpeedCms * Omega / 980.665f));
+    return -FMath::Min(BankDeg, MaxBankDeg); //<-------- Change bank direction
+}
+
+void UPACS_HeliMovementComponent::UpdateBank(float Dt)
+{
+    PACS_HELI_PHASE(UpdateBankVisual);
+
+    APACS_CandidateHelicopterCharacter* C = Cast<APACS_CandidateHelicopterCharacter>(CharacterOwner);
+    if (!C || !Data || !C->HelicopterFrame) return;
+
+    BankAccumS += Dt;
+    if (BankAccumS < BankUpdateInterval) return;
+    const float StepDt = BankAccumS;
+    BankAccumS = 0.f;
+
+    const float Target = ComputeBankTargetDeg(SpeedCms, RadiusCm, Data->MaxBankDeg);
+    C->CurrentBankDeg = FMath::FInterpTo(C->CurrentBankDeg, Target, StepDt, C->BankInterpSpeed);
+
+    if (FMath::Abs(C->CurrentBankDeg - AppliedBankDeg) < Data->BankApplyThresholdDeg) return;
+    AppliedBankDeg = C->CurrentBankDeg;
+    ++BankTransformUpdates;
+    C->HelicopterFrame->SetRelativeRotation(FRotator(0, 0, AppliedBankDeg));
+}
+
+void UPACS_HeliMovementComponent::TickClock_Server()
+{
+    PACS_HELI_PHASE(TickClock);
+    // Shared per-world value: smoothed once per frame, identical for every helicopter
+    ServerNowS = UPACS_ServerClockSubsystem::GetServerNowS(GetWorld());
 }
 
 void UPACS_HeliMovementComponent::TickClock_Client() { TickClock_Server(); }
@@ -87,6 +233,7 @@ void UPACS_HeliMovementComponent::TickClock_Proxy()  { TickClock_Server(); }
 
 void UPACS_HeliMovementComponent::Eval_Server()
 {
+    PACS_HELI_PHASE(Eval);
     const APACS_CandidateHelicopterCharacter* C = Cast<APACS_CandidateHelicopterCharacter>(CharacterOwner);
     
     // Optional: remove after validation
@@ -94,23 +241,31 @@ void UPACS_HeliMovementComponent::Eval_Server()
     
     if (!C || !Data) return;
 
-    const float UseCenterDur = (C->OrbitTargets.CenterDurS > 0.f) ? C->OrbitTargets.CenterDurS : 0.f;
-    const float UseAltDur    = (C->OrbitTargets.AltDurS    > 0.f) ? C->OrbitTargets.AltDurS    : 0.f;
-    const float UseRadiusDur = (C->OrbitTargets.RadiusDurS > 0.f) ? C->OrbitTargets.RadiusDurS : 0.f;
-    const float UseSpeedDur  = (C->OrbitTargets.SpeedDurS  > 0.f) ? C->OrbitTargets.SpeedDurS  : 0.f;
+    EvalOrbitTargets(C->OrbitTargets, C->OrbitAnchors, *Data, ServerNowS, FApp::GetDeltaTime(),
+                     CenterCm, AltitudeCm, RadiusCm, SpeedCms);
+}
+
+void UPACS_HeliMovementComponent::EvalOrbitTargets(const FPACS_OrbitTargets& Targets, const FPACS_OrbitAnchors& Anchors,
+                                                   const UPACS_CandidateHelicopterData& D, float NowS, float FrameDt,
+                                                   FVector& InOutCenterCm, float& InOutAltitudeCm, float& InOutRadiusCm, float& InOutSpeedCms)
+{
+    const float UseCenterDur = (Targets.CenterDurS > 0.f) ? Targets.CenterDurS : 0.f;
+    const float UseAltDur    = (Targets.AltDurS    > 0.f) ? Targets.AltDurS    : 0.f;
+    const float UseRadiusDur = (Targets.RadiusDurS > 0.f) ? Targets.RadiusDurS : 0.f;
+    const float UseSpeedDur  = (Targets.SpeedDurS  > 0.f) ? Targets.SpeedDurS  : 0.f;
 
-    const float aC = Eval01(C->OrbitAnchors.CenterStartS, UseCenterDur, Data->CenterInterp, ServerNowS);
-    const float aA = Eval01(C->OrbitAnchors.AltStartS,    UseAltDur,    Data->AltInterp,    ServerNowS);
-    const float aR = Eval01(C->OrbitAnchors.RadiusStartS, UseRadiusDur, Data->RadiusInterp, ServerNowS);
-    const float aS = Eval01(C->OrbitAnchors.SpeedStartS,  UseSpeedDur,  Data->SpeedInterp,  ServerNowS);
+    const float aC = Eval01(Anchors.CenterStartS, UseCenterDur, D, EPACS_OrbitCurve::Center, NowS);
+    const float aA = Eval01(Anchors.AltStartS,    UseAltDur,    D, EPACS_OrbitCurve::Alt,    NowS);
+    const float aR = Eval01(Anchors.RadiusStartS, UseRadiusDur, D, EPACS_OrbitCurve::Radius, NowS);
+    const float aS = Eval01(Anchors.SpeedStartS,  UseSpeedDur,  D, EPACS_OrbitCurve::Speed,  NowS);
 
-    const FVector DesiredC = FMath::Lerp(CenterCm, C->OrbitTargets.CenterCm, aC);
-    const float   MaxStep  = (Data->MaxCenterDriftCms) * FApp::GetDeltaTime();
-    CenterCm += (DesiredC - CenterCm).GetClampedToMaxSize(MaxStep);
+    const FVector DesiredC = FMath::Lerp(InOutCenterCm, (FVector)Targets.CenterCm, aC);
+    const float   MaxStep  = (D.MaxCenterDriftCms) * FrameDt;
+    InOutCenterCm += (DesiredC - InOutCenterCm).GetClampedToMaxSize(MaxStep);
 
-    AltitudeCm = FMath::Lerp(AltitudeCm, C->OrbitTargets.AltitudeCm, aA);
-    RadiusCm   = FMath::Max(FMath::Lerp(RadiusCm,   C->OrbitTargets.RadiusCm,   aR), 1.f);
-    SpeedCms   = FMath::Clamp(FMath::Lerp(SpeedCms, C->OrbitTargets.SpeedCms,   aS), 0.f, Data->MaxSpeedCms);
+    InOutAltitudeCm = FMath::Lerp(InOutAltitudeCm, Targets.AltitudeCm, aA);
+    InOutRadiusCm   = FMath::Max(FMath::Lerp(InOutRadiusCm,   Targets.RadiusCm,   aR), 1.f);
+    InOutSpeedCms   = FMath::Clamp(FMath::Lerp(InOutSpeedCms, Targets.SpeedCms,   aS), 0.f, D.MaxSpeedCms);
 }
 
 void UPACS_HeliMovementComponent::Eval_Client() { Eval_Server(); }
@@ -118,10 +273,17 @@ void UPACS_HeliMovementComponent::Eval_Proxy()  { Eval_Server(); }
 
 void UPACS_HeliMovementComponent::UpdateAngle_Server()
 {
+    PACS_HELI_PHASE(UpdateAngle);
     const APACS_CandidateHelicopterCharacter* C = Cast<APACS_CandidateHelicopterCharacter>(CharacterOwner);
-    if (!C || SpeedCms <= KINDA_SMALL_NUMBER || RadiusCm <= 1.f) return;
-    const float Omega = SpeedCms / RadiusCm;
-    AngleRad = FMath::UnwindRadians(C->OrbitAnchors.AngleAtStart + Omega * (ServerNowS - C->OrbitAnchors.OrbitStartS));
+    if (!C) return;
+    AngleRad = EvalOrbitAngle(C->OrbitAnchors, SpeedCms, RadiusCm, ServerNowS, AngleRad);
+}
+
+float UPACS_HeliMovementComponent::EvalOrbitAngle(const FPACS_OrbitAnchors& Anchors, float InSpeedCms, float InRadiusCm, float NowS, float CurrentAngleRad)
+{
+    if (InSpeedCms <= KINDA_SMALL_NUMBER || InRadiusCm <= 1.f) return CurrentAngleRad;
+    const float Omega = InSpeedCms / InRadiusCm;
+    return FMath::UnwindRadians(Anchors.AngleAtStart + Omega * (NowS - Anchors.OrbitStartS));
 }
 
 void UPACS_HeliMovementComponent::UpdateAngle_Client() { UpdateAngle_Server(); }
@@ -129,6 +291,7 @@ void UPACS_HeliMovementComponent::UpdateAngle_Proxy()  { UpdateAngle_Server(); }
 
 void UPACS_HeliMovementComponent::ApplyAltitudePlane()
 {
+    PACS_HELI_PHASE(ApplyAltitudePlane);
     if (!FMath::IsNearlyEqual(LastPlaneZ, AltitudeCm, 0.1f))
     {
         SetPlaneConstraintEnabled(true);
@@ -138,17 +301,82 @@ void UPACS_HeliMovementComponent::ApplyAltitudePlane()
     }
 }
 
+FVector UPACS_HeliMovementComponent::OrbitPositionAt(const FVector& Center, float Radius, float Angle, float Altitude)
+{
+    const float s = FMath::Sin(Angle), c = FMath::Cos(Angle);
+    return FVector(Center.X - Radius * c, Center.Y + Radius * s, Altitude);
+}
+
+FVector UPACS_HeliMovementComponent::OrbitTangentAt(float Angle)
+{
+    const float s = FMath::Sin(Angle), c = FMath::Cos(Angle);
+    return FVector(s, c, 0.f); //<-------- Change orbit direction (keep OrbitPositionAt in step)
+}
+
 void UPACS_HeliMovementComponent::StepKinematics(float Dt)
 {
-    const float s = FMath::Sin(AngleRad), c = FMath::Cos(AngleRad);
-    const FVector Tangent(s, c, 0.f); //<-------- Change orbit direction
+    PACS_HELI_PHASE(StepKinematics);
+    const FVector Tangent = OrbitTangentAt(AngleRad);
+    Velocity = Tangent * SpeedCms;
+
+    // Sweep toward the closed-form point rather than integrating Velocity*Dt so that
+    // authority, owner and analytic proxies agree on where the orbit is.
+    SweepTo(EvalOrbitPosition(), Tangent.ToOrientationRotator());
+}
+
+void UPACS_HeliMovementComponent::StepAnalytic(float Dt)
+{
+    PACS_HELI_PHASE(StepKinematics);
+    const FVector Tangent = OrbitTangentAt(AngleRad);
     Velocity = Tangent * SpeedCms;
-    const FRotator Yaw = Tangent.ToOrientationRotator();
+    const FVector  Target = EvalOrbitPosition();
+    const FRotator Yaw    = Tangent.ToOrientationRotator();
+
+    if (IsNearGeometry_Proxy())
+    {
+        ++ProxySweepSteps;
+        SweepTo(Target, Yaw);
+        return;
+    }
+
+    ++ProxyTeleportSteps;
+    UpdatedComponent->SetWorldLocationAndRotation(Target, Yaw, /*bSweep=*/false, nullptr, ETeleportType::TeleportPhysics);
+}
+
+void UPACS_HeliMovementComponent::SweepTo(const FVector& Target, const FRotator& Rot)
+{
+    const FVector Delta = Target - UpdatedComponent->GetComponentLocation();
 
     FHitResult Hit;
-    SafeMoveUpdatedComponent(Velocity * Dt, Yaw, /*bSweep=*/true, Hit);
+    SafeMoveUpdatedComponent(Delta, Rot, /*bSweep=*/true, Hit);
     if (Hit.IsValidBlockingHit())
     {
-        SlideAlongSurface(Velocity * Dt, 1.f - Hit.Time, Hit.Normal, Hit, true);
+        SlideAlongSurface(Delta, 1.f - Hit.Time, Hit.Normal, Hit, true);
+    }
+}
+
+bool UPACS_HeliMovementComponent::IsNearGeometry_Proxy()
+{
+    UWorld* World = GetWorld();
+    if (!World || !UpdatedComponent) return true;
+
+    const float Interval = Data ? Data->ProxyGeometryCheckIntervalS : 0.5f;
+    if (ServerNowS < NextProxyGeometryCheckS)
+    {
+        return bProxyNearGeometry;
     }
+    NextProxyGeometryCheckS = ServerNowS + Interval;
+    ++ProxyGeometryChecks;
+
+    // One sphere around the current orbit point, sized to cover everything the proxy can reach
+    // before the next check. Only world-static geometry counts; other helicopters never block.
+    const float Capsule = CharacterOwner && CharacterOwner->GetCapsuleComponent()
+        ? CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius() : 100.f;
+    const float Clearance = Data ? Data->ProxyGeometryClearanceCm : 1000.f;
+    const float Reach = Capsule + Clearance + SpeedCms * Interval;
+
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(PACS_HeliProxyGeometry), false, CharacterOwner);
+    bProxyNearGeometry = World->OverlapAnyTestByObjectType(EvalOrbitPosition(), FQuat::Identity,
+        FCollisionObjectQueryParams(ECC_WorldStatic), FCollisionShape::MakeSphere(Reach), Params);
+    return bProxyNearGeometry;
 }
\ No newline at end of file
@@ -0,0 +1,37 @@
+#include "Components/PACS_HeliPhaseTimings.h"
+
+DEFINE_STAT(STAT_PACSHeli_TickClock);
+DEFINE_STAT(STAT_PACSHeli_Eval);
+DEFINE_STAT(STAT_PACSHeli_ApplyAltitudePlane);
+DEFINE_STAT(STAT_PACSHeli_UpdateAngle);
+DEFINE_STAT(STAT_PACSHeli_StepKinematics);
+DEFINE_STAT(STAT_PACSHeli_UpdateBankVisual);
+
+bool   FPACS_HeliPhaseTimings::bEnabled = false;
+uint64 FPACS_HeliPhaseTimings::Cycles[FPACS_HeliPhaseTimings::NumPhases] = {};
+uint64 FPACS_HeliPhaseTimings::Calls[FPACS_HeliPhaseTimings::NumPhases]  = {};
+
+void FPACS_HeliPhaseTimings::Reset()
+{
+    FMemory::Memzero(Cycles);
+    FMemory::Memzero(Calls);
+}
+
+double FPACS_HeliPhaseTimings::GetMicroseconds(EPACS_HeliPhase Phase)
+{
+    return FPlatformTime::ToMilliseconds64(Cycles[(int32)Phase]) * 1000.0;
+}
+
+const TCHAR* FPACS_HeliPhaseTimings::GetPhaseName(EPACS_HeliPhase Phase)
+{
+    switch (Phase)
+    {
+    case EPACS_HeliPhase::TickClock:          return TEXT("TickClock");
+    case EPACS_HeliPhase::Eval:               return TEXT("Eval");
+    case EPACS_HeliPhase::ApplyAltitudePlane: return TEXT("ApplyAltitudePlane");
+    case EPACS_HeliPhase::UpdateAngle:        return TEXT("UpdateAngle");
+    case EPACS_HeliPhase::StepKinematics:     return TEXT("StepKinematics");
+    case EPACS_HeliPhase::UpdateBankVisual:   return TEXT("UpdateBankVisual");
+    default:                                  return TEXT("Unknown");
+    }
+}
@@ -7,9 +7,15 @@
 #include "Interfaces/PACS_SelectableCharacterInterface.h"
 #include "Actors/NPC/PACS_NPC_Base.h"
 #include "Data/PACS_SelectionProfile.h"
+#include "Subsystems/PACS_SelectableRegistrySubsystem.h"
+#include "Subsystems/PACS_SelectionPlaneManager.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
 
+DECLARE_STATS_GROUP(TEXT("PACS_Hover"), STATGROUP_PACSHover, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Hover Probe"), STAT_PACSHover_Probe, STATGROUP_PACSHover);
+DECLARE_CYCLE_STAT(TEXT("Hover Rebuild Bucket"), STAT_PACSHover_RebuildBucket, STATGROUP_PACSHover);
+
 UPACS_HoverProbeComponent::UPACS_HoverProbeComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -97,6 +103,90 @@ void UPACS_HoverProbeComponent::ProbeOnce()
 		return;
 	}
 
+	// No cursor (e.g. captured by a widget or no viewport) - nothing can be under it
+	float MouseX = 0.0f;
+	float MouseY = 0.0f;
+	if (!OwnerPC->GetMousePosition(MouseX, MouseY))
+	{
+		bHasCachedProbe = false;
+		LastBucketCandidate = nullptr;
+		ClearHover();
+		return;
+	}
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	OwnerPC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+	const UWorld* World = GetWorld();
+	ProbeAtScreenPosition(FVector2D(MouseX, MouseY), ViewLocation, ViewRotation, World ? World->GetTimeSeconds() : 0.0);
+}
+
+void UPACS_HoverProbeComponent::ProbeAtScreenPosition(const FVector2D& CursorPosition, const FVector& ViewLocation, const FRotator& ViewRotation, double Now)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PACSHover_Probe);
+
+	if (!bUseHoverCache)
+	{
+		ProbeWithTraces(CursorPosition);
+		return;
+	}
+
+	// Nothing moved since the last probe - the previous result still stands
+	if (bHasCachedProbe
+		&& FVector2D::DistSquared(CursorPosition, LastProbeCursor) <= FMath::Square(CursorMoveThresholdPx)
+		&& FVector::DistSquared(ViewLocation, LastProbeViewLocation) <= FMath::Square(CameraMoveThreshold)
+		&& ViewRotation.Equals(LastProbeViewRotation, CameraRotationThreshold)
+		&& (Now - LastProbeTime) < MaxCacheAge)
+	{
+		++SkippedProbeCount;
+		return;
+	}
+
+	bHasCachedProbe = true;
+	LastProbeCursor = CursorPosition;
+	LastProbeViewLocation = ViewLocation;
+	LastProbeViewRotation = ViewRotation;
+	LastProbeTime = Now;
+
+	if (ScreenBucket.GetBuildFrame() != GFrameCounter)
+	{
+		RebuildScreenBucket(ViewLocation, ViewRotation);
+	}
+
+	// Empty space resolves without a trace
+	UPACS_SelectionPlaneComponent* Candidate = ScreenBucket.FindNearestAt(CursorPosition);
+	if (!Candidate)
+	{
+		LastBucketCandidate = nullptr;
+		LastResolvedPlane = nullptr;
+		ClearHover();
+		return;
+	}
+
+	// Only a change of candidate needs resolving again; ApplyHover re-checks availability every probe.
+	// An occluded candidate is re-confirmed once per probe interval, as the occluder or NPC may have moved
+	const bool bOcclusionExpired = bConfirmVisibility && !LastResolvedPlane.IsValid()
+		&& (Now - LastConfirmTime) >= 1.0 / FMath::Max(RateHz, 1.0f);
+	if (Candidate != LastBucketCandidate.Get() || bOcclusionExpired)
+	{
+		LastBucketCandidate = Candidate;
+		LastResolvedPlane = Candidate;
+
+		// The bucket only knows bounds, not occlusion - confirm with a single object trace
+		if (bConfirmVisibility)
+		{
+			LastConfirmTime = Now;
+			FHitResult HitResult;
+			LastResolvedPlane = TraceObjectsAt(CursorPosition, HitResult) ? ResolveHitPlane(HitResult) : nullptr;
+		}
+	}
+
+	ApplyHover(LastResolvedPlane.Get());
+}
+
+void UPACS_HoverProbeComponent::ProbeWithTraces(const FVector2D& CursorPosition)
+{
 	// Perform line trace from cursor using object type query for selection planes
 	FHitResult HitResult;
 	bool bHit = false;
@@ -104,87 +194,185 @@ void UPACS_HoverProbeComponent::ProbeOnce()
 	// Use object type query if configured
 	if (HoverObjectTypes.Num() > 0)
 	{
-		bHit = OwnerPC->GetHitResultUnderCursorForObjects(HoverObjectTypes, false, HitResult);
+		bHit = TraceObjectsAt(CursorPosition, HitResult);
 
 		// Fallback to SelectionTrace channel if object query fails
 		if (!bHit)
 		{
-			bHit = OwnerPC->GetHitResultUnderCursor(ECC_GameTraceChannel1, false, HitResult);
+			bHit = TraceChannelAt(CursorPosition, ECC_GameTraceChannel1, HitResult);
 		}
 	}
 	else
 	{
 		// No object types configured - try channels directly
-		bHit = OwnerPC->GetHitResultUnderCursor(ECC_GameTraceChannel1, false, HitResult);
+		bHit = TraceChannelAt(CursorPosition, ECC_GameTraceChannel1, HitResult);
 		if (!bHit)
 		{
-			bHit = OwnerPC->GetHitResultUnderCursor(ECC_GameTraceChannel2, false, HitResult);
+			bHit = TraceChannelAt(CursorPosition, ECC_GameTraceChannel2, HitResult);
 		}
 		if (!bHit)
 		{
-			bHit = OwnerPC->GetHitResultUnderCursor(ECC_Visibility, false, HitResult);
+			bHit = TraceChannelAt(CursorPosition, ECC_Visibility, HitResult);
 		}
 	}
 
-	if (bHit)
+	// No hit (or no selection plane on the hit actor) clears the hover
+	ApplyHover(bHit ? ResolveHitPlane(HitResult) : nullptr);
+}
+
+bool UPACS_HoverProbeComponent::TraceObjectsAt(const FVector2D& CursorPosition, FHitResult& OutHit)
+{
+	++TraceCount;
+
+	if (!OwnerPC.IsValid() || HoverObjectTypes.Num() == 0)
+	{
+		return false;
+	}
+
+	return OwnerPC->GetHitResultAtScreenPosition(CursorPosition, HoverObjectTypes, false, OutHit);
+}
+
+bool UPACS_HoverProbeComponent::TraceChannelAt(const FVector2D& CursorPosition, ECollisionChannel Channel, FHitResult& OutHit)
+{
+	++TraceCount;
+
+	if (!OwnerPC.IsValid())
+	{
+		return false;
+	}
+
+	return OwnerPC->GetHitResultAtScreenPosition(CursorPosition, Channel, false, OutHit);
+}
+
+void UPACS_HoverProbeComponent::RebuildScreenBucket(const FVector& ViewLocation, const FRotator& ViewRotation)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PACSHover_RebuildBucket);
+
+	ScreenBucket.Reset(GFrameCounter);
+
+	APACS_PlayerController* PC = OwnerPC.Get();
+	UWorld* World = GetWorld();
+	if (!PC || !World)
+	{
+		return;
+	}
+
+	UPACS_SelectableRegistrySubsystem* Registry = World->GetSubsystem<UPACS_SelectableRegistrySubsystem>();
+	if (!Registry)
 	{
-		AActor* HitActor = HitResult.GetActor();
+		return;
+	}
+
+	// Project each selectable's bounding sphere: centre plus one radius along the view's up axis
+	const FVector ViewUp = ViewRotation.Quaternion().GetUpVector();
 
-		// Try to get SelectionPlaneComponent from the hit actor
-		UPACS_SelectionPlaneComponent* HitPlaneComponent = nullptr;
-		if (HitActor)
+	for (const TWeakObjectPtr<UPACS_SelectionPlaneComponent>& WeakPlane : Registry->GetSelectables())
+	{
+		UPACS_SelectionPlaneComponent* Plane = WeakPlane.Get();
+		AActor* Owner = Plane ? Plane->GetOwner() : nullptr;
+		if (!Owner || Owner->IsHidden())
 		{
-			// Check if this is a poolable actor (all NPCs implement this interface)
-			if (HitActor->Implements<UPACS_Poolable>())
-			{
-				// Find the SelectionPlaneComponent on the actor
-				HitPlaneComponent = HitActor->FindComponentByClass<UPACS_SelectionPlaneComponent>();
-
-				if (HitPlaneComponent)
-				{
-					// Check if NPC is in Available state (SelectionState == 3)
-					// Only Available NPCs can be hovered
-					bool bCanHover = false;
-
-					// Get the current selection state from the component
-					uint8 CurrentSelectionState = HitPlaneComponent->GetSelectionState();
-
-					// Only allow hover if NPC is Available (state 3)
-					if (CurrentSelectionState == 3)
-					{
-						bCanHover = true;
-					}
-
-					if (!bCanHover)
-					{
-						// Don't set this as hit plane if we can't hover
-						HitPlaneComponent = nullptr;
-					}
-				}
-			}
+			continue;
+		}
+
+		const USceneComponent* BoundsSource = Plane->GetSelectionPlane();
+		if (!BoundsSource)
+		{
+			BoundsSource = Owner->GetRootComponent();
+		}
+		if (!BoundsSource)
+		{
+			continue;
 		}
 
-		UPACS_SelectionPlaneComponent* CurrentPlaneComponent = CurrentHoverPlaneComponent.Get();
+		const FBoxSphereBounds& Bounds = BoundsSource->Bounds;
 
-		// Update hover state if component changed
-		if (HitPlaneComponent != CurrentPlaneComponent)
+		FVector2D ScreenCenter;
+		FVector2D ScreenEdge;
+		if (!PC->ProjectWorldLocationToScreen(Bounds.Origin, ScreenCenter)
+			|| !PC->ProjectWorldLocationToScreen(Bounds.Origin + ViewUp * Bounds.SphereRadius, ScreenEdge))
 		{
-			ClearHover();
+			continue; // Behind the camera
+		}
+
+		const float ScreenRadius = FVector2D::Distance(ScreenCenter, ScreenEdge) + ScreenBoundsPaddingPx;
+		ScreenBucket.Add(
+			FBox2D(ScreenCenter - FVector2D(ScreenRadius), ScreenCenter + FVector2D(ScreenRadius)),
+			FVector::Dist(ViewLocation, Bounds.Origin),
+			Plane);
+	}
+}
 
-			if (HitPlaneComponent)
+UPACS_SelectionPlaneComponent* UPACS_HoverProbeComponent::ResolveHitPlane(const FHitResult& HitResult)
+{
+	// Instanced selection planes are owned by the manager's host actor; map the instance back
+	if (const UWorld* World = GetWorld())
+	{
+		if (const UPACS_SelectionPlaneManager* PlaneManager = World->GetSubsystem<UPACS_SelectionPlaneManager>())
+		{
+			if (UPACS_SelectionPlaneComponent* InstancedPlane = PlaneManager->ResolveHitPlane(HitResult))
 			{
-				CurrentHoverActor = HitActor;
-				CurrentHoverPlaneComponent = HitPlaneComponent;
+				return InstancedPlane;
+			}
+		}
+	}
 
-				// Activate hover visuals on the selection plane
-				HitPlaneComponent->SetHoverState(true);
+	return FindPlaneComponent(HitResult.GetActor());
+}
+
+UPACS_SelectionPlaneComponent* UPACS_HoverProbeComponent::FindPlaneComponent(AActor* Actor)
+{
+	// Only poolable actors (all NPCs implement this interface) carry selection planes
+	if (!Actor || !Actor->Implements<UPACS_Poolable>())
+	{
+		return nullptr;
+	}
+
+	if (const TWeakObjectPtr<UPACS_SelectionPlaneComponent>* Cached = PlaneComponentCache.Find(Actor))
+	{
+		return Cached->Get();
+	}
+
+	// Drop entries for destroyed actors before the cache grows unbounded
+	if (PlaneComponentCache.Num() >= 256)
+	{
+		for (auto It = PlaneComponentCache.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().IsValid())
+			{
+				It.RemoveCurrent();
 			}
 		}
 	}
-	else
+
+	UPACS_SelectionPlaneComponent* PlaneComponent = Actor->FindComponentByClass<UPACS_SelectionPlaneComponent>();
+	PlaneComponentCache.Add(Actor, PlaneComponent);
+	return PlaneComponent;
+}
+
+void UPACS_HoverProbeComponent::ApplyHover(UPACS_SelectionPlaneComponent* PlaneComponent)
+{
+	// Only Available NPCs (SelectionState == 3) can be hovered
+	if (PlaneComponent && PlaneComponent->GetSelectionState() != 3)
 	{
-		// No hit - clear hover
-		ClearHover();
+		PlaneComponent = nullptr;
+	}
+
+	// Update hover state only if component changed
+	if (PlaneComponent == CurrentHoverPlaneComponent.Get())
+	{
+		return;
+	}
+
+	ClearHover();
+
+	if (PlaneComponent)
+	{
+		CurrentHoverActor = PlaneComponent->GetOwner();
+		CurrentHoverPlaneComponent = PlaneComponent;
+
+		// Activate hover visuals on the selection plane
+		PlaneComponent->SetHoverState(true);
 	}
 }
 
@@ -1,5 +1,5 @@
 #include "Components/PACS_InputHandlerComponent.h"
-#include "Core/PACS_PlayerController.h"
+#include "Data/PACS_InputActionIds.h"
 
 #if !UE_SERVER
 #include "EnhancedInputSubsystems.h"
@@ -10,6 +10,8 @@
 #include "GameFramework/PlayerController.h"
 #include "Engine/LocalPlayer.h"
 #include "Engine/World.h"
+#include "Engine/AssetManager.h"
+#include "Misc/CoreDelegates.h"
 #endif
 
 DEFINE_LOG_CATEGORY(LogPACSInput);
@@ -24,7 +26,17 @@ void UPACS_InputHandlerComponent::BeginPlay()
 {
     Super::BeginPlay();
 #if !UE_SERVER
-    Initialize();
+    APlayerController* PC = Cast<APlayerController>(GetOwner());
+    if (!PC)
+    {
+        PACS_INPUT_WARNING("InputHandler: Not attached to PlayerController");
+        return;
+    }
+
+    PawnChangedHandle = PC->GetOnNewPawnNotifier().AddUObject(this, &ThisClass::HandlePawnChanged);
+
+    // Ready already (e.g. spawned after the player was received), otherwise the events will get here
+    TryInitialize();
 #endif
 }
 
@@ -38,95 +50,122 @@ void UPACS_InputHandlerComponent::EndPlay(const EEndPlayReason::Type EndPlayReas
 
 #if !UE_SERVER
 
-void UPACS_InputHandlerComponent::Initialize()
+void UPACS_InputHandlerComponent::TryInitialize()
 {
-    const APlayerController* PC = Cast<APlayerController>(GetOwner());
-    if (!PC)
+    if (bIsInitialized || !EnsureGameThread())
     {
-        PACS_INPUT_WARNING("InputHandler: Not attached to PlayerController");
         return;
     }
-    
-    // Epic's pattern: Retry local controller check with timeout
-    if (!PC->IsLocalController())
+
+    if (!InputConfig)
     {
-        // Avoid infinite retries on dedicated servers - remote controllers will never be local
-        if (LocalControllerRetryCount >= MaxLocalControllerRetries)
+        // Resolves in place if already in memory; otherwise the load completion calls back in here
+        RequestInputConfig();
+        if (!InputConfig)
         {
-            PACS_INPUT_WARNING("InputHandler: Controller not local after %d retries - likely remote controller", 
-                MaxLocalControllerRetries);
             return;
         }
-        
-        // Retry with exponential backoff pattern similar to Epic's subsystem handling
-        LocalControllerRetryCount++;
-        const float RetryDelay = LocalControllerRetryCount <= 10 ? 0.1f : 0.2f; // Fast retries initially, then slower
-        
-        if (UWorld* World = PC->GetWorld())
-        {
-            World->GetTimerManager().SetTimer(InitRetryHandle, 
-                this, &ThisClass::Initialize, RetryDelay, false);
-        }
-        
-        PACS_INPUT_VERBOSE("InputHandler: Controller not local yet, retry %d/%d in %.1fs", 
-            LocalControllerRetryCount, MaxLocalControllerRetries, RetryDelay);
+    }
+
+    if (!IsLocalPlayerReady())
+    {
+        PACS_INPUT_VERBOSE("InputHandler: Waiting for local player");
         return;
     }
-    
-    // Reset retry counter on successful local controller validation
-    LocalControllerRetryCount = 0;
 
-    if (!ValidateConfig())
+    Initialize();
+}
+
+bool UPACS_InputHandlerComponent::IsLocalPlayerReady() const
+{
+    const APlayerController* PC = Cast<APlayerController>(GetOwner());
+    if (!PC || !PC->IsLocalController())
+    {
+        return false;
+    }
+
+    const ULocalPlayer* LP = PC->GetLocalPlayer();
+    return LP && LP->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>();
+}
+
+void UPACS_InputHandlerComponent::RequestInputConfig()
+{
+    if (InputConfig || ConfigLoadHandle.IsValid())
     {
-        PACS_INPUT_ERROR("InputHandler: Invalid configuration!");
         return;
     }
 
-    // Epic's pattern: Defer initialization until subsystem is ready
-    if (const ULocalPlayer* LP = PC->GetLocalPlayer())
+    if (InputConfigAsset.IsNull())
     {
-        UEnhancedInputLocalPlayerSubsystem* Subsystem = LP->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>();
-        if (!Subsystem)
-        {
-            // Retry on next tick - Epic's pattern
-            if (UWorld* World = PC->GetWorld())
-            {
-                World->GetTimerManager().SetTimerForNextTick(this, &ThisClass::Initialize);
-            }
-            return;
-        }
+        PACS_INPUT_ERROR("InputHandler: Neither InputConfig nor InputConfigAsset is set");
+        return;
+    }
 
-        // Epic's additional validation - check if subsystem is fully initialized
-        if (!Subsystem->IsValidLowLevel() )
-        {
-            if (UWorld* World = PC->GetWorld())
-            {
-                World->GetTimerManager().SetTimer(InitRetryHandle, 
-                    this, &ThisClass::Initialize, 0.1f, false);
-            }
-            return;
-        }
+    if (UPACS_InputMappingConfig* Loaded = InputConfigAsset.Get())
+    {
+        InputConfig = Loaded;
+        return;
+    }
 
-        CachedSubsystem = Subsystem;
-        bSubsystemValid = true;
+    ConfigLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        InputConfigAsset.ToSoftObjectPath(),
+        FStreamableDelegate::CreateUObject(this, &ThisClass::HandleInputConfigLoaded));
+}
+
+void UPACS_InputHandlerComponent::HandleInputConfigLoaded()
+{
+    InputConfig = InputConfigAsset.Get();
+    if (!InputConfig)
+    {
+        PACS_INPUT_ERROR("InputHandler: Failed to load %s", *InputConfigAsset.ToString());
+        return;
     }
-    else
+
+    TryInitialize();
+}
+
+void UPACS_InputHandlerComponent::HandlePawnChanged(APawn* NewPawn)
+{
+    if (!bIsInitialized)
     {
-        // LocalPlayer not ready, retry
-        if (UWorld* World = PC->GetWorld())
-        {
-            World->GetTimerManager().SetTimerForNextTick(this, &ThisClass::Initialize);
-        }
+        TryInitialize();
+        return;
+    }
+
+    if (NewPawn)
+    {
+        UpdateManagedContexts();
+    }
+}
+
+void UPACS_InputHandlerComponent::NotifyLocalPlayerReady()
+{
+    TryInitialize();
+}
+
+void UPACS_InputHandlerComponent::Initialize()
+{
+    if (!ValidateConfig())
+    {
+        PACS_INPUT_ERROR("InputHandler: Invalid configuration!");
         return;
     }
 
+    // Cached before anything calls GetValidSubsystem so it does not re-announce availability
+    const APlayerController* PC = Cast<APlayerController>(GetOwner());
+    if (const ULocalPlayer* LP = PC ? PC->GetLocalPlayer() : nullptr)
+    {
+        CachedSubsystem = LP->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>();
+        bSubsystemValid = CachedSubsystem.IsValid();
+    }
+
     BuildActionNameMap();
     
     PACS_INPUT_LOG("ActionNameMap built with %d entries", ActionToNameMap.Num());
     
     if (UEnhancedInputLocalPlayerSubsystem* Subsystem = GetValidSubsystem())
     {
-        if (PC->GetPawn() && PC->GetPawn()->InputComponent)
+        if (PC && PC->GetPawn() && PC->GetPawn()->InputComponent)
         {
             Subsystem->ClearAllMappings();
             PACS_INPUT_LOG("Cleared all input mappings");
@@ -137,37 +176,45 @@ void UPACS_InputHandlerComponent::Initialize()
     PACS_INPUT_LOG("Handler marked as initialized (bIsInitialized = true)");
     SetBaseContext(EPACS_InputContextMode::Gameplay);
     
-    // Epic's pattern: Notify owner (PlayerController) to rebind actions after initialization
-    if (APlayerController* OwnerPC = Cast<APlayerController>(GetOwner()))
-    {
-        if (OwnerPC->IsLocalController() && OwnerPC->InputComponent)
-        {
-            // Trigger rebinding of input actions now that we're initialized
-            if (APACS_PlayerController* PACSPC = Cast<APACS_PlayerController>(OwnerPC))
-            {
-                PACSPC->BindInputActions();
-            }
-        }
-    }
+    // Owner (PlayerController) binds its actions from here
+    OnInputReady.Broadcast(this);
     
     PACS_INPUT_LOG("InputHandler initialized successfully");
 }
 
 void UPACS_InputHandlerComponent::Shutdown()
 {
+    if (ConfigLoadHandle.IsValid())
+    {
+        ConfigLoadHandle->CancelHandle();
+        ConfigLoadHandle.Reset();
+    }
+
+    if (APlayerController* PC = Cast<APlayerController>(GetOwner()))
+    {
+        PC->GetOnNewPawnNotifier().Remove(PawnChangedHandle);
+    }
+    PawnChangedHandle.Reset();
+
+    FCoreDelegates::OnEndFrame.Remove(ContextFlushHandle);
+    ContextFlushHandle.Reset();
+
     if (!bIsInitialized) return;
 
     RemoveAllManagedContexts();
 
     Receivers.Empty();
+    RebuildDispatchTable();
     OverlayStack.Empty();
     ActionToNameMap.Empty();
+    ActionToIdMap.Empty();
+    BlockedById.Empty();
+    bActionMapBuilt = false;
     ManagedContexts.Empty();
     CachedSubsystem.Reset();
     
     bIsInitialized = false;
     bSubsystemValid = false;
-    LocalControllerRetryCount = 0;
 
     PACS_INPUT_LOG("InputHandler shutdown complete");
 }
@@ -242,6 +289,8 @@ void UPACS_InputHandlerComponent::BuildActionNameMap()
     
     ActionToNameMap.Reset();
     ActionToNameMap.Reserve(InputConfig->ActionMappings.Num());
+    ActionToIdMap.Reset();
+    ActionToIdMap.Reserve(InputConfig->ActionMappings.Num());
 
     for (const FPACS_InputActionMapping& Mapping : InputConfig->ActionMappings)
     {
@@ -259,12 +308,28 @@ void UPACS_InputHandlerComponent::BuildActionNameMap()
             continue;
         }
 
+        const uint16 ActionId = FPACS_InputActionRegistry::FindOrAdd(Mapping.ActionIdentifier);
         ActionToNameMap.Add(Mapping.InputAction, Mapping.ActionIdentifier);
-        PACS_INPUT_VERBOSE("Mapped action '%s' -> '%s'", 
+        ActionToIdMap.Add(Mapping.InputAction, ActionId);
+        PACS_INPUT_VERBOSE("Mapped action '%s' -> '%s' (id %d)", 
             *Mapping.InputAction->GetName(), 
-            *Mapping.ActionIdentifier.ToString());
+            *Mapping.ActionIdentifier.ToString(), ActionId);
+    }
+
+    BlockedById.Init(false, FPACS_InputActionRegistry::GetTableSize());
+    for (const FName& Blocked : InputConfig->UIBlockedActions)
+    {
+        const uint16 BlockedId = FPACS_InputActionRegistry::FindOrAdd(Blocked);
+        if (BlockedId >= BlockedById.Num())
+        {
+            BlockedById.Add(false, BlockedId + 1 - BlockedById.Num());
+        }
+        BlockedById[BlockedId] = true;
     }
 
+    // New IDs may have been assigned above
+    RebuildDispatchTable();
+
     bActionMapBuilt = true;
 }
 
@@ -308,6 +373,11 @@ UEnhancedInputLocalPlayerSubsystem* UPACS_InputHandlerComponent::GetValidSubsyst
 void UPACS_InputHandlerComponent::OnSubsystemAvailable()
 {
     PACS_INPUT_LOG("Enhanced Input Subsystem became available");
+    if (!bIsInitialized)
+    {
+        TryInitialize();
+        return;
+    }
     UpdateManagedContexts();
 }
 
@@ -315,6 +385,9 @@ void UPACS_InputHandlerComponent::OnSubsystemUnavailable()
 {
     PACS_INPUT_WARNING("Enhanced Input Subsystem became unavailable");
     bSubsystemValid = false;
+
+    // Nothing is known to be applied any more; the next update re-adds everything
+    ManagedContexts.Reset();
 }
 
 void UPACS_InputHandlerComponent::RegisterReceiver(UObject* Receiver, int32 Priority)
@@ -354,12 +427,14 @@ void UPACS_InputHandlerComponent::RegisterReceiver(UObject* Receiver, int32 Prio
     Entry.ReceiverObject = Receiver;
     Entry.Priority = Priority;
     Entry.RegistrationOrder = ++RegistrationCounter;
+    Entry.GetInterface()->GetSubscribedActions(Entry.SubscribedActions);
     
     Receivers.Add(Entry);
     SortReceivers();
+    RebuildDispatchTable();
 
-    PACS_INPUT_VERBOSE("Registered receiver %s (Priority: %d)", 
-        *Receiver->GetName(), Priority);
+    PACS_INPUT_VERBOSE("Registered receiver %s (Priority: %d, Actions: %d)", 
+        *Receiver->GetName(), Priority, Entry.SubscribedActions.Num());
 }
 
 void UPACS_InputHandlerComponent::UnregisterReceiver(UObject* Receiver)
@@ -373,6 +448,7 @@ void UPACS_InputHandlerComponent::UnregisterReceiver(UObject* Receiver)
 
     if (RemovedCount > 0)
     {
+        RebuildDispatchTable();
         PACS_INPUT_VERBOSE("Unregistered receiver %s", 
             Receiver ? *Receiver->GetName() : TEXT("NULL"));
     }
@@ -401,7 +477,7 @@ void UPACS_InputHandlerComponent::HandleAction(const FInputActionInstance& Insta
         return;
     }
 
-    PACS_INPUT_LOG("HandleAction received: %s (ActionMap has %d entries)", 
+    PACS_INPUT_HOT("HandleAction received: %s (ActionMap has %d entries)", 
         *Action->GetName(), ActionToNameMap.Num());
 
     const FName* ActionNamePtr = ActionToNameMap.Find(Action);
@@ -418,25 +494,68 @@ void UPACS_InputHandlerComponent::HandleAction(const FInputActionInstance& Insta
         return;
     }
 
-    PACS_INPUT_LOG("Routing action %s (mapped to %s)", *Action->GetName(), *ActionNamePtr->ToString());
-    RouteActionInternal(*ActionNamePtr, Instance.GetValue());
+    PACS_INPUT_HOT("Routing action %s (mapped to %s)", *Action->GetName(), *ActionNamePtr->ToString());
+    RouteActionInternal(ActionToIdMap.FindRef(Action), *ActionNamePtr, Instance.GetValue());
+}
+
+void UPACS_InputHandlerComponent::HandleActionById(const FInputActionInstance& Instance, uint16 ActionId)
+{
+    if (!EnsureGameThread() || !bIsInitialized)
+    {
+        return;
+    }
+
+    if (ActionId == FPACS_InputActionRegistry::InvalidId)
+    {
+        // Bound before the action map could resolve it; fall back to the lookup
+        HandleAction(Instance);
+        return;
+    }
+
+    PACS_INPUT_VERBOSE("HandleActionById: %d", ActionId);
+    RouteActionInternal(ActionId, FPACS_InputActionRegistry::GetName(ActionId), Instance.GetValue());
+}
+
+uint16 UPACS_InputHandlerComponent::ResolveActionId(const UInputAction* Action)
+{
+    EnsureActionMapBuilt();
+    return ActionToIdMap.FindRef(Action);
+}
+
+bool UPACS_InputHandlerComponent::IsActionBlocked(uint16 ActionId, FName ActionName) const
+{
+    if (!InputConfig || !HasBlockingOverlay())
+    {
+        return false;
+    }
+
+    if (ActionId != FPACS_InputActionRegistry::InvalidId && BlockedById.IsValidIndex(ActionId))
+    {
+        return BlockedById[ActionId];
+    }
+
+    // Not in the table: the config was never resolved, or the ID postdates it
+    return InputConfig->UIBlockedActions.Contains(ActionName);
 }
 
 EPACS_InputHandleResult UPACS_InputHandlerComponent::RouteActionInternal(
+    uint16 ActionId,
     FName ActionName, 
     const FInputActionValue& Value)
 {
-    PACS_INPUT_LOG("RouteActionInternal: %s (Receivers: %d)", *ActionName.ToString(), Receivers.Num());
+    const TArray<int32>& Dispatch = GetDispatchList(ActionId);
+    PACS_INPUT_HOT("RouteActionInternal: %s (Receivers: %d)", *ActionName.ToString(), Dispatch.Num());
     
-    if (HasBlockingOverlay() && InputConfig->UIBlockedActions.Contains(ActionName))
+    if (IsActionBlocked(ActionId, ActionName))
     {
-        PACS_INPUT_LOG("Action '%s' blocked by overlay", *ActionName.ToString());
+        PACS_INPUT_HOT("Action '%s' blocked by overlay", *ActionName.ToString());
         return EPACS_InputHandleResult::HandledConsume;
     }
 
-    for (int32 i = 0; i < Receivers.Num(); ++i)
+    const uint32 Version = DispatchVersion;
+    for (int32 i = 0; i < Dispatch.Num(); ++i)
     {
-        FPACS_InputReceiverEntry& Entry = Receivers[i];
+        FPACS_InputReceiverEntry& Entry = Receivers[Dispatch[i]];
         
         if (!Entry.IsValid())
         {
@@ -445,7 +564,7 @@ EPACS_InputHandleResult UPACS_InputHandlerComponent::RouteActionInternal(
         }
 
         IPACS_InputReceiver* Receiver = Entry.GetInterface();
-        const EPACS_InputHandleResult Result = Receiver->HandleInputAction(ActionName, Value);
+        const EPACS_InputHandleResult Result = Receiver->HandleInputActionId(ActionId, ActionName, Value);
         
         if (Result == EPACS_InputHandleResult::HandledConsume)
         {
@@ -455,6 +574,13 @@ EPACS_InputHandleResult UPACS_InputHandlerComponent::RouteActionInternal(
             }
             return Result;
         }
+
+        // The receiver registered or unregistered someone: Dispatch was rebuilt, stop walking it
+        if (DispatchVersion != Version)
+        {
+            PACS_INPUT_VERBOSE("Receivers changed while routing '%s'", *ActionName.ToString());
+            break;
+        }
     }
 
     if (InvalidReceiverCount > PACS_InputLimits::InvalidReceiverCleanupThreshold)
@@ -476,6 +602,7 @@ void UPACS_InputHandlerComponent::CleanInvalidReceivers()
     const int32 RemovedCount = OldCount - Receivers.Num();
     if (RemovedCount > 0)
     {
+        RebuildDispatchTable();
         PACS_INPUT_LOG("Cleaned %d invalid receivers", RemovedCount);
     }
     
@@ -487,6 +614,77 @@ void UPACS_InputHandlerComponent::SortReceivers()
     Receivers.Sort();
 }
 
+void UPACS_InputHandlerComponent::RebuildDispatchTable()
+{
+    ++DispatchVersion;
+    WildcardDispatch.Reset();
+
+    // Make sure every subscribed identifier has an ID before sizing the table
+    for (const FPACS_InputReceiverEntry& Entry : Receivers)
+    {
+        for (const FName& Action : Entry.SubscribedActions)
+        {
+            FPACS_InputActionRegistry::FindOrAdd(Action);
+        }
+    }
+
+    const int32 TableSize = FPACS_InputActionRegistry::GetTableSize();
+    DispatchById.SetNum(TableSize);
+    for (TArray<int32>& List : DispatchById)
+    {
+        List.Reset();
+    }
+
+    // Receivers is priority sorted, so appending in order keeps every list sorted
+    for (int32 Index = 0; Index < Receivers.Num(); ++Index)
+    {
+        const FPACS_InputReceiverEntry& Entry = Receivers[Index];
+        if (Entry.SubscribedActions.Num() == 0)
+        {
+            WildcardDispatch.Add(Index);
+            for (TArray<int32>& List : DispatchById)
+            {
+                List.Add(Index);
+            }
+            continue;
+        }
+
+        for (const FName& Action : Entry.SubscribedActions)
+        {
+            if (Action.IsNone()) continue;
+
+            TArray<int32>& List = DispatchById[FPACS_InputActionRegistry::Find(Action)];
+            if (List.Num() == 0 || List.Last() != Index)
+            {
+                List.Add(Index);
+            }
+        }
+    }
+}
+
+const TArray<int32>& UPACS_InputHandlerComponent::GetDispatchList(uint16 ActionId) const
+{
+    // ID 0 (unknown identifier) only ever holds wildcard receivers
+    return DispatchById.IsValidIndex(ActionId) ? DispatchById[ActionId] : WildcardDispatch;
+}
+
+int32 UPACS_InputHandlerComponent::GetDispatchReceiverCount(FName ActionName) const
+{
+    return GetDispatchList(FPACS_InputActionRegistry::Find(ActionName)).Num();
+}
+
+EPACS_InputHandleResult UPACS_InputHandlerComponent::DispatchAction(FName ActionName, const FInputActionValue& Value)
+{
+    if (!EnsureGameThread()) return EPACS_InputHandleResult::NotHandled;
+    return RouteActionInternal(FPACS_InputActionRegistry::Find(ActionName), ActionName, Value);
+}
+
+EPACS_InputHandleResult UPACS_InputHandlerComponent::DispatchActionId(uint16 ActionId, const FInputActionValue& Value)
+{
+    if (!EnsureGameThread()) return EPACS_InputHandleResult::NotHandled;
+    return RouteActionInternal(ActionId, FPACS_InputActionRegistry::GetName(ActionId), Value);
+}
+
 void UPACS_InputHandlerComponent::SetBaseContext(EPACS_InputContextMode ContextMode)
 {
     if (!EnsureGameThread()) return;
@@ -548,7 +746,7 @@ void UPACS_InputHandlerComponent::PushOverlay(UInputMappingContext* Context,
     NewEntry.Priority = Priority;
     
     OverlayStack.Add(NewEntry);
-    UpdateManagedContexts();
+    RequestContextUpdate();
     
     PACS_INPUT_LOG("Pushed %s overlay: %s (Stack depth: %d)", 
         Type == EPACS_OverlayType::Blocking ? TEXT("blocking") : TEXT("non-blocking"),
@@ -561,7 +759,7 @@ void UPACS_InputHandlerComponent::PopOverlay()
     if (!bIsInitialized || OverlayStack.Num() == 0) return;
 
     FPACS_OverlayEntry Popped = OverlayStack.Pop();
-    UpdateManagedContexts();
+    RequestContextUpdate();
     
     PACS_INPUT_LOG("Popped overlay: %s (Stack depth: %d)", 
         Popped.Context ? *Popped.Context->GetName() : TEXT("NULL"), 
@@ -575,7 +773,7 @@ void UPACS_InputHandlerComponent::PopAllOverlays()
 
     const int32 Count = OverlayStack.Num();
     OverlayStack.Empty();
-    UpdateManagedContexts();
+    RequestContextUpdate();
     
     PACS_INPUT_LOG("Cleared %d overlays", Count);
 }
@@ -593,25 +791,35 @@ bool UPACS_InputHandlerComponent::HasBlockingOverlay() const
     return false;
 }
 
-void UPACS_InputHandlerComponent::UpdateManagedContexts()
+void UPACS_InputHandlerComponent::RequestContextUpdate()
 {
-    UEnhancedInputLocalPlayerSubsystem* Subsystem = GetValidSubsystem();
-    if (!Subsystem)
+    if (!ContextFlushHandle.IsValid())
     {
-        PACS_INPUT_WARNING("Cannot update contexts - subsystem unavailable");
-        return;
+        ContextFlushHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &ThisClass::FlushContextChanges);
     }
+}
 
-    RemoveAllManagedContexts();
-    ManagedContexts.Empty();
+void UPACS_InputHandlerComponent::FlushContextChanges()
+{
+    if (ContextFlushHandle.IsValid())
+    {
+        UpdateManagedContexts();
+    }
+}
+
+void UPACS_InputHandlerComponent::UpdateManagedContexts()
+{
+    // Anything queued for end of frame is covered by this update
+    if (ContextFlushHandle.IsValid())
+    {
+        FCoreDelegates::OnEndFrame.Remove(ContextFlushHandle);
+        ContextFlushHandle.Reset();
+    }
 
+    TMap<TObjectPtr<UInputMappingContext>, int32> Desired;
     if (UInputMappingContext* BaseContext = GetBaseContext(CurrentBaseMode))
     {
-        const int32 Priority = GetBaseContextPriority(CurrentBaseMode);
-        Subsystem->AddMappingContext(BaseContext, Priority);
-        ManagedContexts.Add(BaseContext);
-        PACS_INPUT_LOG("Added base context: %s with priority %d", 
-            *BaseContext->GetName(), Priority);
+        Desired.Add(BaseContext, GetBaseContextPriority(CurrentBaseMode));
     }
     else
     {
@@ -622,14 +830,52 @@ void UPACS_InputHandlerComponent::UpdateManagedContexts()
     {
         if (Entry.Context)
         {
-            Subsystem->AddMappingContext(Entry.Context, Entry.Priority);
-            ManagedContexts.Add(Entry.Context);
-            PACS_INPUT_LOG("Added overlay context: %s with priority %d", 
-                *Entry.Context->GetName(), Entry.Priority);
+            Desired.Add(Entry.Context, Entry.Priority);
         }
     }
+
+    const FPACS_InputContextDiff Diff = FPACS_InputContextDiff::Compute(ManagedContexts, Desired);
+    if (Diff.IsEmpty())
+    {
+        return;
+    }
+
+    if (!ApplyContextDiff(Diff))
+    {
+        PACS_INPUT_WARNING("Cannot update contexts - subsystem unavailable");
+        return;
+    }
+
+    ManagedContexts = MoveTemp(Desired);
+    ++ContextRebuildRequests;
     
-    PACS_INPUT_LOG("Updated managed contexts (Count: %d)", ManagedContexts.Num());
+    PACS_INPUT_LOG("Updated managed contexts (Count: %d, removed %d, added %d)", 
+        ManagedContexts.Num(), Diff.Removes.Num(), Diff.Adds.Num());
+}
+
+bool UPACS_InputHandlerComponent::ApplyContextDiff(const FPACS_InputContextDiff& Diff)
+{
+    UEnhancedInputLocalPlayerSubsystem* Subsystem = GetValidSubsystem();
+    if (!Subsystem)
+    {
+        return false;
+    }
+
+    // Not forced: the subsystem rebuilds the control mappings once for the whole diff
+    FModifyContextOptions Options;
+    Options.bForceImmediately = false;
+
+    for (UInputMappingContext* Context : Diff.Removes)
+    {
+        Subsystem->RemoveMappingContext(Context, Options);
+    }
+
+    for (const TPair<UInputMappingContext*, int32>& Add : Diff.Adds)
+    {
+        Subsystem->AddMappingContext(Add.Key, Add.Value, Options);
+    }
+
+    return true;
 }
 
 void UPACS_InputHandlerComponent::RemoveAllManagedContexts()
@@ -637,11 +883,11 @@ void UPACS_InputHandlerComponent::RemoveAllManagedContexts()
     UEnhancedInputLocalPlayerSubsystem* Subsystem = GetValidSubsystem();
     if (!Subsystem) return;
 
-    for (TObjectPtr<UInputMappingContext> Context : ManagedContexts)
+    for (const TPair<TObjectPtr<UInputMappingContext>, int32>& Pair : ManagedContexts)
     {
-        if (Context)
+        if (Pair.Key)
         {
-            Subsystem->RemoveMappingContext(Context);
+            Subsystem->RemoveMappingContext(Pair.Key);
         }
     }
 }
@@ -73,10 +73,10 @@ void UPACS_NPCBehaviorComponent::EndPlay(const EEndPlayReason::Type EndPlayReaso
 // IPACS_InputReceiver Interface
 // ========================================
 
-EPACS_InputHandleResult UPACS_NPCBehaviorComponent::HandleInputAction(FName ActionName, const FInputActionValue& Value)
+EPACS_InputHandleResult UPACS_NPCBehaviorComponent::HandleInputActionId(uint16 ActionId, FName ActionName, const FInputActionValue& Value)
 {
 	// Handle right-click for movement commands
-	if (ActionName == TEXT("RightClick"))
+	if (ActionId == PACS_InputActions::RightClick)
 	{
 		return HandleRightClick(Value);
 	}
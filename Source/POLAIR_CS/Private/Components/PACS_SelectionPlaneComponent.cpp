@@ -14,6 +14,10 @@
 #include "Data/PACS_SelectionProfile.h"
 #include "Actors/NPC/PACS_NPC_Base.h"
 #include "Interfaces/PACS_SelectableCharacterInterface.h"
+#include "Subsystems/PACS_SelectableRegistrySubsystem.h"
+#include "Subsystems/PACS_SelectionPlaneManager.h"
+#include "Settings/PACS_NetPerfSettings.h"
+#include "Data/Settings/PACS_CustomSignificanceManager.h"
 
 UPACS_SelectionPlaneComponent::UPACS_SelectionPlaneComponent()
 {
@@ -39,11 +43,43 @@ void UPACS_SelectionPlaneComponent::BeginPlay()
 	if (ShouldShowSelectionVisuals())
 	{
 		InitializeSelectionPlane();
+
+		// Register with the client-side selectable registry (hover bucket, marquee)
+		if (UWorld* World = GetWorld())
+		{
+			if (UPACS_SelectableRegistrySubsystem* Registry = World->GetSubsystem<UPACS_SelectableRegistrySubsystem>())
+			{
+				Registry->Register(this);
+			}
+		}
 	}
 }
 
 void UPACS_SelectionPlaneComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UWorld* World = GetWorld())
+	{
+		if (UPACS_SelectableRegistrySubsystem* Registry = World->GetSubsystem<UPACS_SelectableRegistrySubsystem>())
+		{
+			Registry->Unregister(this);
+		}
+	}
+
+	// Stop the budgeter's significance callbacks before this object can be collected
+	if (UPACS_CustomSignificanceManager* SignificanceManager = UPACS_CustomSignificanceManager::Get(GetWorld()))
+	{
+		SignificanceManager->UnregisterObject(this);
+	}
+
+	// Release the instance on the shared plane manager
+	if (bUseInstancedPlane)
+	{
+		if (UPACS_SelectionPlaneManager* Manager = GetPlaneManager())
+		{
+			Manager->RemovePlane(this);
+		}
+	}
+
 	// Clean up dynamically created selection plane
 	if (SelectionPlane)
 	{
@@ -68,6 +104,16 @@ void UPACS_SelectionPlaneComponent::InitializeSelectionPlane()
 		return;
 	}
 
+	// Instanced path: no per-NPC component, the instance is added once the mesh is known.
+	// Only taken with a material that reads per-instance custom data
+	const UPACS_NetPerfSettings* Settings = UPACS_NetPerfSettings::Get();
+	if (Settings && Settings->bUseInstancedSelectionPlanes && !Settings->InstancedSelectionPlaneMaterial.IsNull() && GetPlaneManager())
+	{
+		bUseInstancedPlane = true;
+		bIsInitialized = true;
+		return;
+	}
+
 	// CREATE selection plane component dynamically (client-only)
 	SelectionPlane = NewObject<UStaticMeshComponent>(Owner, TEXT("SelectionPlaneMesh"), RF_Transient);
 
@@ -135,7 +181,7 @@ void UPACS_SelectionPlaneComponent::SetupSelectionPlane()
 
 void UPACS_SelectionPlaneComponent::ValidateAndApplyAssets()
 {
-	if (!SelectionPlane || bAssetsValidated || !CurrentProfileAsset)
+	if ((!SelectionPlane && !bUseInstancedPlane) || bAssetsValidated || !CurrentProfileAsset)
 	{
 		return;
 	}
@@ -154,10 +200,6 @@ void UPACS_SelectionPlaneComponent::ValidateAndApplyAssets()
 			}
 		}
 
-		if (CachedPlaneMesh)
-		{
-			SelectionPlane->SetStaticMesh(CachedPlaneMesh);
-		}
 	}
 
 	// Validate and apply selection material
@@ -174,12 +216,10 @@ void UPACS_SelectionPlaneComponent::ValidateAndApplyAssets()
 			}
 		}
 
-		if (CachedSelectionMaterial)
-		{
-			SelectionPlane->SetMaterial(0, CachedSelectionMaterial);
-		}
 	}
 
+	ApplyPlaneAssets(CachedPlaneMesh, CachedSelectionMaterial, CachedPlaneRelativeTransform);
+
 	bAssetsValidated = true;
 }
 
@@ -210,7 +250,7 @@ void UPACS_SelectionPlaneComponent::ApplyCachedColorValues(
 	}
 
 	// Update visuals with cached data - force immediate update
-	if (SelectionPlane)
+	if (SelectionPlane || bUseInstancedPlane)
 	{
 		UpdateSelectionPlaneCPD();
 		UpdateVisuals();
@@ -233,33 +273,20 @@ void UPACS_SelectionPlaneComponent::ApplyProfileAsset(UPACS_SelectionProfileAsse
 		return;
 	}
 
-	if (!SelectionPlane)
+	if (!SelectionPlane && !bUseInstancedPlane)
 	{
 		UE_LOG(LogTemp, Error, TEXT("SelectionPlaneComponent: SelectionPlane is NULL for %s"), *GetOwner()->GetName());
 		return;
 	}
 
-	// Apply selection plane mesh (assume pre-loaded by SpawnOrchestrator)
-	if (!ProfileAsset->SelectionStaticMesh.IsNull())
-	{
-		if (UStaticMesh* PlaneMesh = ProfileAsset->SelectionStaticMesh.Get())
-		{
-			SelectionPlane->SetStaticMesh(PlaneMesh);
-			SelectionPlane->SetRelativeTransform(ProfileAsset->SelectionStaticMeshTransform);
-		}
-	}
-
-	// Apply selection material (assume pre-loaded)
-	if (!ProfileAsset->SelectionMaterialInstance.IsNull())
-	{
-		if (UMaterialInterface* Material = ProfileAsset->SelectionMaterialInstance.Get())
-		{
-			SelectionPlane->SetMaterial(0, Material);
-		}
-	}
+	// Apply selection plane mesh and material (assume pre-loaded by SpawnOrchestrator)
+	ApplyPlaneAssets(
+		ProfileAsset->SelectionStaticMesh.Get(),
+		ProfileAsset->SelectionMaterialInstance.Get(),
+		ProfileAsset->SelectionStaticMeshTransform);
 
-	// Apply collision settings from profile
-	if (ProfileAsset->SelectionTraceChannel != ECC_GameTraceChannel1)
+	// Apply collision settings from profile (instanced planes always block SelectionTrace)
+	if (SelectionPlane && ProfileAsset->SelectionTraceChannel != ECC_GameTraceChannel1)
 	{
 		SelectionPlane->SetCollisionResponseToChannel(ProfileAsset->SelectionTraceChannel, ECR_Block);
 	}
@@ -339,7 +366,7 @@ bool UPACS_SelectionPlaneComponent::ShouldShowSelectionVisuals() const
 
 void UPACS_SelectionPlaneComponent::UpdateSelectionPlaneCPD()
 {
-	if (!SelectionPlane)
+	if (!SelectionPlane && !bUseInstancedPlane)
 	{
 		return;
 	}
@@ -418,6 +445,16 @@ void UPACS_SelectionPlaneComponent::UpdateSelectionPlaneCPD()
 	                       Visuals.Color.B == 0.0f && Visuals.Color.A == 0.0f &&
 	                       Visuals.Brightness == 0.0f);
 
+	// Instanced planes carry the same values (plus the display state) in per-instance custom data
+	if (!SelectionPlane)
+	{
+		if (UPACS_SelectionPlaneManager* Manager = GetPlaneManager())
+		{
+			Manager->SetPlaneCustomData(this, Visuals.Color, Visuals.Brightness, DisplayState);
+		}
+		return;
+	}
+
 	// Set CPD values matching material's expected indices
 	// Material expects: CPD[0-2] = RGB, CPD[3] = Brightness, CPD[4] = Alpha
 	SelectionPlane->SetCustomPrimitiveDataFloat(0, Visuals.Color.R);      // R
@@ -429,7 +466,7 @@ void UPACS_SelectionPlaneComponent::UpdateSelectionPlaneCPD()
 
 void UPACS_SelectionPlaneComponent::UpdateVisuals()
 {
-	if (!SelectionPlane)
+	if (!SelectionPlane && !bUseInstancedPlane)
 	{
 		return;
 	}
@@ -437,8 +474,98 @@ void UPACS_SelectionPlaneComponent::UpdateVisuals()
 	// Update CPD (handles VR check internally)
 	UpdateSelectionPlaneCPD();
 
-	// Always keep the plane visible - state appearance controlled by material/CPD
-	SelectionPlane->SetVisibility(true);
+	// Keep the plane visible unless the budgeter culled it - state appearance controlled by material/CPD
+	if (SelectionPlane)
+	{
+		SelectionPlane->SetVisibility(bBudgetVisible);
+	}
+}
+
+void UPACS_SelectionPlaneComponent::ApplyBudget(bool bVisible, float UpdateInterval)
+{
+	const bool bVisibilityChanged = (bBudgetVisible != bVisible);
+	bBudgetVisible = bVisible;
+	BudgetUpdateInterval = UpdateInterval;
+
+	if (bUseInstancedPlane)
+	{
+		if (UPACS_SelectionPlaneManager* Manager = GetPlaneManager())
+		{
+			Manager->SetPlaneUpdateInterval(this, FMath::Max(UpdateInterval, MinUpdateInterval));
+			Manager->SetPlaneVisible(this, bVisible);
+		}
+		return;
+	}
+
+	// Per-NPC mesh path: transforms follow the attachment, so only visibility is budgeted
+	if (SelectionPlane && bVisibilityChanged)
+	{
+		SelectionPlane->SetVisibility(bVisible);
+	}
+}
+
+void UPACS_SelectionPlaneComponent::SetMinUpdateInterval(float Interval)
+{
+	if (MinUpdateInterval == Interval)
+	{
+		return;
+	}
+	MinUpdateInterval = Interval;
+
+	if (bUseInstancedPlane)
+	{
+		if (UPACS_SelectionPlaneManager* Manager = GetPlaneManager())
+		{
+			Manager->SetPlaneUpdateInterval(this, FMath::Max(BudgetUpdateInterval, MinUpdateInterval));
+		}
+	}
+}
+
+void UPACS_SelectionPlaneComponent::ApplyPlaneAssets(UStaticMesh* Mesh, UMaterialInterface* Material, const FTransform& RelativeTransform)
+{
+	if (Mesh)
+	{
+		CachedPlaneMesh = Mesh;
+		CachedPlaneRelativeTransform = RelativeTransform;
+	}
+	if (Material)
+	{
+		CachedSelectionMaterial = Material;
+	}
+
+	if (bUseInstancedPlane)
+	{
+		// Needs a mesh before an instance can exist. The profile material reads CustomPrimitiveData,
+		// so batches draw with the PerInstanceCustomData variant from NetPerf settings instead
+		UPACS_SelectionPlaneManager* Manager = GetPlaneManager();
+		if (Manager && CachedPlaneMesh
+			&& Manager->AddOrUpdatePlane(this, CachedPlaneMesh, Manager->GetInstancedMaterial(), CachedPlaneRelativeTransform))
+		{
+			UpdateSelectionPlaneCPD();
+		}
+		return;
+	}
+
+	if (!SelectionPlane)
+	{
+		return;
+	}
+
+	if (Mesh)
+	{
+		SelectionPlane->SetStaticMesh(Mesh);
+		SelectionPlane->SetRelativeTransform(RelativeTransform);
+	}
+	if (Material)
+	{
+		SelectionPlane->SetMaterial(0, Material);
+	}
+}
+
+UPACS_SelectionPlaneManager* UPACS_SelectionPlaneComponent::GetPlaneManager() const
+{
+	UWorld* World = GetWorld();
+	return World ? World->GetSubsystem<UPACS_SelectionPlaneManager>() : nullptr;
 }
 
 void UPACS_SelectionPlaneComponent::OnRep_SelectionState()
@@ -461,11 +588,17 @@ void UPACS_SelectionPlaneComponent::OnAcquiredFromPool_Implementation()
 
 		// Re-validate assets in case they were cleared
 		bAssetsValidated = false;
-		if (SelectionPlane)
+		if (SelectionPlane || bUseInstancedPlane)
 		{
 			ValidateAndApplyAssets();
 		}
 
+		// Instance was released on pool return; re-add it with the last applied assets
+		if (bUseInstancedPlane && CachedPlaneMesh)
+		{
+			ApplyPlaneAssets(CachedPlaneMesh, CachedSelectionMaterial, CachedPlaneRelativeTransform);
+		}
+
 		// Reset to available state
 		LocalHoverState = 0;
 		UpdateVisuals();
@@ -482,6 +615,15 @@ void UPACS_SelectionPlaneComponent::OnReturnedToPool_Implementation()
 		SelectionPlane->SetVisibility(false);
 		// Don't destroy the component - keep it for reuse
 	}
+
+	// Instanced planes free their instance; it is re-added on acquire
+	if (bUseInstancedPlane)
+	{
+		if (UPACS_SelectionPlaneManager* Manager = GetPlaneManager())
+		{
+			Manager->RemovePlane(this);
+		}
+	}
 }
 
 void UPACS_SelectionPlaneComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
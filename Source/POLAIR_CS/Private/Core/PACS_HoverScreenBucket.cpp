@@ -0,0 +1,83 @@
+#include "Core/PACS_HoverScreenBucket.h"
+#include "Components/PACS_SelectionPlaneComponent.h"
+
+namespace
+{
+	// Above this many cells an entry goes to the linear list instead of being hashed
+	constexpr int32 MaxCellsPerEntry = 64;
+}
+
+void FPACS_HoverScreenBucket::Reset(uint64 InFrameNumber, float InCellSize)
+{
+	Entries.Reset();
+	Cells.Reset();
+	Oversized.Reset();
+
+	CellSize = FMath::Max(InCellSize, 8.0f);
+	BuildFrame = InFrameNumber;
+}
+
+FIntPoint FPACS_HoverScreenBucket::ToCell(const FVector2D& ScreenPoint) const
+{
+	return FIntPoint(FMath::FloorToInt(ScreenPoint.X / CellSize), FMath::FloorToInt(ScreenPoint.Y / CellSize));
+}
+
+void FPACS_HoverScreenBucket::Add(const FBox2D& ScreenRect, float Depth, UPACS_SelectionPlaneComponent* Plane)
+{
+	if (!Plane || !ScreenRect.bIsValid)
+	{
+		return;
+	}
+
+	const int32 Index = Entries.Num();
+	FEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Rect = ScreenRect;
+	Entry.Depth = Depth;
+	Entry.Plane = Plane;
+
+	const FIntPoint MinCell = ToCell(ScreenRect.Min);
+	const FIntPoint MaxCell = ToCell(ScreenRect.Max);
+	const int64 CellCount = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+
+	if (CellCount > MaxCellsPerEntry)
+	{
+		Oversized.Add(Index);
+		return;
+	}
+
+	for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+	{
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			Cells.FindOrAdd(FIntPoint(X, Y)).Add(Index);
+		}
+	}
+}
+
+UPACS_SelectionPlaneComponent* FPACS_HoverScreenBucket::FindNearestAt(const FVector2D& ScreenPoint) const
+{
+	const FEntry* Best = nullptr;
+
+	auto Consider = [&Best, &ScreenPoint](const FEntry& Entry)
+	{
+		if ((!Best || Entry.Depth < Best->Depth) && Entry.Rect.IsInside(ScreenPoint) && Entry.Plane.IsValid())
+		{
+			Best = &Entry;
+		}
+	};
+
+	if (const TArray<int32>* CellEntries = Cells.Find(ToCell(ScreenPoint)))
+	{
+		for (int32 Index : *CellEntries)
+		{
+			Consider(Entries[Index]);
+		}
+	}
+
+	for (int32 Index : Oversized)
+	{
+		Consider(Entries[Index]);
+	}
+
+	return Best ? Best->Plane.Get() : nullptr;
+}
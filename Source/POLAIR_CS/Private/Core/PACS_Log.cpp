@@ -0,0 +1,16 @@
+#include "Core/PACS_Log.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY(LogPACSSelection);
+DEFINE_LOG_CATEGORY(LogPACSSpawn);
+
+namespace PACS_Log
+{
+    int32 HotSampleRate = 0;
+
+    static FAutoConsoleVariableRef CVarHotSampleRate(
+        TEXT("pacs.Log.Hot"),
+        HotSampleRate,
+        TEXT("Hot-path PACS logging (per action / per actor): 0 = off, 1 = every line, N = one in N per call site"),
+        ECVF_Default);
+}
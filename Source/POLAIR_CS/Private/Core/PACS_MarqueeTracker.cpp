@@ -0,0 +1,84 @@
+#include "Core/PACS_MarqueeTracker.h"
+
+void FPACS_MarqueeTracker::Configure(float InDragThresholdPx, float InMaxQueryRateHz)
+{
+    DragThresholdPx = FMath::Max(InDragThresholdPx, 0.0f);
+    MinQueryIntervalS = InMaxQueryRateHz > 0.0f ? 1.0f / InMaxQueryRateHz : 0.0f;
+}
+
+void FPACS_MarqueeTracker::Press(const FVector2D& Pos)
+{
+    State = EPACS_MarqueeState::Pressed;
+    Start = Pos;
+    Current = Pos;
+    bHasQueried = false;
+}
+
+bool FPACS_MarqueeTracker::Move(const FVector2D& Pos)
+{
+    if (State == EPACS_MarqueeState::Idle)
+    {
+        return false;
+    }
+
+    Current = Pos;
+    if (State == EPACS_MarqueeState::Pressed && FVector2D::Distance(Start, Current) > DragThresholdPx)
+    {
+        State = EPACS_MarqueeState::Dragging;
+        return true;
+    }
+    return false;
+}
+
+void FPACS_MarqueeTracker::Reset()
+{
+    State = EPACS_MarqueeState::Idle;
+    Start = FVector2D::ZeroVector;
+    Current = FVector2D::ZeroVector;
+    bHasQueried = false;
+}
+
+bool FPACS_MarqueeTracker::IsQueryPending() const
+{
+    return State == EPACS_MarqueeState::Dragging && (!bHasQueried || Current != LastQueried);
+}
+
+bool FPACS_MarqueeTracker::ConsumeQuery(double NowS, bool bIgnoreRate)
+{
+    if (!IsQueryPending())
+    {
+        return false;
+    }
+
+    if (!bIgnoreRate && bHasQueried && NowS - LastQueryTimeS < MinQueryIntervalS)
+    {
+        return false;
+    }
+
+    LastQueried = Current;
+    LastQueryTimeS = NowS;
+    bHasQueried = true;
+    ++QueryCount;
+    return true;
+}
+
+float FPACS_MarqueeTracker::GetQueryDelay(double NowS) const
+{
+    if (!IsQueryPending())
+    {
+        return -1.0f;
+    }
+
+    if (!bHasQueried)
+    {
+        return 0.0f;
+    }
+
+    return FMath::Max(0.0f, float(LastQueryTimeS + MinQueryIntervalS - NowS));
+}
+
+void FPACS_MarqueeTracker::GetRect(FVector2D& OutMin, FVector2D& OutMax) const
+{
+    OutMin = FVector2D(FMath::Min(Start.X, Current.X), FMath::Min(Start.Y, Current.Y));
+    OutMax = FVector2D(FMath::Max(Start.X, Current.X), FMath::Max(Start.Y, Current.Y));
+}
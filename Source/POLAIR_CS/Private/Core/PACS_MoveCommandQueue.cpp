@@ -0,0 +1,136 @@
+#include "Core/PACS_MoveCommandQueue.h"
+#include "GameFramework/Actor.h"
+
+void FPACS_MoveCommandQueue::Configure(float InRefillPerSecond, int32 InBurstSize, int32 InMaxPending)
+{
+    RefillPerSecond = FMath::Max(0.1f, InRefillPerSecond);
+    BurstSize = FMath::Max(1, InBurstSize);
+    MaxPending = FMath::Max(1, InMaxPending);
+    Tokens = FMath::Min(Tokens, static_cast<float>(BurstSize));
+}
+
+void FPACS_MoveCommandQueue::MakeSortedSet(const TArray<AActor*>& NPCs, TArray<UPTRINT>& OutSortedSet)
+{
+    OutSortedSet.Reset(NPCs.Num());
+    for (const AActor* NPC : NPCs)
+    {
+        if (NPC)
+        {
+            OutSortedSet.Add(reinterpret_cast<UPTRINT>(NPC));
+        }
+    }
+    OutSortedSet.Sort();
+}
+
+uint32 FPACS_MoveCommandQueue::MakeSetKey(const TArray<AActor*>& NPCs)
+{
+    TArray<UPTRINT> Sorted;
+    MakeSortedSet(NPCs, Sorted);
+    return MakeSortedSetKey(Sorted);
+}
+
+uint32 FPACS_MoveCommandQueue::MakeSortedSetKey(const TArray<UPTRINT>& SortedSet)
+{
+    uint32 Key = GetTypeHash(SortedSet.Num());
+    for (UPTRINT Ptr : SortedSet)
+    {
+        Key = HashCombine(Key, GetTypeHash(Ptr));
+    }
+    return Key;
+}
+
+bool FPACS_MoveCommandQueue::Enqueue(const TArray<AActor*>& NPCs, const FVector& TargetLocation, double Now)
+{
+    Refill(Now);
+
+    TArray<UPTRINT> SortedSet;
+    MakeSortedSet(NPCs, SortedSet);
+    const uint32 Key = MakeSortedSetKey(SortedSet);
+    for (FPACS_PendingMoveCommand& Command : Pending)
+    {
+        if (Command.SetKey == Key && Command.SortedSet == SortedSet)
+        {
+            // Same NPC set already waiting - keep the latest target only
+            Command.TargetLocation = TargetLocation;
+            Command.CoalescedCount++;
+            CoalescedSinceLastReport++;
+            return true;
+        }
+    }
+
+    if (Pending.Num() >= MaxPending)
+    {
+        RejectedSinceLastReport++;
+        return false;
+    }
+
+    FPACS_PendingMoveCommand& Command = Pending.AddDefaulted_GetRef();
+    Command.SetKey = Key;
+    Command.SortedSet = MoveTemp(SortedSet);
+    Command.TargetLocation = TargetLocation;
+    Command.NPCs.Reserve(NPCs.Num());
+    for (AActor* NPC : NPCs)
+    {
+        if (NPC)
+        {
+            Command.NPCs.Add(NPC);
+        }
+    }
+    return true;
+}
+
+void FPACS_MoveCommandQueue::Flush(double Now, TArray<FPACS_PendingMoveCommand>& OutReady)
+{
+    Refill(Now);
+
+    int32 ReadyCount = 0;
+    while (ReadyCount < Pending.Num() && Tokens >= 1.0f)
+    {
+        Tokens -= 1.0f;
+        ++ReadyCount;
+    }
+
+    if (ReadyCount > 0)
+    {
+        OutReady.Append(Pending.GetData(), ReadyCount);
+        Pending.RemoveAt(0, ReadyCount);
+    }
+}
+
+float FPACS_MoveCommandQueue::GetTimeUntilNextToken(double Now) const
+{
+    const double Elapsed = LastRefillTime < 0.0 ? 0.0 : FMath::Max(0.0, Now - LastRefillTime);
+    const float Projected = FMath::Min(static_cast<float>(BurstSize), Tokens + static_cast<float>(Elapsed) * RefillPerSecond);
+    return Projected >= 1.0f ? 0.0f : (1.0f - Projected) / RefillPerSecond;
+}
+
+void FPACS_MoveCommandQueue::ConsumeDropStats(int32& OutCoalesced, int32& OutRejected)
+{
+    OutCoalesced = CoalescedSinceLastReport;
+    OutRejected = RejectedSinceLastReport;
+    CoalescedSinceLastReport = 0;
+    RejectedSinceLastReport = 0;
+}
+
+void FPACS_MoveCommandQueue::Reset()
+{
+    Pending.Reset();
+    Tokens = static_cast<float>(BurstSize);
+    LastRefillTime = -1.0;
+    CoalescedSinceLastReport = 0;
+    RejectedSinceLastReport = 0;
+}
+
+void FPACS_MoveCommandQueue::Refill(double Now)
+{
+    if (LastRefillTime < 0.0)
+    {
+        // First use starts with a full bucket
+        Tokens = static_cast<float>(BurstSize);
+    }
+    else if (Now > LastRefillTime)
+    {
+        Tokens = FMath::Min(static_cast<float>(BurstSize), Tokens + static_cast<float>(Now - LastRefillTime) * RefillPerSecond);
+    }
+    LastRefillTime = Now;
+}
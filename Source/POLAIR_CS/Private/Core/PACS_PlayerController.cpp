@@ -15,11 +15,17 @@
 #include "Subsystems/PACSLaunchArgSubsystem.h"
 #include "Subsystems/PACS_SpawnOrchestrator.h"
 #include "Subsystems/PACS_MemoryTracker.h"
+#include "Subsystems/PACS_GroupMoveSubsystem.h"
+#include "Subsystems/PACS_NetworkMonitorSubsystem.h"
+#include "Settings/PACS_NetPerfSettings.h"
 #include "Data/PACS_SpawnConfig.h"
+#include "Data/PACS_InputActionIds.h"
+#include "Core/PACS_Log.h"
 #include "EngineUtils.h"
 #include "Components/DecalComponent.h"
 #include "Components/PACS_NPCBehaviorComponent.h"
 #include "Components/PACS_SelectionPlaneComponent.h"
+#include "Subsystems/PACS_SelectionPlaneManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Actors/Pawn/PACS_AssessorPawn.h"
 #include "Blueprint/UserWidget.h"
@@ -32,6 +38,38 @@
 #include "EnhancedInputComponent.h"
 #include "Data/PACS_InputTypes.h"
 #include "InputActionValue.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/Application/IInputProcessor.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/GameViewportClient.h"
+#include "Widgets/SViewport.h"
+
+/**
+ * Forwards mouse moves to the marquee while the select button is held, without consuming them
+ */
+class FPACS_MarqueeInputProcessor : public IInputProcessor
+{
+public:
+    explicit FPACS_MarqueeInputProcessor(APACS_PlayerController* InOwner)
+        : Owner(InOwner)
+    {}
+
+    virtual void Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor) override {}
+
+    virtual bool HandleMouseMoveEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override
+    {
+        if (APACS_PlayerController* PC = Owner.Get())
+        {
+            PC->HandleMarqueeMouseMove(MouseEvent.GetScreenSpacePosition());
+        }
+        return false;
+    }
+
+    virtual const TCHAR* GetDebugName() const override { return TEXT("PACS_Marquee"); }
+
+private:
+    TWeakObjectPtr<APACS_PlayerController> Owner;
+};
 #endif
 
 APACS_PlayerController::APACS_PlayerController()
@@ -46,6 +84,26 @@ APACS_PlayerController::APACS_PlayerController()
 void APACS_PlayerController::PostInitializeComponents()
 {
     Super::PostInitializeComponents();
+
+#if !UE_SERVER
+    if (InputHandler)
+    {
+        InputHandler->OnInputReady.AddUObject(this, &APACS_PlayerController::HandleInputReady);
+    }
+#endif
+}
+
+void APACS_PlayerController::ReceivedPlayer()
+{
+    Super::ReceivedPlayer();
+
+    // LocalPlayer (and its Enhanced Input subsystem) is assigned by now
+#if !UE_SERVER
+    if (InputHandler)
+    {
+        InputHandler->NotifyLocalPlayerReady();
+    }
+#endif
 }
 
 void APACS_PlayerController::BeginPlay()
@@ -151,6 +209,14 @@ void APACS_PlayerController::EndPlay(const EEndPlayReason::Type EndPlayReason)
     FCoreDelegates::VRHeadsetRemovedFromHead.Remove(OnRemovedHandle);
     FCoreDelegates::VRHeadsetRecenter.Remove(OnRecenterHandle);
 
+    // Stop listening for marquee mouse moves
+    EndMarqueePress();
+
+    // Drop any queued move commands
+    GetWorldTimerManager().ClearTimer(MoveCommandFlushTimer);
+    MoveCommandQueue.Reset();
+    bMoveCommandFlushScheduled = false;
+
     Super::EndPlay(EndPlayReason);
 }
 
@@ -172,15 +238,7 @@ void APACS_PlayerController::OnPossess(APawn* InPawn)
 {
     Super::OnPossess(InPawn);
 
-    // Epic's pattern: OnPossess() is for pawn-specific setup
-    // InputHandler initialization happens here, binding already done in SetupInputComponent()
-#if !UE_SERVER
-    if (InputHandler && IsLocalController())
-    {
-        // Trigger InputHandler to update contexts now that we have a pawn
-        InputHandler->OnSubsystemAvailable();
-    }
-#endif
+    // InputHandler refreshes its contexts from the pawn notifier; binding already done in SetupInputComponent()
 }
 
 void APACS_PlayerController::OnUnPossess()
@@ -214,6 +272,16 @@ void APACS_PlayerController::ValidateInputSystem()
 #endif
 }
 
+void APACS_PlayerController::HandleInputReady(UPACS_InputHandlerComponent* Handler)
+{
+#if !UE_SERVER
+    if (IsLocalController() && InputComponent)
+    {
+        BindInputActions();
+    }
+#endif
+}
+
 void APACS_PlayerController::BindInputActions()
 {
 #if !UE_SERVER
@@ -224,7 +292,7 @@ void APACS_PlayerController::BindInputActions()
         return;
     }
 
-    // Skip binding if handler isn't initialized yet - it will call us back when ready
+    // Skip binding if handler isn't initialized yet - OnInputReady calls us back
     if (!InputHandler->IsHealthy())
     {
         UE_LOG(LogTemp, Log, 
@@ -261,10 +329,13 @@ void APACS_PlayerController::BindInputActions()
             continue;
         }
 
+        // Resolved once here; each binding carries the ID so dispatch needs no map lookup
+        const uint16 ActionId = InputHandler->ResolveActionId(Mapping.InputAction);
+
         if (Mapping.bBindStarted)
         {
             EIC->BindAction(Mapping.InputAction.Get(), ETriggerEvent::Started, 
-                InputHandler.Get(), &UPACS_InputHandlerComponent::HandleAction);
+                InputHandler.Get(), &UPACS_InputHandlerComponent::HandleActionById, ActionId);
             BindingCount++;
             UE_LOG(LogTemp, VeryVerbose, TEXT("  Bound %s for Started"), 
                 *Mapping.ActionIdentifier.ToString());
@@ -273,7 +344,7 @@ void APACS_PlayerController::BindInputActions()
         if (Mapping.bBindTriggered)
         {
             EIC->BindAction(Mapping.InputAction.Get(), ETriggerEvent::Triggered, 
-                InputHandler.Get(), &UPACS_InputHandlerComponent::HandleAction);
+                InputHandler.Get(), &UPACS_InputHandlerComponent::HandleActionById, ActionId);
             BindingCount++;
             UE_LOG(LogTemp, VeryVerbose, TEXT("  Bound %s for Triggered"), 
                 *Mapping.ActionIdentifier.ToString());
@@ -282,7 +353,7 @@ void APACS_PlayerController::BindInputActions()
         if (Mapping.bBindCompleted)
         {
             EIC->BindAction(Mapping.InputAction.Get(), ETriggerEvent::Completed, 
-                InputHandler.Get(), &UPACS_InputHandlerComponent::HandleAction);
+                InputHandler.Get(), &UPACS_InputHandlerComponent::HandleActionById, ActionId);
             BindingCount++;
             UE_LOG(LogTemp, VeryVerbose, TEXT("  Bound %s for Completed"), 
                 *Mapping.ActionIdentifier.ToString());
@@ -291,7 +362,7 @@ void APACS_PlayerController::BindInputActions()
         if (Mapping.bBindOngoing)
         {
             EIC->BindAction(Mapping.InputAction.Get(), ETriggerEvent::Ongoing, 
-                InputHandler.Get(), &UPACS_InputHandlerComponent::HandleAction);
+                InputHandler.Get(), &UPACS_InputHandlerComponent::HandleActionById, ActionId);
             BindingCount++;
             UE_LOG(LogTemp, VeryVerbose, TEXT("  Bound %s for Ongoing"), 
                 *Mapping.ActionIdentifier.ToString());
@@ -300,7 +371,7 @@ void APACS_PlayerController::BindInputActions()
         if (Mapping.bBindCanceled)
         {
             EIC->BindAction(Mapping.InputAction.Get(), ETriggerEvent::Canceled, 
-                InputHandler.Get(), &UPACS_InputHandlerComponent::HandleAction);
+                InputHandler.Get(), &UPACS_InputHandlerComponent::HandleActionById, ActionId);
             BindingCount++;
             UE_LOG(LogTemp, VeryVerbose, TEXT("  Bound %s for Canceled"), 
                 *Mapping.ActionIdentifier.ToString());
@@ -428,28 +499,7 @@ void APACS_PlayerController::Tick(float DeltaTime)
         DisplayInputContextDebug();
     }
 
-    // Handle marquee drag detection
-    if (bLeftMousePressed && !bIsMarqueeActive)
-    {
-        FVector2D CurrentPos;
-        if (GetMousePosition(CurrentPos.X, CurrentPos.Y))
-        {
-            // Check if mouse has moved beyond drag threshold
-            const float DragDistance = FVector2D::Distance(CurrentPos, MarqueeStartPos);
-            if (DragDistance > MarqueeDragThreshold)
-            {
-                UE_LOG(LogTemp, Warning, TEXT("[MARQUEE DEBUG] Drag threshold exceeded: %f > %f"),
-                    DragDistance, MarqueeDragThreshold);
-                StartMarquee();
-            }
-        }
-    }
-
-    // Update marquee current position while dragging
-    if (bIsMarqueeActive)
-    {
-        GetMousePosition(MarqueeCurrentPos.X, MarqueeCurrentPos.Y);
-    }
+    // Marquee is driven by the select action and mouse-move events (see HandleMarqueeMouseMove)
 }
 
 void APACS_PlayerController::DisplayInputContextDebug()
@@ -472,9 +522,17 @@ void APACS_PlayerController::DisplayInputContextDebug()
     );
 }
 
-EPACS_InputHandleResult APACS_PlayerController::HandleInputAction(FName ActionName, const FInputActionValue& Value)
+void APACS_PlayerController::GetSubscribedActions(TArray<FName>& OutActions) const
+{
+    // Keep in step with HandleInputActionId
+    using namespace PACS_InputActions;
+    OutActions.Append({ MenuToggle.GetName(), UI.GetName(), LeftClick.GetName(), Select.GetName(),
+                        RightClick.GetName(), Cancel.GetName(), Deselect.GetName() });
+}
+
+EPACS_InputHandleResult APACS_PlayerController::HandleInputActionId(uint16 ActionId, FName ActionName, const FInputActionValue& Value)
 {
-    if (ActionName == TEXT("MenuToggle"))
+    if (ActionId == PACS_InputActions::MenuToggle)
     {
         if (InputHandler)
         {
@@ -482,7 +540,7 @@ EPACS_InputHandleResult APACS_PlayerController::HandleInputAction(FName ActionNa
         }
         return EPACS_InputHandleResult::HandledConsume;
     }
-    else if (ActionName == TEXT("UI"))
+    else if (ActionId == PACS_InputActions::UI)
     {
         if (InputHandler)
         {
@@ -492,14 +550,14 @@ EPACS_InputHandleResult APACS_PlayerController::HandleInputAction(FName ActionNa
     }
     // PRIORITY 1: Handle spawn placement inputs when in placement mode (GameplayTag-based system)
     // This must be checked BEFORE marquee selection to have higher priority
-    if (bSpawnPlacementMode && (ActionName == TEXT("LeftClick") || ActionName == TEXT("Select") ||
-                                  ActionName == TEXT("RightClick") || ActionName == TEXT("Cancel")))
+    if (bSpawnPlacementMode && (ActionId == PACS_InputActions::LeftClick || ActionId == PACS_InputActions::Select ||
+                                  ActionId == PACS_InputActions::RightClick || ActionId == PACS_InputActions::Cancel))
     {
         UE_LOG(LogTemp, Log, TEXT("PACS_PlayerController: Handling input in spawn placement mode - Action: %s"),
             *ActionName.ToString());
 
         // Left click to confirm placement
-        if (ActionName == TEXT("LeftClick") || ActionName == TEXT("Select"))
+        if (ActionId == PACS_InputActions::LeftClick || ActionId == PACS_InputActions::Select)
         {
             const float Magnitude = Value.GetMagnitude();
             // Only on button release (Completed event)
@@ -511,7 +569,7 @@ EPACS_InputHandleResult APACS_PlayerController::HandleInputAction(FName ActionNa
             }
         }
         // Right click to cancel placement
-        else if (ActionName == TEXT("RightClick") || ActionName == TEXT("Cancel"))
+        else if (ActionId == PACS_InputActions::RightClick || ActionId == PACS_InputActions::Cancel)
         {
             const float Magnitude = Value.GetMagnitude();
             // Only on button release
@@ -524,77 +582,42 @@ EPACS_InputHandleResult APACS_PlayerController::HandleInputAction(FName ActionNa
         }
     }
     // PRIORITY 2: Marquee selection system - only when NOT in spawn placement mode
-    else if (ActionName == TEXT("Select") || ActionName == TEXT("LeftClick"))
+    else if (ActionId == PACS_InputActions::Select || ActionId == PACS_InputActions::LeftClick)
     {
         // Enhanced Input sends discrete Started and Completed events
         // Started event: magnitude > 0 when the button is first pressed
         // Completed event: magnitude == 0 when the button is released
         const float Magnitude = Value.GetMagnitude();
 
-        UE_LOG(LogTemp, Warning, TEXT("[MARQUEE DEBUG] LeftClick: Magnitude=%f, bIsLeftClickHeld=%d"),
-            Magnitude, bIsLeftClickHeld);
+        PACS_LOG_HOT(LogPACSSelection, Verbose, TEXT("Marquee: select magnitude=%f, state=%d"),
+            Magnitude, (int32)Marquee.GetState());
 
         // Detect Started event (button pressed)
-        if (Magnitude > 0.0f && !bIsLeftClickHeld)
+        if (Magnitude > 0.0f && Marquee.GetState() == EPACS_MarqueeState::Idle)
         {
-            bIsLeftClickHeld = true;
-            bLeftMousePressed = true;
-
-            // Record start position for potential marquee
-            GetMousePosition(MarqueeStartPos.X, MarqueeStartPos.Y);
-            MarqueeCurrentPos = MarqueeStartPos;
-
-            UE_LOG(LogTemp, Warning, TEXT("[MARQUEE DEBUG] Mouse STARTED (pressed) at: %s"),
-                *MarqueeStartPos.ToString());
+            FVector2D PressPos;
+            if (GetMousePosition(PressPos.X, PressPos.Y))
+            {
+                BeginMarqueePress(PressPos);
+            }
         }
         // Detect Completed event (button released)
-        else if (Magnitude == 0.0f && bIsLeftClickHeld)
+        else if (Magnitude == 0.0f && Marquee.GetState() != EPACS_MarqueeState::Idle)
         {
-            bIsLeftClickHeld = false;
-            bLeftMousePressed = false;
-
-            UE_LOG(LogTemp, Warning, TEXT("[MARQUEE DEBUG] Mouse COMPLETED (released). IsMarqueeActive=%d"),
-                bIsMarqueeActive);
-
-            if (bIsMarqueeActive)
-            {
-                // Finalize marquee selection
-                FinalizeMarquee();
-            }
-            else
-            {
-                // Normal single-click selection
-                FHitResult HitResult;
-                if (GetHitResultUnderCursor(SelectionTraceChannel, false, HitResult))
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("[SELECTION DEBUG] Hit actor: %s at location %s"),
-                        HitResult.GetActor() ? *HitResult.GetActor()->GetName() : TEXT("None"),
-                        *HitResult.Location.ToString());
-
-                    // Request selection of the actor (server will notify client to update NPCBehaviorComponent)
-                    ServerRequestSelect(HitResult.GetActor());
-                }
-                else
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("[SELECTION DEBUG] No hit result - deselecting"));
-
-                    // No hit - deselect (server will notify client to update NPCBehaviorComponent)
-                    ServerRequestDeselect();
-                }
-            }
-
-            // Clear marquee state
-            ClearMarquee();
+            // Released outside the viewport: end where the last mouse move left the marquee
+            FVector2D ReleasePos = Marquee.GetCurrent();
+            GetMousePosition(ReleasePos.X, ReleasePos.Y);
+            ReleaseMarquee(ReleasePos);
         }
         return EPACS_InputHandleResult::HandledConsume;
     }
-    else if (ActionName == TEXT("RightClick"))
+    else if (ActionId == PACS_InputActions::RightClick)
     {
         // Right-click: Pass through to NPCBehaviorComponent for movement commands
         // The NPCBehaviorComponent will handle this if an NPC is selected
         return EPACS_InputHandleResult::NotHandled;
     }
-    else if (ActionName == TEXT("Deselect"))
+    else if (ActionId == PACS_InputActions::Deselect)
     {
         // Explicit deselection command (server will notify client to update NPCBehaviorComponent)
         ServerRequestDeselect();
@@ -606,7 +629,7 @@ EPACS_InputHandleResult APACS_PlayerController::HandleInputAction(FName ActionNa
     if (bIsPlacingSpawn)
     {
         // Left click to confirm placement
-        if (ActionName == TEXT("LeftClick") || ActionName == TEXT("Select"))
+        if (ActionId == PACS_InputActions::LeftClick || ActionId == PACS_InputActions::Select)
         {
             const float Magnitude = Value.GetMagnitude();
             // Only on button release (Completed event)
@@ -617,7 +640,7 @@ EPACS_InputHandleResult APACS_PlayerController::HandleInputAction(FName ActionNa
             }
         }
         // Right click to cancel placement
-        else if (ActionName == TEXT("RightClick") || ActionName == TEXT("Cancel"))
+        else if (ActionId == PACS_InputActions::RightClick || ActionId == PACS_InputActions::Cancel)
         {
             const float Magnitude = Value.GetMagnitude();
             // Only on button release
@@ -662,26 +685,26 @@ void APACS_PlayerController::ServerRequestSelect_Implementation(AActor* TargetAc
     // Server authority check
     if (!HasAuthority() || !IsValid(TargetActor))
     {
-        UE_LOG(LogTemp, Error, TEXT("[SELECTION DEBUG] ServerRequestSelect failed - No authority or invalid target"));
+        UE_LOG(LogPACSSelection, Error, TEXT("ServerRequestSelect failed - No authority or invalid target"));
         return;
     }
 
     APACS_PlayerState* PS = GetPlayerState<APACS_PlayerState>();
 
-    UE_LOG(LogTemp, Warning, TEXT("[SELECTION DEBUG] ServerRequestSelect - Player: %s, Target: %s"),
+    PACS_LOG_HOT(LogPACSSelection, Log, TEXT("ServerRequestSelect - Player: %s, Target: %s"),
         PS ? *PS->GetPlayerName() : TEXT("NULL"),
         *TargetActor->GetName());
 
     if (!PS)
     {
-        UE_LOG(LogTemp, Error, TEXT("[SELECTION DEBUG] ServerRequestSelect failed - PlayerState null"));
+        UE_LOG(LogPACSSelection, Error, TEXT("ServerRequestSelect failed - PlayerState null"));
         return;
     }
 
     // Check if target implements IPACS_Poolable (all NPCs do)
     if (!TargetActor->Implements<UPACS_Poolable>())
     {
-        UE_LOG(LogTemp, Warning, TEXT("[SELECTION DEBUG] Target %s is not a poolable NPC - ignoring selection"),
+        PACS_LOG_HOT(LogPACSSelection, Log, TEXT("Target %s is not a poolable NPC - ignoring selection"),
             *TargetActor->GetName());
         return;
     }
@@ -707,7 +730,7 @@ void APACS_PlayerController::ServerRequestSelect_Implementation(AActor* TargetAc
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("[SELECTION DEBUG] Could not cast target to any NPC base class"));
+        PACS_LOG_HOT(LogPACSSelection, Log, TEXT("Could not cast target to any NPC base class"));
         return;
     }
 
@@ -716,7 +739,7 @@ void APACS_PlayerController::ServerRequestSelect_Implementation(AActor* TargetAc
     {
         if (CurrentSelector && CurrentSelector != PS)
         {
-            UE_LOG(LogTemp, Warning, TEXT("[SELECTION DEBUG] NPC %s already selected by %s - cannot select"),
+            PACS_LOG_HOT(LogPACSSelection, Log, TEXT("NPC %s already selected by %s - cannot select"),
                 *TargetActor->GetName(),
                 *CurrentSelector->GetPlayerName());
             return; // Can't select - already taken by someone else
@@ -731,7 +754,7 @@ void APACS_PlayerController::ServerRequestSelect_Implementation(AActor* TargetAc
             if (APACS_NPC_Base* PreviousNPC = Cast<APACS_NPC_Base>(PreviousActor))
             {
                 PreviousNPC->SetSelected(false, nullptr);
-                UE_LOG(LogTemp, Log, TEXT("[SELECTION DEBUG] Deselected previous NPC: %s"),
+                PACS_LOG_HOT(LogPACSSelection, Verbose, TEXT("Deselected previous NPC: %s"),
                     *PreviousActor->GetName());
             }
             else if (APACS_NPC_Base_Char* PreviousCharNPC = Cast<APACS_NPC_Base_Char>(PreviousActor))
@@ -762,7 +785,7 @@ void APACS_PlayerController::ServerRequestSelect_Implementation(AActor* TargetAc
     // For single selection, clear previous selections and set just this one
     PS->SetSelectedActor(TargetActor);
 
-    UE_LOG(LogTemp, Warning, TEXT("[SELECTION DEBUG] SUCCESS: %s selected NPC %s"),
+    PACS_LOG_HOT(LogPACSSelection, Log, TEXT("SUCCESS: %s selected NPC %s"),
         *PS->GetPlayerName(), *TargetActor->GetName());
 
     // Notify the owning client to update their NPCBehaviorComponent
@@ -775,18 +798,18 @@ void APACS_PlayerController::ServerRequestSelectMultiple_Implementation(const TA
     // Server authority check
     if (!HasAuthority())
     {
-        UE_LOG(LogTemp, Error, TEXT("[SELECTION DEBUG] ServerRequestSelectMultiple failed - No authority"));
+        UE_LOG(LogPACSSelection, Error, TEXT("ServerRequestSelectMultiple failed - No authority"));
         return;
     }
 
     APACS_PlayerState* PS = GetPlayerState<APACS_PlayerState>();
     if (!PS)
     {
-        UE_LOG(LogTemp, Error, TEXT("[SELECTION DEBUG] ServerRequestSelectMultiple failed - PlayerState null"));
+        UE_LOG(LogPACSSelection, Error, TEXT("ServerRequestSelectMultiple failed - PlayerState null"));
         return;
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("[SELECTION DEBUG] ServerRequestSelectMultiple - Player: %s, Targets: %d"),
+    PACS_LOG_HOT(LogPACSSelection, Log, TEXT("ServerRequestSelectMultiple - Player: %s, Targets: %d"),
         PS ? *PS->GetPlayerName() : TEXT("NULL"),
         TargetActors.Num());
 
@@ -825,7 +848,7 @@ void APACS_PlayerController::ServerRequestSelectMultiple_Implementation(const TA
         // Check if target implements IPACS_Poolable (all NPCs do)
         if (!TargetActor->Implements<UPACS_Poolable>())
         {
-            UE_LOG(LogTemp, Warning, TEXT("[SELECTION DEBUG] Target %s is not a poolable NPC - skipping"),
+            PACS_LOG_HOT(LogPACSSelection, Log, TEXT("Target %s is not a poolable NPC - skipping"),
                 *TargetActor->GetName());
             continue;
         }
@@ -851,7 +874,7 @@ void APACS_PlayerController::ServerRequestSelectMultiple_Implementation(const TA
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("[SELECTION DEBUG] Could not cast %s to any NPC base class - skipping"),
+            PACS_LOG_HOT(LogPACSSelection, Log, TEXT("Could not cast %s to any NPC base class - skipping"),
                 *TargetActor->GetName());
             continue;
         }
@@ -859,7 +882,7 @@ void APACS_PlayerController::ServerRequestSelectMultiple_Implementation(const TA
         // Skip if already selected by another player
         if (bIsAlreadySelected && CurrentSelector && CurrentSelector != PS)
         {
-            UE_LOG(LogTemp, Warning, TEXT("[SELECTION DEBUG] NPC %s already selected by %s - skipping"),
+            PACS_LOG_HOT(LogPACSSelection, Log, TEXT("NPC %s already selected by %s - skipping"),
                 *TargetActor->GetName(), *CurrentSelector->GetPlayerName());
             continue;
         }
@@ -869,7 +892,7 @@ void APACS_PlayerController::ServerRequestSelectMultiple_Implementation(const TA
         {
             PS->AddSelectedActor(TargetActor);  // Just add to our list
             SuccessCount++;
-            UE_LOG(LogTemp, Log, TEXT("[SELECTION DEBUG] NPC %s already selected by us - keeping selected"),
+            PACS_LOG_HOT(LogPACSSelection, Verbose, TEXT("NPC %s already selected by us - keeping selected"),
                 *TargetActor->GetName());
             continue;
         }
@@ -891,11 +914,11 @@ void APACS_PlayerController::ServerRequestSelectMultiple_Implementation(const TA
         PS->AddSelectedActor(TargetActor);
         SuccessCount++;
 
-        UE_LOG(LogTemp, Log, TEXT("[SELECTION DEBUG] Selected NPC %s (%d/%d)"),
+        PACS_LOG_HOT(LogPACSSelection, Verbose, TEXT("Selected NPC %s (%d/%d)"),
             *TargetActor->GetName(), SuccessCount, TargetActors.Num());
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("[SELECTION DEBUG] SUCCESS: %s selected %d/%d NPCs"),
+    PACS_LOG_HOT(LogPACSSelection, Log, TEXT("SUCCESS: %s selected %d/%d NPCs"),
         *PS->GetPlayerName(), SuccessCount, TargetActors.Num());
 
     // Notify the owning client to update their NPCBehaviorComponent
@@ -908,18 +931,18 @@ void APACS_PlayerController::ServerRequestDeselect_Implementation()
     // Server authority check
     if (!HasAuthority())
     {
-        UE_LOG(LogTemp, Error, TEXT("[SELECTION DEBUG] ServerRequestDeselect failed - No authority"));
+        UE_LOG(LogPACSSelection, Error, TEXT("ServerRequestDeselect failed - No authority"));
         return;
     }
 
     APACS_PlayerState* PS = GetPlayerState<APACS_PlayerState>();
     if (!PS)
     {
-        UE_LOG(LogTemp, Error, TEXT("[SELECTION DEBUG] ServerRequestDeselect failed - No PlayerState"));
+        UE_LOG(LogPACSSelection, Error, TEXT("ServerRequestDeselect failed - No PlayerState"));
         return;
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("[SELECTION DEBUG] ServerRequestDeselect - Player: %s"), *PS->GetPlayerName());
+    PACS_LOG_HOT(LogPACSSelection, Log, TEXT("ServerRequestDeselect - Player: %s"), *PS->GetPlayerName());
 
     // Clear NPC selection state for all selected actors
     TArray<AActor*> SelectedActors = PS->GetSelectedActors();
@@ -934,21 +957,21 @@ void APACS_PlayerController::ServerRequestDeselect_Implementation()
         {
             NPC->SetSelected(false, nullptr);
             ClearedCount++;
-            UE_LOG(LogTemp, Log, TEXT("[SELECTION DEBUG] Cleared selection state on NPC: %s"),
+            PACS_LOG_HOT(LogPACSSelection, Verbose, TEXT("Cleared selection state on NPC: %s"),
                 *CurrentActor->GetName());
         }
         else if (APACS_NPC_Base_Char* CharNPC = Cast<APACS_NPC_Base_Char>(CurrentActor))
         {
             CharNPC->SetSelected(false, nullptr);
             ClearedCount++;
-            UE_LOG(LogTemp, Log, TEXT("[SELECTION DEBUG] Cleared selection state on Character NPC: %s"),
+            PACS_LOG_HOT(LogPACSSelection, Verbose, TEXT("Cleared selection state on Character NPC: %s"),
                 *CurrentActor->GetName());
         }
         else if (APACS_NPC_Base_Veh* VehNPC = Cast<APACS_NPC_Base_Veh>(CurrentActor))
         {
             VehNPC->SetSelected(false, nullptr);
             ClearedCount++;
-            UE_LOG(LogTemp, Log, TEXT("[SELECTION DEBUG] Cleared selection state on Vehicle NPC: %s"),
+            PACS_LOG_HOT(LogPACSSelection, Verbose, TEXT("Cleared selection state on Vehicle NPC: %s"),
                 *CurrentActor->GetName());
         }
     }
@@ -956,7 +979,7 @@ void APACS_PlayerController::ServerRequestDeselect_Implementation()
     // Clear all selected actors in PlayerState
     PS->ClearSelectedActors();
 
-    UE_LOG(LogTemp, Warning, TEXT("[SELECTION DEBUG] SUCCESS: %s deselected %d NPCs"),
+    PACS_LOG_HOT(LogPACSSelection, Log, TEXT("SUCCESS: %s deselected %d NPCs"),
         *PS->GetPlayerName(), ClearedCount);
 
     // Notify the owning client to clear their NPCBehaviorComponent
@@ -972,18 +995,82 @@ void APACS_PlayerController::ServerRequestMoveMultiple_Implementation(const TArr
         return;
     }
 
+    const UPACS_NetPerfSettings* NetPerf = UPACS_NetPerfSettings::Get();
+    if (!NetPerf->bRateLimitMoveCommands)
+    {
+        ExecuteMoveCommand(NPCs, TargetLocation);
+        return;
+    }
+
+    // Queue the command; repeats for the same NPC set before the next flush only keep the latest target
+    MoveCommandQueue.Configure(NetPerf->MoveCommandTokensPerSecond, NetPerf->MoveCommandBurstSize, NetPerf->MaxPendingMoveCommands);
+    MoveCommandQueue.Enqueue(NPCs, TargetLocation, GetWorld()->GetTimeSeconds());
+
+    if (!bMoveCommandFlushScheduled)
+    {
+        bMoveCommandFlushScheduled = true;
+        MoveCommandFlushTimer = GetWorldTimerManager().SetTimerForNextTick(this, &APACS_PlayerController::FlushMoveCommands);
+    }
+}
+
+void APACS_PlayerController::FlushMoveCommands()
+{
+    bMoveCommandFlushScheduled = false;
+
+    TArray<FPACS_PendingMoveCommand> ReadyCommands;
+    MoveCommandQueue.Flush(GetWorld()->GetTimeSeconds(), ReadyCommands);
+
+    for (const FPACS_PendingMoveCommand& Command : ReadyCommands)
+    {
+        TArray<AActor*> NPCs;
+        NPCs.Reserve(Command.NPCs.Num());
+        for (const TWeakObjectPtr<AActor>& NPC : Command.NPCs)
+        {
+            if (AActor* Actor = NPC.Get())
+            {
+                NPCs.Add(Actor);
+            }
+        }
+
+        ExecuteMoveCommand(NPCs, Command.TargetLocation);
+    }
+
+    // Report superseded and rejected commands
+    int32 CoalescedCount = 0;
+    int32 RejectedCount = 0;
+    MoveCommandQueue.ConsumeDropStats(CoalescedCount, RejectedCount);
+    if (CoalescedCount > 0 || RejectedCount > 0)
+    {
+        if (UPACS_NetworkMonitorSubsystem* NetworkMonitor = GetWorld()->GetSubsystem<UPACS_NetworkMonitorSubsystem>())
+        {
+            NetworkMonitor->RecordDroppedMoveCommands(CoalescedCount, RejectedCount);
+        }
+    }
+
+    // Commands still waiting for a token run as soon as one refills
+    if (MoveCommandQueue.HasPending())
+    {
+        bMoveCommandFlushScheduled = true;
+        const float Delay = FMath::Max(0.01f, MoveCommandQueue.GetTimeUntilNextToken(GetWorld()->GetTimeSeconds()));
+        GetWorldTimerManager().SetTimer(MoveCommandFlushTimer, this, &APACS_PlayerController::FlushMoveCommands, Delay, false);
+    }
+}
+
+void APACS_PlayerController::ExecuteMoveCommand(const TArray<AActor*>& NPCs, const FVector& TargetLocation)
+{
     APACS_PlayerState* PS = GetPlayerState<APACS_PlayerState>();
     if (!PS)
     {
-        UE_LOG(LogTemp, Error, TEXT("[MOVEMENT DEBUG] ServerRequestMoveMultiple failed - PlayerState null"));
+        UE_LOG(LogPACSSelection, Error, TEXT("ExecuteMoveCommand failed - PlayerState null"));
         return;
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("[MOVEMENT DEBUG] ServerRequestMoveMultiple - Player: %s, NPCs: %d, Target: %s"),
+    PACS_LOG_HOT(LogPACSSelection, Verbose, TEXT("ExecuteMoveCommand - Player: %s, NPCs: %d, Target: %s"),
         *PS->GetPlayerName(), NPCs.Num(), *TargetLocation.ToString());
 
-    // Move each NPC that this player owns
-    int32 MovedCount = 0;
+    // Collect the NPCs this player owns
+    TArray<AActor*> OwnedNPCs;
+    OwnedNPCs.Reserve(NPCs.Num());
     for (AActor* NPC : NPCs)
     {
         if (!NPC) continue;
@@ -1001,25 +1088,35 @@ void APACS_PlayerController::ServerRequestMoveMultiple_Implementation(const TArr
 
         if (bIsOwnedByPlayer)
         {
-            // Execute movement
-            if (NPC->Implements<UPACS_SelectableCharacterInterface>())
-            {
-                IPACS_SelectableCharacterInterface* Selectable = Cast<IPACS_SelectableCharacterInterface>(NPC);
-                Selectable->MoveToLocation(TargetLocation);
-                MovedCount++;
-
-                UE_LOG(LogTemp, Log, TEXT("[MOVEMENT DEBUG] Moving NPC %s to %s"),
-                    *NPC->GetName(), *TargetLocation.ToString());
-            }
+            OwnedNPCs.Add(NPC);
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("[MOVEMENT DEBUG] Player %s doesn't own NPC %s - skipping"),
+            PACS_LOG_HOT(LogPACSSelection, Verbose, TEXT("Player %s doesn't own NPC %s - skipping"),
                 *PS->GetPlayerName(), *NPC->GetName());
         }
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("[MOVEMENT DEBUG] SUCCESS: Moved %d/%d NPCs to location"),
+    int32 MovedCount = 0;
+
+    // Groups share one corridor path and spread into formation slots
+    const UPACS_NetPerfSettings* NetPerf = UPACS_NetPerfSettings::Get();
+    UPACS_GroupMoveSubsystem* GroupMove = GetWorld()->GetSubsystem<UPACS_GroupMoveSubsystem>();
+    if (OwnedNPCs.Num() > 1 && NetPerf->bEnableGroupMove && GroupMove)
+    {
+        MovedCount = GroupMove->IssueGroupMove(OwnedNPCs, TargetLocation, NetPerf->DefaultFormation);
+    }
+    else
+    {
+        for (AActor* NPC : OwnedNPCs)
+        {
+            IPACS_SelectableCharacterInterface* Selectable = Cast<IPACS_SelectableCharacterInterface>(NPC);
+            Selectable->MoveToLocation(TargetLocation);
+            MovedCount++;
+        }
+    }
+
+    PACS_LOG_HOT(LogPACSSelection, Verbose, TEXT("ExecuteMoveCommand - Moved %d/%d NPCs"),
         MovedCount, NPCs.Num());
 }
 
@@ -1030,61 +1127,169 @@ void APACS_PlayerController::ClientUpdateSelectedNPCs_Implementation(const TArra
     {
         NPCBehaviorComponent->SetLocallySelectedNPCs(SelectedNPCs);
 
-        UE_LOG(LogTemp, Log, TEXT("[SELECTION DEBUG] Client updated NPCBehaviorComponent with %d selections"),
+        PACS_LOG_HOT(LogPACSSelection, Verbose, TEXT("Client updated NPCBehaviorComponent with %d selections"),
             SelectedNPCs.Num());
     }
 }
 
-void APACS_PlayerController::StartMarquee()
+void APACS_PlayerController::BeginMarqueePress(const FVector2D& ViewportPos)
+{
+    Marquee.Configure(MarqueeDragThreshold, MarqueeUpdateRate);
+    Marquee.Press(ViewportPos);
+
+#if !UE_SERVER
+    // Mouse moves only matter while the button is held
+    if (FSlateApplication::IsInitialized() && !MarqueeInputProcessor.IsValid())
+    {
+        MarqueeInputProcessor = MakeShared<FPACS_MarqueeInputProcessor>(this);
+        FSlateApplication::Get().RegisterInputPreProcessor(MarqueeInputProcessor);
+    }
+#endif
+
+    PACS_LOG_HOT(LogPACSSelection, Verbose, TEXT("Marquee: pressed at %s"), *ViewportPos.ToString());
+}
+
+void APACS_PlayerController::EndMarqueePress()
 {
-    bIsMarqueeActive = true;
+#if !UE_SERVER
+    if (MarqueeInputProcessor.IsValid())
+    {
+        if (FSlateApplication::IsInitialized())
+        {
+            FSlateApplication::Get().UnregisterInputPreProcessor(MarqueeInputProcessor);
+        }
+        MarqueeInputProcessor.Reset();
+    }
+#endif
 
+    GetWorldTimerManager().ClearTimer(MarqueeUpdateTimer);
+}
+
+void APACS_PlayerController::HandleMarqueeMouseMove(const FVector2D& ScreenSpacePos)
+{
+#if !UE_SERVER
+    // The pre-processor sees the event before the viewport does, so GetMousePosition would still return
+    // the previous event's cursor; convert the event position the way the scene viewport caches it
+    const ULocalPlayer* LocalPlayer = GetLocalPlayer();
+    const TSharedPtr<SViewport> ViewportWidget = (LocalPlayer && LocalPlayer->ViewportClient)
+        ? LocalPlayer->ViewportClient->GetGameViewportWidget()
+        : nullptr;
+    if (!ViewportWidget.IsValid())
+    {
+        return;
+    }
+
+    const FGeometry& Geometry = ViewportWidget->GetCachedGeometry();
+    MoveMarquee(Geometry.AbsoluteToLocal(ScreenSpacePos) * Geometry.Scale);
+#endif
+}
+
+void APACS_PlayerController::MoveMarquee(const FVector2D& ViewportPos)
+{
+    if (Marquee.Move(ViewportPos))
+    {
+        PACS_LOG_HOT(LogPACSSelection, Verbose, TEXT("Marquee: drag threshold exceeded (%f > %f)"),
+            FVector2D::Distance(ViewportPos, Marquee.GetStart()), MarqueeDragThreshold);
+        StartMarquee();
+    }
+
+    if (Marquee.IsDragging())
+    {
+        UpdateMarquee();
+    }
+}
+
+void APACS_PlayerController::StartMarquee()
+{
     // Disable edge scrolling during marquee
     if (EdgeScrollComponent)
     {
         EdgeScrollComponent->SetEnabled(false);
-        UE_LOG(LogTemp, Warning, TEXT("[MARQUEE DEBUG] Edge scrolling disabled"));
     }
 
     // Disable hover probe during marquee
     if (HoverProbe)
     {
         HoverProbe->SetComponentTickEnabled(false);
-        UE_LOG(LogTemp, Warning, TEXT("[MARQUEE DEBUG] Hover probe disabled"));
     }
 
-    // Disable rotation on AssessorPawn
-    if (APACS_AssessorPawn* AssessorPawn = Cast<APACS_AssessorPawn>(GetPawn()))
+    // Note: AssessorPawn rotation should be disabled here too, but it has no SetRotationEnabled yet
+
+    PACS_LOG_HOT(LogPACSSelection, Log, TEXT("Marquee: drag started at %s"), *Marquee.GetStart().ToString());
+}
+
+void APACS_PlayerController::UpdateMarquee()
+{
+    if (!Marquee.IsDragging())
     {
-        // Note: AssessorPawn doesn't have SetRotationEnabled yet
-        // This would need to be added to the pawn class
-        UE_LOG(LogTemp, Warning, TEXT("[MARQUEE DEBUG] AssessorPawn rotation would be disabled here"));
+        return;
     }
 
-    // Start update timer
-    if (MarqueeUpdateRate > 0.0f)
+    FTimerManager& TimerManager = GetWorldTimerManager();
+    const double NowS = GetWorld()->GetTimeSeconds();
+    if (Marquee.ConsumeQuery(NowS))
     {
-        GetWorld()->GetTimerManager().SetTimer(MarqueeUpdateTimer, this,
-            &APACS_PlayerController::UpdateMarquee, 1.0f / MarqueeUpdateRate, true);
-        UE_LOG(LogTemp, Warning, TEXT("[MARQUEE DEBUG] Update timer started at %f Hz"), MarqueeUpdateRate);
+        TimerManager.ClearTimer(MarqueeUpdateTimer);
+        QueryActorsInMarquee();
+        return;
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("[MARQUEE DEBUG] Marquee selection STARTED"));
+    // Rect changed inside the rate window: query it when the window ends unless another move does first
+    const float Delay = Marquee.GetQueryDelay(NowS);
+    if (Delay >= 0.0f && !TimerManager.IsTimerActive(MarqueeUpdateTimer))
+    {
+        TimerManager.SetTimer(MarqueeUpdateTimer, this, &APACS_PlayerController::UpdateMarquee,
+            FMath::Max(Delay, 0.001f), false);
+    }
 }
 
-void APACS_PlayerController::UpdateMarquee()
+void APACS_PlayerController::ReleaseMarquee(const FVector2D& ViewportPos)
 {
-    if (!bIsMarqueeActive)
+    if (Marquee.IsDragging())
     {
-        return;
+        // Pick up the release position and any rect change still held back by the rate limit
+        Marquee.Move(ViewportPos);
+        if (Marquee.ConsumeQuery(GetWorld()->GetTimeSeconds(), true))
+        {
+            QueryActorsInMarquee();
+        }
+
+        // Finalize marquee selection
+        FinalizeMarquee();
+    }
+    else if (Marquee.GetState() == EPACS_MarqueeState::Pressed)
+    {
+        // Normal single-click selection
+        FHitResult HitResult;
+        if (GetHitResultAtScreenPosition(ViewportPos, SelectionTraceChannel, false, HitResult))
+        {
+            // Hits on instanced selection planes resolve to the NPC that owns the instance
+            const UPACS_SelectionPlaneManager* PlaneManager = GetWorld() ? GetWorld()->GetSubsystem<UPACS_SelectionPlaneManager>() : nullptr;
+            AActor* HitActor = PlaneManager ? PlaneManager->ResolveHitActor(HitResult) : HitResult.GetActor();
+
+            PACS_LOG_HOT(LogPACSSelection, Log, TEXT("Hit actor: %s at location %s"),
+                HitActor ? *HitActor->GetName() : TEXT("None"),
+                *HitResult.Location.ToString());
+
+            // Request selection of the actor (server will notify client to update NPCBehaviorComponent)
+            ServerRequestSelect(HitActor);
+        }
+        else
+        {
+            PACS_LOG_HOT(LogPACSSelection, Log, TEXT("No hit result - deselecting"));
+
+            // No hit - deselect (server will notify client to update NPCBehaviorComponent)
+            ServerRequestDeselect();
+        }
     }
 
-    QueryActorsInMarquee();
+    // Clear marquee state
+    ClearMarquee();
 }
 
 void APACS_PlayerController::FinalizeMarquee()
 {
-    if (!bIsMarqueeActive)
+    if (!Marquee.IsDragging())
     {
         return;
     }
@@ -1092,7 +1297,7 @@ void APACS_PlayerController::FinalizeMarquee()
     APACS_PlayerState* PS = GetPlayerState<APACS_PlayerState>();
     if (!PS)
     {
-        UE_LOG(LogTemp, Warning, TEXT("[MARQUEE DEBUG] No PlayerState available"));
+        UE_LOG(LogPACSSelection, Warning, TEXT("Marquee: no PlayerState, selection dropped"));
         return;
     }
 
@@ -1101,8 +1306,6 @@ void APACS_PlayerController::FinalizeMarquee()
     if (NPCBehaviorComponent)
     {
         ActorsToSelect = NPCBehaviorComponent->GetSelectedNPCs();
-        UE_LOG(LogTemp, Warning, TEXT("[MARQUEE DEBUG] Starting with %d existing selections from NPCBehaviorComponent"),
-            ActorsToSelect.Num());
     }
     int32 PreviouslySelectedCount = ActorsToSelect.Num();
 
@@ -1136,14 +1339,14 @@ void APACS_PlayerController::FinalizeMarquee()
     if (ActorsToSelect.Num() > 0)
     {
         ServerRequestSelectMultiple(ActorsToSelect);
-        UE_LOG(LogTemp, Log, TEXT("[MARQUEE DEBUG] Marquee selection finalized: %d total actors (%d previous + %d new)"),
+        PACS_LOG_HOT(LogPACSSelection, Log, TEXT("Marquee: finalized %d actors (%d previous + %d new)"),
             ActorsToSelect.Num(), PreviouslySelectedCount, ActorsToSelect.Num() - PreviouslySelectedCount);
     }
     else
     {
         // If no valid actors, just deselect all
         ServerRequestDeselect();
-        UE_LOG(LogTemp, Log, TEXT("[MARQUEE DEBUG] Marquee selection finalized: No valid actors to select"));
+        PACS_LOG_HOT(LogPACSSelection, Log, TEXT("Marquee: finalized with no valid actors - deselecting"));
     }
 }
 
@@ -1161,15 +1364,10 @@ void APACS_PlayerController::ClearMarquee()
         }
     }
 
-    // Clear state
+    // Clear state; stops the mouse-move events and the held-back query timer
     MarqueeHoveredActors.Empty();
-    MarqueeStartPos = FVector2D::ZeroVector;
-    MarqueeCurrentPos = FVector2D::ZeroVector;
-    bIsMarqueeActive = false;
-    bLeftMousePressed = false;
-
-    // Stop update timer
-    GetWorld()->GetTimerManager().ClearTimer(MarqueeUpdateTimer);
+    Marquee.Reset();
+    EndMarqueePress();
 
     // Re-enable systems
     if (EdgeScrollComponent)
@@ -1185,20 +1383,15 @@ void APACS_PlayerController::ClearMarquee()
 
 void APACS_PlayerController::QueryActorsInMarquee()
 {
-    if (!bIsMarqueeActive)
+    if (!Marquee.IsDragging())
     {
         return;
     }
 
     // Build screen rectangle
-    const FVector2D MinPoint(
-        FMath::Min(MarqueeStartPos.X, MarqueeCurrentPos.X),
-        FMath::Min(MarqueeStartPos.Y, MarqueeCurrentPos.Y)
-    );
-    const FVector2D MaxPoint(
-        FMath::Max(MarqueeStartPos.X, MarqueeCurrentPos.X),
-        FMath::Max(MarqueeStartPos.Y, MarqueeCurrentPos.Y)
-    );
+    FVector2D MinPoint;
+    FVector2D MaxPoint;
+    Marquee.GetRect(MinPoint, MaxPoint);
 
     // Clear previous hover states
     for (const TWeakObjectPtr<AActor>& ActorPtr : MarqueeHoveredActors)
@@ -1932,4 +2125,4 @@ void APACS_PlayerController::DestroySpawnUI()
         SpawnUIWidget = nullptr;
         UE_LOG(LogTemp, Log, TEXT("PACS_PlayerController: Spawn UI widget destroyed"));
     }
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -1 +1,73 @@
-#include "Data/Configs/PACS_CandidateHelicopterData.h"
\ No newline at end of file
+#include "Data/Configs/PACS_CandidateHelicopterData.h"
+
+void UPACS_CandidateHelicopterData::PostLoad()
+{
+    Super::PostLoad();
+
+    // Referenced curves are not guaranteed to have finished loading before this asset's PostLoad
+    for (UCurveFloat* Curve : { CenterInterp.Get(), AltInterp.Get(), RadiusInterp.Get(), SpeedInterp.Get() })
+    {
+        if (Curve) Curve->ConditionalPostLoad();
+    }
+    BakeCurveLUTs();
+}
+
+#if WITH_EDITOR
+void UPACS_CandidateHelicopterData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+    BakeCurveLUTs();
+}
+#endif
+
+const UCurveFloat* UPACS_CandidateHelicopterData::GetOrbitCurve(EPACS_OrbitCurve Which) const
+{
+    switch (Which)
+    {
+    case EPACS_OrbitCurve::Center: return CenterInterp;
+    case EPACS_OrbitCurve::Alt:    return AltInterp;
+    case EPACS_OrbitCurve::Radius: return RadiusInterp;
+    case EPACS_OrbitCurve::Speed:  return SpeedInterp;
+    }
+    return nullptr;
+}
+
+void UPACS_CandidateHelicopterData::BakeCurveLUTs()
+{
+    for (int32 i = 0; i < UE_ARRAY_COUNT(LUTs); ++i)
+    {
+        LUTs[i].Bake(GetOrbitCurve((EPACS_OrbitCurve)i), CurveLUTSamples);
+    }
+}
+
+void UPACS_CandidateHelicopterData::PrepareCurveLUTs() const
+{
+    if (!bUseCurveLUTs) return;
+    for (int32 i = 0; i < UE_ARRAY_COUNT(LUTs); ++i)
+    {
+        const UCurveFloat* Curve = GetOrbitCurve((EPACS_OrbitCurve)i);
+        if (Curve && !LUTs[i].IsBakedFrom(Curve))
+        {
+            LUTs[i].Bake(Curve, CurveLUTSamples);
+        }
+    }
+}
+
+float UPACS_CandidateHelicopterData::EvalOrbitCurve01(EPACS_OrbitCurve Which, float T) const
+{
+    const UCurveFloat* Curve = GetOrbitCurve(Which);
+    if (!Curve) return T;
+    if (!bUseCurveLUTs) return Curve->GetFloatValue(T);
+
+    // Curve keys can only change under the editor, so cooked builds skip the key hash per eval
+    FPACS_CurveLUT& LUT = LUTs[(int32)Which];
+#if WITH_EDITOR
+    if (!LUT.IsBakedFrom(Curve))
+#else
+    if (!LUT.HasSource(Curve))
+#endif
+    {
+        LUT.Bake(Curve, CurveLUTSamples);
+    }
+    return LUT.Eval(T);
+}
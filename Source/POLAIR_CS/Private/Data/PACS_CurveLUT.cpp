@@ -0,0 +1,46 @@
+#include "Data/PACS_CurveLUT.h"
+#include "Curves/CurveFloat.h"
+
+void FPACS_CurveLUT::Bake(const UCurveFloat* Curve, int32 NumSamples)
+{
+    Reset();
+    if (!Curve) return;
+
+    NumSamples = FMath::Max(NumSamples, 2);
+    Samples.SetNumUninitialized(NumSamples);
+    for (int32 i = 0; i < NumSamples; ++i)
+    {
+        Samples[i] = Curve->GetFloatValue(float(i) / float(NumSamples - 1));
+    }
+    StepScale = float(NumSamples - 1);
+    Source = Curve;
+    KeyHash = HashCurve(Curve);
+}
+
+uint32 FPACS_CurveLUT::HashCurve(const UCurveFloat* Curve)
+{
+    if (!Curve) return 0;
+
+    const FRichCurve& Rich = Curve->FloatCurve;
+    uint32 Hash = HashCombine(GetTypeHash(Rich.DefaultValue), GetTypeHash(uint8(Rich.PreInfinityExtrap)));
+    Hash = HashCombine(Hash, GetTypeHash(uint8(Rich.PostInfinityExtrap)));
+    for (const FRichCurveKey& Key : Rich.GetConstRefOfKeys())
+    {
+        Hash = HashCombine(Hash, GetTypeHash(Key.Time));
+        Hash = HashCombine(Hash, GetTypeHash(Key.Value));
+        Hash = HashCombine(Hash, GetTypeHash(Key.ArriveTangent));
+        Hash = HashCombine(Hash, GetTypeHash(Key.LeaveTangent));
+        Hash = HashCombine(Hash, GetTypeHash(Key.ArriveTangentWeight));
+        Hash = HashCombine(Hash, GetTypeHash(Key.LeaveTangentWeight));
+        Hash = HashCombine(Hash, GetTypeHash(uint32(Key.InterpMode) | uint32(Key.TangentMode) << 8 | uint32(Key.TangentWeightMode) << 16));
+    }
+    return Hash;
+}
+
+void FPACS_CurveLUT::Reset()
+{
+    Samples.Reset();
+    StepScale = 0.f;
+    Source.Reset();
+    KeyHash = 0;
+}
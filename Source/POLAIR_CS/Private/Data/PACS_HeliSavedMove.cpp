@@ -18,4 +18,15 @@ void FSavedMove_HeliOrbit::SetMoveFor(ACharacter* C, float InDeltaTime, const FV
 void FSavedMove_HeliOrbit::PrepMoveFor(ACharacter* C)
 {
     FSavedMove_Character::PrepMoveFor(C);
+}
+
+FNetworkPredictionData_Client_HeliOrbit::FNetworkPredictionData_Client_HeliOrbit(const UCharacterMovementComponent& ClientMovement)
+: FNetworkPredictionData_Client_Character(ClientMovement)
+{
+    const int32 Prewarm = FMath::Min<int32>(PrewarmMoveCount, MaxFreeMoveCount);
+    FreeMoves.Reserve(MaxFreeMoveCount);
+    for (int32 i = 0; i < Prewarm; ++i)
+    {
+        FreeMoves.Add(FNetworkPredictionData_Client_HeliOrbit::AllocateNewMove());
+    }
 }
\ No newline at end of file
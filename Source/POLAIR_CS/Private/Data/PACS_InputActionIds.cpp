@@ -0,0 +1,65 @@
+#include "Data/PACS_InputActionIds.h"
+
+namespace
+{
+    struct FRegistryStorage
+    {
+        TMap<FName, uint16> IdByName;
+        TArray<FName> NameById = { NAME_None };   // slot 0 = InvalidId
+    };
+
+    // Function-local so native actions in any translation unit can register during static init
+    FRegistryStorage& GetStorage()
+    {
+        static FRegistryStorage Storage;
+        return Storage;
+    }
+}
+
+uint16 FPACS_InputActionRegistry::FindOrAdd(FName Identifier)
+{
+    if (Identifier.IsNone())
+    {
+        return InvalidId;
+    }
+
+    FRegistryStorage& Storage = GetStorage();
+    if (const uint16* Existing = Storage.IdByName.Find(Identifier))
+    {
+        return *Existing;
+    }
+
+    if (!ensureMsgf(Storage.NameById.Num() <= MAX_uint16, TEXT("Input action ID space exhausted")))
+    {
+        return InvalidId;
+    }
+
+    const uint16 Id = (uint16)Storage.NameById.Add(Identifier);
+    Storage.IdByName.Add(Identifier, Id);
+    return Id;
+}
+
+uint16 FPACS_InputActionRegistry::Find(FName Identifier)
+{
+    const uint16* Existing = GetStorage().IdByName.Find(Identifier);
+    return Existing ? *Existing : InvalidId;
+}
+
+FName FPACS_InputActionRegistry::GetName(uint16 Id)
+{
+    const FRegistryStorage& Storage = GetStorage();
+    return Storage.NameById.IsValidIndex(Id) ? Storage.NameById[Id] : NAME_None;
+}
+
+int32 FPACS_InputActionRegistry::GetTableSize()
+{
+    return GetStorage().NameById.Num();
+}
+
+// Defined in list order in this one translation unit, so the native IDs are 1..N in that order
+namespace PACS_InputActions
+{
+#define PACS_DEFINE_NATIVE_INPUT_ACTION(Symbol, Identifier) const FPACS_NativeInputAction Symbol(TEXT(Identifier));
+    PACS_NATIVE_INPUT_ACTIONS(PACS_DEFINE_NATIVE_INPUT_ACTION)
+#undef PACS_DEFINE_NATIVE_INPUT_ACTION
+}
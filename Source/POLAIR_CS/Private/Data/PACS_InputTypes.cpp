@@ -0,0 +1,26 @@
+#include "Data/PACS_InputTypes.h"
+
+FPACS_InputContextDiff FPACS_InputContextDiff::Compute(const TMap<TObjectPtr<UInputMappingContext>, int32>& Applied,
+    const TMap<TObjectPtr<UInputMappingContext>, int32>& Desired)
+{
+    FPACS_InputContextDiff Diff;
+
+    for (const TPair<TObjectPtr<UInputMappingContext>, int32>& Pair : Applied)
+    {
+        if (Pair.Key && !Desired.Contains(Pair.Key))
+        {
+            Diff.Removes.Add(Pair.Key);
+        }
+    }
+
+    for (const TPair<TObjectPtr<UInputMappingContext>, int32>& Pair : Desired)
+    {
+        const int32* AppliedPriority = Applied.Find(Pair.Key);
+        if (!AppliedPriority || *AppliedPriority != Pair.Value)
+        {
+            Diff.Adds.Emplace(Pair.Key, Pair.Value);
+        }
+    }
+
+    return Diff;
+}
@@ -0,0 +1,42 @@
+#include "Data/PACS_OrbitMessages.h"
+
+void FPACS_OrbitEdit::MergeFrom(const FPACS_OrbitEdit& Later)
+{
+    if (Later.bHasCenter) { bHasCenter = true; NewCenterCm = Later.NewCenterCm; DurCenterS = Later.DurCenterS; }
+    if (Later.bHasAlt)    { bHasAlt    = true; NewAltCm    = Later.NewAltCm;    DurAltS    = Later.DurAltS;    }
+    if (Later.bHasRadius) { bHasRadius = true; NewRadiusCm = Later.NewRadiusCm; DurRadiusS = Later.DurRadiusS; }
+    if (Later.bHasSpeed)  { bHasSpeed  = true; NewSpeedCms = Later.NewSpeedCms; DurSpeedS  = Later.DurSpeedS;  }
+    AnchorPolicy  = Later.AnchorPolicy;
+    if (IsNewerTransaction(Later.TransactionId, TransactionId)) TransactionId = Later.TransactionId;
+}
+
+void FPACS_OrbitEditAccumulator::Add(const FPACS_OrbitEdit& Edit)
+{
+    if (!bPending)
+    {
+        Pending  = Edit;
+        bPending = true;
+        return;
+    }
+    Pending.MergeFrom(Edit);
+}
+
+double FPACS_OrbitEditAccumulator::GetSendDelay(double NowS, float MaxPerSecond) const
+{
+    if (MaxPerSecond <= 0.f) return 0.0;
+    return FMath::Max(0.0, (LastSendS + 1.0 / MaxPerSecond) - NowS);
+}
+
+FPACS_OrbitEdit FPACS_OrbitEditAccumulator::Consume(double NowS)
+{
+    FPACS_OrbitEdit Out = Pending;
+
+    // Zero is "never applied" on the server, so skip it on wrap
+    if (++LastTransactionId == 0) ++LastTransactionId;
+    Out.TransactionId = LastTransactionId;
+
+    Pending   = FPACS_OrbitEdit();
+    bPending  = false;
+    LastSendS = NowS;
+    return Out;
+}
@@ -0,0 +1,95 @@
+#include "Data/PACS_SignificanceViewpoints.h"
+#include "Actors/Pawn/PACS_CandidateHelicopterCharacter.h"
+#include "Components/PACS_HeliMovementComponent.h"
+#include "Settings/PACS_NetPerfSettings.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+
+FPACS_HeliViewParams FPACS_HeliViewParams::FromSettings()
+{
+    FPACS_HeliViewParams Out;
+    if (const UPACS_NetPerfSettings* Settings = UPACS_NetPerfSettings::Get())
+    {
+        Out.LookAheadS = Settings->HeliViewLookAheadS;
+        Out.LookAheadSamples = Settings->HeliViewLookAheadSamples;
+        Out.ArcWeight = Settings->HeliViewArcWeight;
+    }
+    return Out;
+}
+
+float FPACS_SignificanceViewpoints::GetWeight(const FTransform& Viewpoint)
+{
+    return FMath::Max(float(Viewpoint.GetScale3D().X), KINDA_SMALL_NUMBER);
+}
+
+float FPACS_SignificanceViewpoints::WeightedDistance(const FVector& Location, const FTransform& Viewpoint)
+{
+    return FVector::Dist(Location, Viewpoint.GetLocation()) / GetWeight(Viewpoint);
+}
+
+float FPACS_SignificanceViewpoints::DistanceSignificance(const FVector& Location, const FTransform& Viewpoint)
+{
+    return 1.f / (1.f + WeightedDistance(Location, Viewpoint) * 0.001f);
+}
+
+void FPACS_SignificanceViewpoints::BuildHeliViewpoints(const FTransform& HMDPose, const FPACS_OrbitTargets& Targets, float AngleRad,
+                                                       const FPACS_HeliViewParams& Params, TArray<FTransform>& Out)
+{
+    Out.Add(FTransform(HMDPose.GetRotation(), HMDPose.GetLocation()));
+
+    const float GroundZ = Targets.CenterCm.Z;
+
+    // Looking down at altitude: the ground under the gaze matters more than the distance to the head
+    const FVector Eye = HMDPose.GetLocation();
+    const FVector Forward = HMDPose.GetRotation().GetForwardVector();
+    if (Forward.Z < -KINDA_SMALL_NUMBER && Eye.Z > GroundZ)
+    {
+        const float T = (GroundZ - Eye.Z) / Forward.Z;
+        Out.Add(FTransform(Eye + Forward * T));
+    }
+
+    // Upcoming arc at ground level; same angle convention as UPACS_HeliMovementComponent::OrbitPositionAt
+    const int32 Samples = FMath::Max(Params.LookAheadSamples, 0);
+    if (Samples == 0 || Targets.RadiusCm <= 1.f || Targets.SpeedCms <= KINDA_SMALL_NUMBER)
+    {
+        return;
+    }
+
+    const float Omega = Targets.SpeedCms / Targets.RadiusCm;
+    for (int32 i = 1; i <= Samples; ++i)
+    {
+        const float Alpha = float(i) / Samples;
+        const float Angle = AngleRad + Omega * Params.LookAheadS * Alpha;
+        const FVector Point = UPACS_HeliMovementComponent::OrbitPositionAt(Targets.CenterCm, Targets.RadiusCm, Angle, GroundZ);
+        const float Weight = FMath::Lerp(FMath::Max(Params.ArcWeight, 1.0f), 1.0f, Samples > 1 ? float(i - 1) / (Samples - 1) : 0.f);
+        Out.Add(FTransform(FQuat::Identity, Point, FVector(Weight)));
+    }
+}
+
+void FPACS_SignificanceViewpoints::GatherLocal(const UWorld* World, TArray<FTransform>& Out)
+{
+    if (!World)
+    {
+        return;
+    }
+
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PC = It->Get();
+        if (!PC || !PC->IsLocalController())
+        {
+            continue;
+        }
+
+        if (const APACS_CandidateHelicopterCharacter* Heli = Cast<APACS_CandidateHelicopterCharacter>(PC->GetPawn()))
+        {
+            Heli->GetSignificanceViewpoints(Out);
+            continue;
+        }
+
+        FVector ViewLocation;
+        FRotator ViewRotation;
+        PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+        Out.Add(FTransform(ViewRotation, ViewLocation));
+    }
+}
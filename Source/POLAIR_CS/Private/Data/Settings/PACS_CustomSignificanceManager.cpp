@@ -3,6 +3,94 @@
 #include "Data/Settings/PACS_CustomSignificanceManager.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Components/SceneComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/PACS_SelectionPlaneComponent.h"
+#include "Interfaces/PACS_SelectableCharacterInterface.h"
+#include "Settings/PACS_NetPerfSettings.h"
+#include "Data/PACS_SignificanceViewpoints.h"
+
+DECLARE_CYCLE_STAT(TEXT("Significance Budgeted Update"), STAT_PACSSignificance_Update, STATGROUP_Game);
+
+const FName UPACS_CustomSignificanceManager::NPCTag(TEXT("PACS.NPC"));
+
+FPACS_NPCThrottleParams FPACS_NPCThrottleParams::FromSettings()
+{
+    FPACS_NPCThrottleParams Out;
+    if (const UPACS_NetPerfSettings* Settings = UPACS_NetPerfSettings::Get())
+    {
+        Out.bEnabled = Settings->bThrottleNPCTicks;
+        Out.NearDistanceCm = Settings->NPCNearDistanceCm;
+        Out.MidDistanceCm = Settings->NPCMidDistanceCm;
+        Out.FarDistanceCm = Settings->NPCFarDistanceCm;
+        Out.MidTickRate = Settings->NPCMidTickRate;
+        Out.FarTickRate = Settings->NPCFarTickRate;
+        Out.DistantTickRate = Settings->NPCDistantTickRate;
+    }
+    return Out;
+}
+
+FPACS_NPCTickSettings FPACS_NPCTickSettings::Capture(const ACharacter* Character)
+{
+    FPACS_NPCTickSettings Out;
+    if (!Character)
+    {
+        return Out;
+    }
+
+    Out.ActorTickInterval = Character->GetActorTickInterval();
+    if (const UCharacterMovementComponent* Movement = Character->GetCharacterMovement())
+    {
+        Out.MovementTickInterval = Movement->GetComponentTickInterval();
+        Out.SmoothingMode = Movement->NetworkSmoothingMode;
+    }
+    if (const USkeletalMeshComponent* Mesh = Character->GetMesh())
+    {
+        Out.MeshTickInterval = Mesh->GetComponentTickInterval();
+        Out.AnimTickOption = Mesh->VisibilityBasedAnimTickOption;
+        Out.bUpdateRateOptimizations = Mesh->bEnableUpdateRateOptimizations;
+    }
+    if (const UPACS_SelectionPlaneComponent* Plane = Character->FindComponentByClass<UPACS_SelectionPlaneComponent>())
+    {
+        Out.SelectionPlaneInterval = Plane->GetMinUpdateInterval();
+    }
+    return Out;
+}
+
+namespace
+{
+    // Where an object sits for distance bucketing; objects without a location never change bucket
+    bool GetSignificanceLocation(const UObject* Object, FVector& OutLocation)
+    {
+        if (const AActor* Actor = Cast<AActor>(Object))
+        {
+            OutLocation = Actor->GetActorLocation();
+            return true;
+        }
+        if (const USceneComponent* Component = Cast<USceneComponent>(Object))
+        {
+            OutLocation = Component->GetComponentLocation();
+            return true;
+        }
+        return false;
+    }
+
+    // Higher ticks less when not rendered; INDEX_NONE for options the bands don't rank
+    int32 GetAnimTickRank(EVisibilityBasedAnimTickOption Option)
+    {
+        switch (Option)
+        {
+        case EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones: return 0;
+        case EVisibilityBasedAnimTickOption::AlwaysTickPose: return 1;
+        case EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered: return 2;
+        case EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered: return 3;
+        default: return INDEX_NONE;
+        }
+    }
+}
 
 UPACS_CustomSignificanceManager::UPACS_CustomSignificanceManager()
 {
@@ -20,6 +108,408 @@ UPACS_CustomSignificanceManager::UPACS_CustomSignificanceManager()
     UE_LOG(LogTemp, Log, TEXT("PACS_CustomSignificanceManager: Configured for client-side creation"));
 }
 
+bool UPACS_CustomSignificanceManager::UpdateOncePerFrame(TArrayView<const FTransform> Viewpoints)
+{
+    if (LastUpdateFrame == GFrameCounter)
+    {
+        return false;
+    }
+
+    LastUpdateFrame = GFrameCounter;
+    Update(Viewpoints);
+    return true;
+}
+
+void UPACS_CustomSignificanceManager::RegisterObject(UObject* Object, FName Tag, FSignificanceFunction SignificanceFunction,
+    EPostSignificanceType InPostSignificanceType, FPostSignificanceFunction InPostSignificanceFunction)
+{
+    if (!Object)
+    {
+        return;
+    }
+
+    if (const int32* Existing = SlotIndexByObject.Find(Object))
+    {
+        // Unregistered through the base since; the slot is stale, so register afresh
+        if (GetManagedObject(Object))
+        {
+            return;
+        }
+        RemoveSlotAt(*Existing);
+    }
+
+    TSharedRef<FPACS_SignificanceSlot> Slot = MakeShared<FPACS_SignificanceSlot>();
+    Slot->Object = Object;
+    Slot->Score = MoveTemp(SignificanceFunction);
+    SlotIndexByObject.Add(Object, Slots.Add(Slot));
+
+    // Base Update may run this on worker threads; each slot is only touched by its own object
+    Super::RegisterObject(Object, Tag,
+        [Slot](FManagedObjectInfo* Info, const FTransform& Viewpoint)
+        {
+            return Slot->bDue ? Slot->Score(Info, Viewpoint) : Slot->Significance;
+        },
+        InPostSignificanceType, MoveTemp(InPostSignificanceFunction));
+}
+
+void UPACS_CustomSignificanceManager::UnregisterObject(UObject* Object)
+{
+    if (const int32* Index = SlotIndexByObject.Find(Object))
+    {
+        RemoveSlotAt(*Index);
+    }
+
+    Super::UnregisterObject(Object);
+}
+
+void UPACS_CustomSignificanceManager::RemoveSlotAt(int32 Index)
+{
+    SlotIndexByObject.Remove(Slots[Index]->Object);
+    Slots.RemoveAtSwap(Index);
+    if (Slots.IsValidIndex(Index))
+    {
+        SlotIndexByObject.Add(Slots[Index]->Object, Index);
+    }
+    if (RoundRobinCursor >= Slots.Num())
+    {
+        RoundRobinCursor = 0;
+    }
+}
+
+void UPACS_CustomSignificanceManager::MarkDirty(UObject* Object)
+{
+    if (const int32* Index = SlotIndexByObject.Find(Object))
+    {
+        Slots[*Index]->bDue = true;
+    }
+}
+
+void UPACS_CustomSignificanceManager::RegisterNPC(ACharacter* Character)
+{
+    if (!Character)
+    {
+        return;
+    }
+
+    NPCParams = FPACS_NPCThrottleParams::FromSettings();
+    const FPACS_NPCThrottleParams Params = NPCParams;
+
+    // Blueprint-authored settings are what Near and Full go back to
+    if (!OriginalNPCSettings.Contains(Character))
+    {
+        OriginalNPCSettings.Add(Character, FPACS_NPCTickSettings::Capture(Character));
+    }
+
+    RegisterObject(Character, NPCTag,
+        [Params](FManagedObjectInfo* Info, const FTransform& Viewpoint)
+        {
+            return float(ComputeNPCBand(Cast<ACharacter>(Info->GetObject()), Viewpoint, Params));
+        },
+        EPostSignificanceType::Sequential,
+        [this](FManagedObjectInfo* Info, float OldSignificance, float Significance, bool bFinal)
+        {
+            const int32 Band = FMath::Clamp(FMath::RoundToInt(Significance), 0, int32(EPACS_NPCSignificanceBand::Full));
+            ApplyNPCBand(Cast<ACharacter>(Info->GetObject()), EPACS_NPCSignificanceBand(Band));
+        });
+}
+
+void UPACS_CustomSignificanceManager::UnregisterNPC(ACharacter* Character)
+{
+    FPACS_NPCTickSettings Original;
+    if (OriginalNPCSettings.RemoveAndCopyValue(Character, Original) && AppliedNPCBands.Contains(Character))
+    {
+        ApplyNPCTickSettings(Character, Original);
+    }
+    AppliedNPCBands.Remove(Character);
+    UnregisterObject(Character);
+}
+
+void UPACS_CustomSignificanceManager::RefreshNPC(ACharacter* Character)
+{
+    if (!Character || !SlotIndexByObject.Contains(Character))
+    {
+        return;
+    }
+
+    // Going to full rate can't wait for the next Update; leaving it can
+    if (ComputeNPCBand(Character, FTransform::Identity, NPCParams) == EPACS_NPCSignificanceBand::Full)
+    {
+        ApplyNPCBand(Character, EPACS_NPCSignificanceBand::Full);
+    }
+    MarkDirty(Character);
+}
+
+EPACS_NPCSignificanceBand UPACS_CustomSignificanceManager::GetNPCBand(const ACharacter* Character) const
+{
+    const EPACS_NPCSignificanceBand* Band = AppliedNPCBands.Find(Character);
+    return Band ? *Band : EPACS_NPCSignificanceBand::Near;
+}
+
+void UPACS_CustomSignificanceManager::ApplyNPCBand(ACharacter* Character, EPACS_NPCSignificanceBand Band)
+{
+    if (!Character)
+    {
+        return;
+    }
+
+    // The post callback runs every Update; only touch the components when the band changes
+    const EPACS_NPCSignificanceBand* Applied = AppliedNPCBands.Find(Character);
+    if (Applied && *Applied == Band)
+    {
+        return;
+    }
+    AppliedNPCBands.Add(Character, Band);
+
+    const FPACS_NPCTickSettings* Original = OriginalNPCSettings.Find(Character);
+    ApplyNPCTickSettings(Character, GetNPCTickSettings(Band, NPCParams, Original ? *Original : FPACS_NPCTickSettings::Capture(Character)));
+}
+
+EPACS_NPCSignificanceBand UPACS_CustomSignificanceManager::ComputeNPCBand(const ACharacter* Character, const FTransform& Viewpoint, const FPACS_NPCThrottleParams& Params)
+{
+    if (!Character)
+    {
+        return EPACS_NPCSignificanceBand::Distant;
+    }
+
+    if (const IPACS_SelectableCharacterInterface* Selectable = Cast<IPACS_SelectableCharacterInterface>(Character))
+    {
+        if (Selectable->GetCurrentSelector() || Selectable->IsLocallyHovered())
+        {
+            return EPACS_NPCSignificanceBand::Full;
+        }
+    }
+
+    return GetBandForDistance(FPACS_SignificanceViewpoints::WeightedDistance(Character->GetActorLocation(), Viewpoint), Params);
+}
+
+EPACS_NPCSignificanceBand UPACS_CustomSignificanceManager::GetBandForDistance(float DistanceCm, const FPACS_NPCThrottleParams& Params)
+{
+    if (!Params.bEnabled || DistanceCm < Params.NearDistanceCm)
+    {
+        return EPACS_NPCSignificanceBand::Near;
+    }
+    if (DistanceCm < Params.MidDistanceCm)
+    {
+        return EPACS_NPCSignificanceBand::Mid;
+    }
+    if (DistanceCm < Params.FarDistanceCm)
+    {
+        return EPACS_NPCSignificanceBand::Far;
+    }
+    return EPACS_NPCSignificanceBand::Distant;
+}
+
+FPACS_NPCTickSettings UPACS_CustomSignificanceManager::GetNPCTickSettings(EPACS_NPCSignificanceBand Band, const FPACS_NPCThrottleParams& Params,
+    const FPACS_NPCTickSettings& Original)
+{
+    if (!Params.bEnabled)
+    {
+        return Original;
+    }
+
+    float Interval = 0.f;
+    EVisibilityBasedAnimTickOption AnimTickOption = Original.AnimTickOption;
+    ENetworkSmoothingMode SmoothingMode = Original.SmoothingMode;
+    switch (Band)
+    {
+    case EPACS_NPCSignificanceBand::Mid:
+        Interval = 1.f / FMath::Max(Params.MidTickRate, 0.1f);
+        AnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPose;
+        break;
+    case EPACS_NPCSignificanceBand::Far:
+        Interval = 1.f / FMath::Max(Params.FarTickRate, 0.1f);
+        AnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+        SmoothingMode = ENetworkSmoothingMode::Linear;
+        break;
+    case EPACS_NPCSignificanceBand::Distant:
+        Interval = 1.f / FMath::Max(Params.DistantTickRate, 0.1f);
+        AnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
+        SmoothingMode = ENetworkSmoothingMode::Disabled;
+        break;
+    default:
+        // Near and Full restore the NPC's own settings
+        return Original;
+    }
+
+    // Throttling only ever makes things cheaper than the NPC was authored with
+    FPACS_NPCTickSettings Out = Original;
+    Out.ActorTickInterval = FMath::Max(Original.ActorTickInterval, Interval);
+    Out.MeshTickInterval = FMath::Max(Original.MeshTickInterval, Interval);
+    Out.MovementTickInterval = FMath::Max(Original.MovementTickInterval, Interval);
+    Out.SelectionPlaneInterval = FMath::Max(Original.SelectionPlaneInterval, Interval);
+    const int32 OriginalAnimRank = GetAnimTickRank(Original.AnimTickOption);
+    if (OriginalAnimRank != INDEX_NONE && GetAnimTickRank(AnimTickOption) > OriginalAnimRank)
+    {
+        Out.AnimTickOption = AnimTickOption;
+    }
+    // Disabled < Linear < Exponential
+    if (uint8(SmoothingMode) < uint8(Original.SmoothingMode))
+    {
+        Out.SmoothingMode = SmoothingMode;
+    }
+    Out.bUpdateRateOptimizations = true;
+    return Out;
+}
+
+void UPACS_CustomSignificanceManager::ApplyNPCTickSettings(ACharacter* Character, const FPACS_NPCTickSettings& Settings)
+{
+    if (!Character)
+    {
+        return;
+    }
+
+    // Authority runs AI and movement simulation; only proxies are cosmetic
+    const bool bSimulatedProxy = Character->GetLocalRole() == ROLE_SimulatedProxy;
+    if (bSimulatedProxy)
+    {
+        Character->SetActorTickInterval(Settings.ActorTickInterval);
+
+        if (UCharacterMovementComponent* Movement = Character->GetCharacterMovement())
+        {
+            Movement->SetComponentTickInterval(Settings.MovementTickInterval);
+            Movement->NetworkSmoothingMode = Settings.SmoothingMode;
+        }
+    }
+
+    if (USkeletalMeshComponent* Mesh = Character->GetMesh())
+    {
+        Mesh->SetComponentTickInterval(Settings.MeshTickInterval);
+        Mesh->VisibilityBasedAnimTickOption = Settings.AnimTickOption;
+        Mesh->bEnableUpdateRateOptimizations = Settings.bUpdateRateOptimizations;
+    }
+
+    if (UPACS_SelectionPlaneComponent* Plane = Character->FindComponentByClass<UPACS_SelectionPlaneComponent>())
+    {
+        Plane->SetMinUpdateInterval(Settings.SelectionPlaneInterval);
+    }
+}
+
+void UPACS_CustomSignificanceManager::SetUpdateBudget(int32 InMaxObjectsToProcessPerFrame, float InUpdateFrequency)
+{
+    MaxObjectsToProcessPerFrame = InMaxObjectsToProcessPerFrame;
+    UpdateFrequency = InUpdateFrequency;
+    LastSliceTime = -1.0;
+}
+
+int32 UPACS_CustomSignificanceManager::GetDistanceBucket(float DistanceCm) const
+{
+    const float BucketCm = FMath::Max(DistanceBucketCm, 1.0f);
+    const int32 LastBucket = FMath::CeilToInt(MaximumDistance / BucketCm);
+    return FMath::Min(FMath::FloorToInt(FMath::Max(DistanceCm, 0.0f) / BucketCm), LastBucket);
+}
+
+int32 UPACS_CustomSignificanceManager::MarkBucketChanges(TArrayView<const FTransform> Viewpoints)
+{
+    // Objects that were destroyed, or unregistered through the base class, leave a slot behind
+    for (int32 Index = Slots.Num() - 1; Index >= 0; --Index)
+    {
+        UObject* Object = Slots[Index]->Object.ResolveObjectPtr();
+        if (!Object || !GetManagedObject(Object))
+        {
+            RemoveSlotAt(Index);
+        }
+    }
+
+    if (Viewpoints.Num() == 0)
+    {
+        return 0;
+    }
+
+    int32 Marked = 0;
+    for (const TSharedRef<FPACS_SignificanceSlot>& Slot : Slots)
+    {
+        FVector Location;
+        if (!GetSignificanceLocation(Slot->Object.ResolveObjectPtr(), Location))
+        {
+            continue;
+        }
+
+        float MinDistance = TNumericLimits<float>::Max();
+        for (const FTransform& Viewpoint : Viewpoints)
+        {
+            MinDistance = FMath::Min(MinDistance, FPACS_SignificanceViewpoints::WeightedDistance(Location, Viewpoint));
+        }
+
+        const int32 Bucket = GetDistanceBucket(MinDistance);
+        if (Bucket != Slot->DistanceBucket)
+        {
+            // A fresh registration has no bucket yet and is already due; don't count it as a change
+            Marked += (Slot->bDue || Slot->DistanceBucket == INDEX_NONE) ? 0 : 1;
+            Slot->DistanceBucket = Bucket;
+            Slot->bDue = true;
+        }
+    }
+    return Marked;
+}
+
+int32 UPACS_CustomSignificanceManager::MarkRoundRobinSlice()
+{
+    if (Slots.Num() == 0)
+    {
+        return 0;
+    }
+
+    if (UpdateFrequency > 0.f)
+    {
+        const UWorld* World = Cast<UWorld>(GetOuter());
+        const double NowS = World ? World->GetTimeSeconds() : FPlatformTime::Seconds();
+        if (LastSliceTime >= 0.0 && NowS - LastSliceTime < UpdateFrequency)
+        {
+            return 0;
+        }
+        LastSliceTime = NowS;
+    }
+
+    const int32 SliceCount = MaxObjectsToProcessPerFrame > 0 ? FMath::Min(MaxObjectsToProcessPerFrame, Slots.Num()) : Slots.Num();
+    for (int32 i = 0; i < SliceCount; ++i)
+    {
+        Slots[(RoundRobinCursor + i) % Slots.Num()]->bDue = true;
+    }
+    RoundRobinCursor = (RoundRobinCursor + SliceCount) % Slots.Num();
+    return SliceCount;
+}
+
+void UPACS_CustomSignificanceManager::Update(TArrayView<const FTransform> Viewpoints)
+{
+    SCOPE_CYCLE_COUNTER(STAT_PACSSignificance_Update);
+
+    LastBucketRescoreCount = MarkBucketChanges(Viewpoints);
+    MarkRoundRobinSlice();
+
+#if DO_ENSURE
+    // Anything registered through the base class escapes the budget
+    TArray<FManagedObjectInfo*> BaseObjects;
+    GetManagedObjects(BaseObjects);
+    ensureMsgf(BaseObjects.Num() == Slots.Num(),
+        TEXT("PACS_CustomSignificanceManager: %d managed objects but %d budget slots; register through UPACS_CustomSignificanceManager"),
+        BaseObjects.Num(), Slots.Num());
+#endif
+
+    // Objects that aren't due return their cached significance from the wrapped function
+    Super::Update(Viewpoints);
+
+    LastScoredCount = 0;
+    for (const TSharedRef<FPACS_SignificanceSlot>& Slot : Slots)
+    {
+        if (!Slot->bDue)
+        {
+            continue;
+        }
+
+        if (const FManagedObjectInfo* Info = GetManagedObject(Slot->Object.ResolveObjectPtr()))
+        {
+            Slot->Significance = Info->GetSignificance();
+        }
+        Slot->bDue = false;
+        ++LastScoredCount;
+    }
+}
+
+UPACS_CustomSignificanceManager* UPACS_CustomSignificanceManager::Get(const UWorld* World)
+{
+    return World ? Cast<UPACS_CustomSignificanceManager>(USignificanceManager::Get(World)) : nullptr;
+}
+
 void UPACS_CustomSignificanceManager::BeginDestroy()
 {
     UE_LOG(LogTemp, Verbose, TEXT("PACS_CustomSignificanceManager: Destroying significance manager"));
@@ -0,0 +1,216 @@
+#include "Subsystems/PACS_CCTVCaptureScheduler.h"
+#include "Settings/PACS_NetPerfSettings.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+
+DECLARE_STATS_GROUP(TEXT("PACS_CCTV"), STATGROUP_PACSCCTV, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("CCTV RunSchedule"), STAT_PACSCCTV_RunSchedule, STATGROUP_PACSCCTV);
+DECLARE_DWORD_COUNTER_STAT(TEXT("CCTV Captures"), STAT_PACSCCTV_Captures, STATGROUP_PACSCCTV);
+
+namespace
+{
+	class FPACS_SceneCaptureCapturer final : public IPACS_FeedCapturer
+	{
+	public:
+		virtual void CaptureFeed(USceneCaptureComponent2D* Capture) override
+		{
+			// Deferred: rendered with the next scene render instead of forcing its own
+			Capture->CaptureSceneDeferred();
+		}
+	};
+}
+
+FPACS_CCTVScheduleParams FPACS_CCTVScheduleParams::FromSettings()
+{
+	FPACS_CCTVScheduleParams Params;
+	if (const UPACS_NetPerfSettings* Settings = UPACS_NetPerfSettings::Get())
+	{
+		Params.CapturesPerFrame = Settings->CCTVCapturesPerFrame;
+		Params.DisplayedFeedRate = Settings->CCTVDisplayedFeedRate;
+		Params.MinFeedRate = Settings->CCTVMinFeedRate;
+	}
+	return Params;
+}
+
+bool UPACS_CCTVCaptureScheduler::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Nothing is rendered on a dedicated server
+	UWorld* World = Cast<UWorld>(Outer);
+	if (!World)
+	{
+		return false;
+	}
+
+	return World->GetNetMode() != NM_DedicatedServer;
+}
+
+void UPACS_CCTVCaptureScheduler::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	SetCapturer(nullptr);
+}
+
+void UPACS_CCTVCaptureScheduler::Deinitialize()
+{
+	Feeds.Reset();
+	FeedStates.Reset();
+	MonitorSurfaces.Reset();
+	Capturer.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UPACS_CCTVCaptureScheduler::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPACS_CCTVCaptureScheduler, STATGROUP_Tickables);
+}
+
+void UPACS_CCTVCaptureScheduler::Tick(float DeltaTime)
+{
+	if (UWorld* World = GetWorld())
+	{
+		RunSchedule(World->GetTimeSeconds());
+	}
+}
+
+void UPACS_CCTVCaptureScheduler::SetCapturer(TSharedPtr<IPACS_FeedCapturer> InCapturer)
+{
+	Capturer = InCapturer.IsValid() ? InCapturer : MakeShared<FPACS_SceneCaptureCapturer>();
+}
+
+int32 UPACS_CCTVCaptureScheduler::FindFeed(const USceneCaptureComponent2D* Capture) const
+{
+	return Feeds.IndexOfByPredicate([Capture](const TWeakObjectPtr<USceneCaptureComponent2D>& Feed)
+	{
+		return Feed.Get() == Capture;
+	});
+}
+
+void UPACS_CCTVCaptureScheduler::RegisterFeed(USceneCaptureComponent2D* Capture, bool bDisplayed, UPrimitiveComponent* MonitorSurface)
+{
+	if (!Capture)
+	{
+		return;
+	}
+
+	Capture->bCaptureEveryFrame = false;
+	Capture->bCaptureOnMovement = false;
+
+	const int32 Index = FindFeed(Capture);
+	if (Index != INDEX_NONE)
+	{
+		FeedStates[Index].bDisplayed = bDisplayed;
+		MonitorSurfaces[Index] = MonitorSurface;
+		return;
+	}
+
+	Feeds.Add(Capture);
+	MonitorSurfaces.Add(MonitorSurface);
+	FPACS_CCTVFeedState& State = FeedStates.AddDefaulted_GetRef();
+	State.bDisplayed = bDisplayed;
+}
+
+void UPACS_CCTVCaptureScheduler::UnregisterFeed(USceneCaptureComponent2D* Capture)
+{
+	const int32 Index = FindFeed(Capture);
+	if (Index != INDEX_NONE)
+	{
+		Feeds.RemoveAtSwap(Index);
+		FeedStates.RemoveAtSwap(Index);
+		MonitorSurfaces.RemoveAtSwap(Index);
+	}
+}
+
+void UPACS_CCTVCaptureScheduler::SetFeedDisplayed(USceneCaptureComponent2D* Capture, bool bDisplayed)
+{
+	const int32 Index = FindFeed(Capture);
+	if (Index != INDEX_NONE)
+	{
+		FeedStates[Index].bDisplayed = bDisplayed;
+	}
+}
+
+void UPACS_CCTVCaptureScheduler::RefreshFeeds()
+{
+	for (int32 i = Feeds.Num() - 1; i >= 0; --i)
+	{
+		if (!Feeds[i].IsValid())
+		{
+			Feeds.RemoveAtSwap(i);
+			FeedStates.RemoveAtSwap(i);
+			MonitorSurfaces.RemoveAtSwap(i);
+			continue;
+		}
+
+		const UPrimitiveComponent* Monitor = MonitorSurfaces[i].Get();
+		FeedStates[i].bMonitorRendered = Monitor && Monitor->WasRecentlyRendered(MonitorRenderedToleranceS);
+	}
+}
+
+void UPACS_CCTVCaptureScheduler::SelectCaptures(TArrayView<const FPACS_CCTVFeedState> InFeeds, double Now, const FPACS_CCTVScheduleParams& Params, TArray<int32>& OutIndices)
+{
+	OutIndices.Reset();
+	if (Params.CapturesPerFrame <= 0)
+	{
+		return;
+	}
+
+	const double MinInterval = 1.0 / FMath::Max(Params.MinFeedRate, 0.01f);
+	const double DisplayedInterval = 1.0 / FMath::Max(Params.DisplayedFeedRate, 0.01f);
+
+	struct FCandidate
+	{
+		int32 Index;
+		bool bStarved;
+		double Age;
+	};
+	TArray<FCandidate, TInlineAllocator<32>> Candidates;
+
+	for (int32 i = 0; i < InFeeds.Num(); ++i)
+	{
+		const double Age = Now - InFeeds[i].LastCaptureTime;
+		const bool bStarved = Age >= MinInterval;
+		const bool bDisplayedDue = InFeeds[i].IsDisplayed() && Age >= DisplayedInterval;
+		if (bStarved || bDisplayedDue)
+		{
+			Candidates.Add({ i, bStarved, Age });
+		}
+	}
+
+	// Starved feeds first, then displayed; oldest first within each, which makes it round-robin
+	Candidates.Sort([](const FCandidate& A, const FCandidate& B)
+	{
+		if (A.bStarved != B.bStarved)
+		{
+			return A.bStarved;
+		}
+		return A.Age > B.Age;
+	});
+
+	const int32 Count = FMath::Min(Candidates.Num(), Params.CapturesPerFrame);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutIndices.Add(Candidates[i].Index);
+	}
+}
+
+void UPACS_CCTVCaptureScheduler::RunSchedule(double Now)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PACSCCTV_RunSchedule);
+
+	RefreshFeeds();
+	SelectCaptures(FeedStates, Now, FPACS_CCTVScheduleParams::FromSettings(), ScratchIndices);
+
+	LastFrameCaptureCount = 0;
+	for (const int32 Index : ScratchIndices)
+	{
+		if (USceneCaptureComponent2D* Capture = Feeds[Index].Get())
+		{
+			Capturer->CaptureFeed(Capture);
+			FeedStates[Index].LastCaptureTime = Now;
+			++LastFrameCaptureCount;
+		}
+	}
+	SET_DWORD_STAT(STAT_PACSCCTV_Captures, LastFrameCaptureCount);
+}
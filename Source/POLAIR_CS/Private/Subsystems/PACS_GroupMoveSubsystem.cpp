@@ -0,0 +1,313 @@
+#include "Subsystems/PACS_GroupMoveSubsystem.h"
+#include "Settings/PACS_NetPerfSettings.h"
+#include "Interfaces/PACS_SelectableCharacterInterface.h"
+#include "AIController.h"
+#include "GameFramework/Character.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "Engine/World.h"
+
+DECLARE_STATS_GROUP(TEXT("PACS_GroupMove"), STATGROUP_PACSGroupMove, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("GroupMove IssueGroupMove"), STAT_PACSGroupMove_Issue, STATGROUP_PACSGroupMove);
+
+namespace
+{
+	// Characters follow paths through their AI controller. Other selectables (vehicles drive through
+	// DriveToLocation) must be moved through IPACS_SelectableCharacterInterface
+	AAIController* GetCharacterAIController(AActor* NPC)
+	{
+		const ACharacter* Character = Cast<ACharacter>(NPC);
+		return Character ? Cast<AAIController>(Character->GetController()) : nullptr;
+	}
+}
+
+bool UPACS_GroupMoveSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Movement commands are server-authoritative; clients never path
+	UWorld* World = Cast<UWorld>(Outer);
+	if (!World)
+	{
+		return false;
+	}
+
+	return World->GetNetMode() != NM_Client;
+}
+
+void UPACS_GroupMoveSubsystem::BuildFormationOffsets(EPACS_FormationType Formation, int32 Count, float Spacing, TArray<FVector2D>& OutOffsets)
+{
+	OutOffsets.Reset(Count);
+	if (Count <= 0)
+	{
+		return;
+	}
+
+	switch (Formation)
+	{
+	case EPACS_FormationType::Wedge:
+		{
+			// Tip on the target, then alternate left/right one rank further back each pair
+			OutOffsets.Add(FVector2D::ZeroVector);
+			for (int32 i = 1; i < Count; ++i)
+			{
+				const int32 Rank = (i + 1) / 2;
+				const float Side = (i % 2 == 1) ? -1.0f : 1.0f;
+				OutOffsets.Add(FVector2D(-Rank * Spacing, Side * Rank * Spacing));
+			}
+			break;
+		}
+
+	case EPACS_FormationType::Column:
+		{
+			for (int32 i = 0; i < Count; ++i)
+			{
+				OutOffsets.Add(FVector2D(-i * Spacing, 0.0f));
+			}
+			break;
+		}
+
+	case EPACS_FormationType::Grid:
+	default:
+		{
+			// Near-square block centred on the target, front row first, partial last row centred
+			const int32 Columns = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Count)));
+			const int32 Rows = FMath::DivideAndRoundUp(Count, Columns);
+			for (int32 i = 0; i < Count; ++i)
+			{
+				const int32 Row = i / Columns;
+				const int32 Col = i % Columns;
+				const int32 RowCount = FMath::Min(Columns, Count - Row * Columns);
+				const float X = ((Rows - 1) * 0.5f - Row) * Spacing;
+				const float Y = (Col - (RowCount - 1) * 0.5f) * Spacing;
+				OutOffsets.Add(FVector2D(X, Y));
+			}
+			break;
+		}
+	}
+}
+
+int32 UPACS_GroupMoveSubsystem::IssueGroupMove(const TArray<AActor*>& NPCs, const FVector& TargetLocation, EPACS_FormationType Formation)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PACSGroupMove_Issue);
+
+	TArray<AActor*> Members;
+	Members.Reserve(NPCs.Num());
+	for (AActor* NPC : NPCs)
+	{
+		if (IsValid(NPC))
+		{
+			Members.Add(NPC);
+		}
+	}
+
+	if (Members.Num() == 0)
+	{
+		return 0;
+	}
+
+	Stats.GroupCommands++;
+
+	// A single NPC gains nothing from a corridor; keep the regular path
+	if (Members.Num() == 1)
+	{
+		return MoveIndividually(Members[0], TargetLocation) ? 1 : 0;
+	}
+
+	const UPACS_NetPerfSettings* Settings = UPACS_NetPerfSettings::Get();
+	const float Spacing = Settings->FormationSpacing;
+	const float CohesionRadiusSq = FMath::Square(Settings->GroupCohesionRadius);
+
+	FVector Centroid = FVector::ZeroVector;
+	for (const AActor* NPC : Members)
+	{
+		Centroid += NPC->GetActorLocation();
+	}
+	Centroid /= Members.Num();
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	const ANavigationData* NavData = NavSys ? NavSys->GetDefaultNavDataInstance(FNavigationSystem::DontCreate) : nullptr;
+
+	// One corridor query for the whole group
+	TArray<FVector> Corridor;
+	FVector NavStart = Centroid;
+	FVector NavGoal = TargetLocation;
+	if (NavData && ProjectToNav(NavSys, NavData, Centroid, NavStart) && ProjectToNav(NavSys, NavData, TargetLocation, NavGoal))
+	{
+		Stats.PathQueries++;
+		const FPathFindingQuery Query(this, *NavData, NavStart, NavGoal);
+		const FPathFindingResult Result = NavSys->FindPathSync(Query);
+		if (Result.IsSuccessful() && Result.Path.IsValid() && !Result.IsPartial())
+		{
+			for (const FNavPathPoint& Point : Result.Path->GetPathPoints())
+			{
+				Corridor.Add(Point.Location);
+			}
+		}
+	}
+
+	// Orient the formation along the final leg of the corridor (or the straight line if there is none)
+	FVector Forward = (Corridor.Num() >= 2)
+		? (Corridor.Last() - Corridor[Corridor.Num() - 2])
+		: (NavGoal - Centroid);
+	Forward.Z = 0.0f;
+	if (!Forward.Normalize())
+	{
+		Forward = FVector::ForwardVector;
+	}
+	const FVector Right = FVector::CrossProduct(FVector::UpVector, Forward);
+
+	TArray<FVector2D> Offsets;
+	BuildFormationOffsets(Formation, Members.Num(), Spacing, Offsets);
+
+	TArray<FVector> Slots;
+	Slots.Reserve(Offsets.Num());
+	for (const FVector2D& Offset : Offsets)
+	{
+		const FVector Desired = NavGoal + Forward * Offset.X + Right * Offset.Y;
+		FVector Projected = NavGoal;
+		if (!NavData || !ProjectToNav(NavSys, NavData, Desired, Projected))
+		{
+			// Off-mesh slots collapse onto the goal; path following separates them on arrival
+			Projected = NavData ? NavGoal : Desired;
+		}
+		Slots.Add(Projected);
+	}
+
+	// Greedy front-to-back assignment: each slot takes the closest unassigned NPC
+	TArray<AActor*> Unassigned = Members;
+	int32 MovedCount = 0;
+	for (const FVector& Slot : Slots)
+	{
+		int32 BestIndex = 0;
+		float BestDistSq = TNumericLimits<float>::Max();
+		for (int32 i = 0; i < Unassigned.Num(); ++i)
+		{
+			const float DistSq = FVector::DistSquared(Unassigned[i]->GetActorLocation(), Slot);
+			if (DistSq < BestDistSq)
+			{
+				BestDistSq = DistSq;
+				BestIndex = i;
+			}
+		}
+
+		AActor* NPC = Unassigned[BestIndex];
+		Unassigned.RemoveAtSwap(BestIndex);
+
+		AAIController* AIController = GetCharacterAIController(NPC);
+		const bool bNearGroup = FVector::DistSquared(NPC->GetActorLocation(), Centroid) <= CohesionRadiusSq;
+
+		// Copy the shared corridor, re-anchored at this NPC and ending at its slot. The new first and
+		// last legs are checked against the navmesh so they cannot cut through walls or leave the mesh
+		TArray<FVector> Points;
+		if (AIController && Corridor.Num() >= 2 && bNearGroup && BuildCorridorCopy(NavSys, NavData, Corridor, NPC->GetActorLocation(), Slot, Points))
+		{
+			FNavPathSharedPtr Path = MakeShareable(new FNavigationPath(Points));
+			Path->SetNavigationDataUsed(NavData);
+
+			FAIMoveRequest MoveRequest(Slot);
+			MoveRequest.SetAcceptanceRadius(5.0f);
+			MoveRequest.SetUsePathfinding(true);
+			MoveRequest.SetAllowPartialPath(false);
+			MoveRequest.SetProjectGoalLocation(false);
+
+			if (AIController->RequestMove(MoveRequest, Path).IsValid())
+			{
+				Stats.SharedPathMoves++;
+				MovedCount++;
+				continue;
+			}
+		}
+
+		if (MoveIndividually(NPC, Slot))
+		{
+			MovedCount++;
+		}
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("PACS_GroupMove: %d/%d NPCs moved in formation %d (corridor points: %d)"),
+		MovedCount, Members.Num(), static_cast<int32>(Formation), Corridor.Num());
+
+	return MovedCount;
+}
+
+bool UPACS_GroupMoveSubsystem::BuildCorridorCopy(UNavigationSystemV1* NavSys, const ANavigationData* NavData, const TArray<FVector>& Corridor,
+	const FVector& Start, const FVector& Slot, TArray<FVector>& OutPoints)
+{
+	OutPoints.Reset(Corridor.Num() + 2);
+	OutPoints.Add(Start);
+
+	// Interior corridor points are shared; only the legs onto and off the corridor are per-NPC
+	const int32 LastInterior = Corridor.Num() - 2;
+	if (!AppendNavLeg(NavSys, NavData, Start, LastInterior >= 1 ? Corridor[1] : Slot, OutPoints))
+	{
+		return false;
+	}
+
+	for (int32 i = 2; i <= LastInterior; ++i)
+	{
+		OutPoints.Add(Corridor[i]);
+	}
+
+	return LastInterior < 1 || AppendNavLeg(NavSys, NavData, Corridor[LastInterior], Slot, OutPoints);
+}
+
+bool UPACS_GroupMoveSubsystem::AppendNavLeg(UNavigationSystemV1* NavSys, const ANavigationData* NavData, const FVector& From, const FVector& To, TArray<FVector>& OutPoints)
+{
+	// A clear navmesh raycast means the straight leg stays on the mesh
+	Stats.NavRaycasts++;
+	FVector HitLocation;
+	if (!NavData->Raycast(From, To, HitLocation, NavData->GetDefaultQueryFilter(), this))
+	{
+		OutPoints.Add(To);
+		return true;
+	}
+
+	// Otherwise path around whatever cut the leg; it is short, so this stays a local query
+	Stats.LegPathQueries++;
+	const FPathFindingQuery Query(this, *NavData, From, To);
+	const FPathFindingResult Result = NavSys->FindPathSync(Query);
+	if (!Result.IsSuccessful() || !Result.Path.IsValid() || Result.IsPartial())
+	{
+		return false;
+	}
+
+	// Skip the leg's start, which is already the last point in OutPoints
+	const TArray<FNavPathPoint>& LegPoints = Result.Path->GetPathPoints();
+	for (int32 i = 1; i < LegPoints.Num(); ++i)
+	{
+		OutPoints.Add(LegPoints[i].Location);
+	}
+	return true;
+}
+
+bool UPACS_GroupMoveSubsystem::MoveIndividually(AActor* NPC, const FVector& Destination)
+{
+	Stats.PathQueries++;
+	Stats.FallbackMoves++;
+
+	if (AAIController* AIController = GetCharacterAIController(NPC))
+	{
+		return AIController->MoveToLocation(Destination, 5.0f, true, true, true, false) != EPathFollowingRequestResult::Failed;
+	}
+
+	if (IPACS_SelectableCharacterInterface* Selectable = Cast<IPACS_SelectableCharacterInterface>(NPC))
+	{
+		Selectable->MoveToLocation(Destination);
+		return true;
+	}
+
+	return false;
+}
+
+bool UPACS_GroupMoveSubsystem::ProjectToNav(UNavigationSystemV1* NavSys, const ANavigationData* NavData, const FVector& Point, FVector& OutProjected)
+{
+	Stats.Projections++;
+
+	FNavLocation NavLocation;
+	if (NavSys->ProjectPointToNavigation(Point, NavLocation, UPACS_NetPerfSettings::Get()->FormationProjectionExtent, NavData))
+	{
+		OutProjected = NavLocation.Location;
+		return true;
+	}
+
+	return false;
+}
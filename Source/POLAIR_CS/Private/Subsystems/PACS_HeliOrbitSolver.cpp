@@ -0,0 +1,132 @@
+#include "Subsystems/PACS_HeliOrbitSolver.h"
+#include "Subsystems/PACS_ServerClockSubsystem.h"
+#include "Components/PACS_HeliMovementComponent.h"
+#include "Components/PACS_HeliPhaseTimings.h"
+#include "Data/Configs/PACS_CandidateHelicopterData.h"
+#include "Settings/PACS_NetPerfSettings.h"
+#include "Async/ParallelFor.h"
+#include "Misc/App.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Heli OrbitSolver Gather"), STAT_PACSHeli_SolverGather, STATGROUP_PACSHeli);
+DECLARE_CYCLE_STAT(TEXT("Heli OrbitSolver Solve"), STAT_PACSHeli_SolverSolve, STATGROUP_PACSHeli);
+DECLARE_CYCLE_STAT(TEXT("Heli OrbitSolver Scatter"), STAT_PACSHeli_SolverScatter, STATGROUP_PACSHeli);
+
+void FPACS_HeliOrbitState::Solve(float InNowS, float FrameDt)
+{
+	NowS = InNowS;
+	UPACS_HeliMovementComponent::EvalOrbitTargets(Targets, Anchors, *Data, NowS, FrameDt, CenterCm, AltitudeCm, RadiusCm, SpeedCms);
+	AngleRad = UPACS_HeliMovementComponent::EvalOrbitAngle(Anchors, SpeedCms, RadiusCm, NowS, AngleRad);
+	PositionCm = UPACS_HeliMovementComponent::OrbitPositionAt(CenterCm, RadiusCm, AngleRad, AltitudeCm);
+}
+
+void UPACS_HeliOrbitSolver::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Movement components read the shared clock through this subsystem
+	Collection.InitializeDependency<UPACS_ServerClockSubsystem>();
+
+	if (const UPACS_NetPerfSettings* Settings = UPACS_NetPerfSettings::Get())
+	{
+		bEnabled = Settings->bParallelHeliOrbitSolver;
+		MinParallelCount = Settings->HeliOrbitSolverMinParallelCount;
+	}
+}
+
+void UPACS_HeliOrbitSolver::Deinitialize()
+{
+	Components.Reset();
+	States.Reset();
+	Gathered.Reset();
+
+	Super::Deinitialize();
+}
+
+void UPACS_HeliOrbitSolver::RegisterComponent(UPACS_HeliMovementComponent* Component)
+{
+	if (Component)
+	{
+		Components.AddUnique(Component);
+	}
+}
+
+void UPACS_HeliOrbitSolver::UnregisterComponent(UPACS_HeliMovementComponent* Component)
+{
+	Components.RemoveSwap(Component);
+}
+
+void UPACS_HeliOrbitSolver::SolveStates(TArrayView<FPACS_HeliOrbitState> InStates, float NowS, float FrameDt, int32 InMinParallelCount)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PACSHeli_SolverSolve);
+
+	const bool bSingleThread = InStates.Num() < FMath::Max(InMinParallelCount, 1);
+	ParallelFor(InStates.Num(), [&InStates, NowS, FrameDt](int32 Index)
+	{
+		InStates[Index].Solve(NowS, FrameDt);
+	}, bSingleThread);
+}
+
+void UPACS_HeliOrbitSolver::SolveFrame()
+{
+	UWorld* World = GetWorld();
+	if (!bEnabled || !World)
+	{
+		return;
+	}
+
+	const double LocalS = World->GetTimeSeconds();
+	if (LocalS == LastSolveTime)
+	{
+		return;
+	}
+	LastSolveTime = LocalS;
+
+	const float NowS = UPACS_ServerClockSubsystem::GetServerNowS(World);
+	const float FrameDt = FApp::GetDeltaTime();
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_PACSHeli_SolverGather);
+
+		States.Reset();
+		Gathered.Reset();
+
+		const UPACS_CandidateHelicopterData* LastData = nullptr;
+		for (int32 i = Components.Num() - 1; i >= 0; --i)
+		{
+			UPACS_HeliMovementComponent* Component = Components[i].Get();
+			if (!Component)
+			{
+				Components.RemoveAtSwap(i);
+				continue;
+			}
+			if (!Component->IsOrbitSolverEligible())
+			{
+				continue;
+			}
+
+			// LUT baking is lazy and not thread safe; do it here (usually one shared data asset)
+			if (Component->Data != LastData)
+			{
+				LastData = Component->Data;
+				LastData->PrepareCurveLUTs();
+			}
+
+			Component->GatherOrbitState(States.AddDefaulted_GetRef());
+			Gathered.Add(Component);
+		}
+	}
+
+	SolveStates(States, NowS, FrameDt, MinParallelCount);
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_PACSHeli_SolverScatter);
+
+		for (int32 i = 0; i < Gathered.Num(); ++i)
+		{
+			Gathered[i]->ApplyOrbitState(States[i], LastSolveTime);
+		}
+	}
+
+	LastSolveCount = Gathered.Num();
+}
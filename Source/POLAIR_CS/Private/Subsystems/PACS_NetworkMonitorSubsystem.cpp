@@ -158,6 +158,21 @@ void UPACS_NetworkMonitorSubsystem::RecordActorReplication(AActor* Actor, int32
 	}
 }
 
+void UPACS_NetworkMonitorSubsystem::RecordDroppedMoveCommands(int32 CoalescedCount, int32 RejectedCount)
+{
+	CoalescedMoveCommands += CoalescedCount;
+	RejectedMoveCommands += RejectedCount;
+
+	if (RejectedCount > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("PACS_NetworkMonitor: Rejected %d move commands (queue full), %d total"),
+			RejectedCount, RejectedMoveCommands);
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("PACS_NetworkMonitor: Coalesced %d move commands, %d total"),
+		CoalescedCount, CoalescedMoveCommands);
+}
+
 FSpawnNetworkStats UPACS_NetworkMonitorSubsystem::GetSpawnNetworkStats(const FGameplayTag& SpawnTag) const
 {
 	if (const FSpawnNetworkStats* Stats = SpawnStats.Find(SpawnTag))
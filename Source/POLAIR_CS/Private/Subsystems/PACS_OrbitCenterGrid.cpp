@@ -0,0 +1,242 @@
+#include "Subsystems/PACS_OrbitCenterGrid.h"
+#include "Settings/PACS_NetPerfSettings.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "Components/PrimitiveComponent.h"
+#include "TimerManager.h"
+
+DECLARE_STATS_GROUP(TEXT("PACS_OrbitCenterGrid"), STATGROUP_PACSOrbitCenterGrid, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("OrbitCenterGrid Build"), STAT_PACSOrbitCenterGrid_Build, STATGROUP_PACSOrbitCenterGrid);
+DECLARE_CYCLE_STAT(TEXT("OrbitCenterGrid Query"), STAT_PACSOrbitCenterGrid_Query, STATGROUP_PACSOrbitCenterGrid);
+
+FPACS_OrbitCenterGridParams FPACS_OrbitCenterGridParams::FromSettings()
+{
+	FPACS_OrbitCenterGridParams Out;
+	if (const UPACS_NetPerfSettings* Settings = UPACS_NetPerfSettings::Get())
+	{
+		Out.bEnabled = Settings->bUseOrbitCenterGrid;
+		Out.CellCm = Settings->OrbitCenterGridCellCm;
+		Out.MaxCellsPerAxis = Settings->OrbitCenterGridMaxCellsPerAxis;
+		Out.MinZCm = Settings->OrbitCenterGridMinZCm;
+		Out.MaxZCm = Settings->OrbitCenterGridMaxZCm;
+	}
+	return Out;
+}
+
+bool UPACS_OrbitCenterGrid::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Orbit edits are only validated by the server
+	UWorld* World = Cast<UWorld>(Outer);
+	if (!World)
+	{
+		return false;
+	}
+
+	return World->GetNetMode() != NM_Client;
+}
+
+void UPACS_OrbitCenterGrid::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	Params = FPACS_OrbitCenterGridParams::FromSettings();
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UPACS_OrbitCenterGrid::OnLevelsChanged);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UPACS_OrbitCenterGrid::OnLevelsChanged);
+	if (UWorld* World = GetWorld())
+	{
+		ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UPACS_OrbitCenterGrid::OnActorSpawned));
+	}
+}
+
+void UPACS_OrbitCenterGrid::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	}
+	Cells.Reset();
+
+	Super::Deinitialize();
+}
+
+void UPACS_OrbitCenterGrid::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+	BuildFromLevel();
+}
+
+void UPACS_OrbitCenterGrid::OnLevelsChanged(ULevel* Level, UWorld* InWorld)
+{
+	UWorld* World = GetWorld();
+	if (InWorld != World || !World->HasBegunPlay())
+	{
+		return;
+	}
+
+	// Collision changed: validate exactly until the rebuild
+	Cells.Reset();
+	World->GetTimerManager().SetTimer(RebuildTimer, FTimerDelegate::CreateUObject(this, &UPACS_OrbitCenterGrid::BuildFromLevel), 0.01f, false);
+}
+
+void UPACS_OrbitCenterGrid::OnActorSpawned(AActor* Actor)
+{
+	if (Cells.Num() == 0 || !Actor)
+	{
+		return;
+	}
+
+	// Movable collision is checked in every cell; Static and Stationary bodies live in the static
+	// scene, which only Boundary cells query
+	bool bStaticCollision = false;
+	Actor->ForEachComponent<UPrimitiveComponent>(false, [&bStaticCollision](const UPrimitiveComponent* Primitive)
+	{
+		bStaticCollision |= Primitive->Mobility != EComponentMobility::Movable && Primitive->IsCollisionEnabled();
+	});
+	if (bStaticCollision)
+	{
+		MarkBoundary(Actor->GetComponentsBoundingBox());
+	}
+}
+
+void UPACS_OrbitCenterGrid::MarkBoundary(const FBox& Bounds)
+{
+	if (Cells.Num() == 0 || !Bounds.IsValid)
+	{
+		return;
+	}
+
+	const int32 MinX = FMath::Clamp(FMath::FloorToInt((Bounds.Min.X - ProbeRadiusCm - Origin.X) / CellCm), 0, NumX - 1);
+	const int32 MinY = FMath::Clamp(FMath::FloorToInt((Bounds.Min.Y - ProbeRadiusCm - Origin.Y) / CellCm), 0, NumY - 1);
+	const int32 MaxX = FMath::Clamp(FMath::FloorToInt((Bounds.Max.X + ProbeRadiusCm - Origin.X) / CellCm), 0, NumX - 1);
+	const int32 MaxY = FMath::Clamp(FMath::FloorToInt((Bounds.Max.Y + ProbeRadiusCm - Origin.Y) / CellCm), 0, NumY - 1);
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		for (int32 X = MinX; X <= MaxX; ++X)
+		{
+			EPACS_OrbitCenterCell& Cell = Cells[Y * NumX + X];
+			AllowedCells -= Cell == EPACS_OrbitCenterCell::Allowed ? 1 : 0;
+			Cell = EPACS_OrbitCenterCell::Boundary;
+		}
+	}
+}
+
+void UPACS_OrbitCenterGrid::BuildFromLevel()
+{
+	Cells.Reset();
+
+	UWorld* World = GetWorld();
+	if (!Params.bEnabled || !World || !World->PersistentLevel)
+	{
+		return;
+	}
+
+	const FBox LevelBounds = ALevel::CalculateLevelBounds(World->PersistentLevel);
+	if (!LevelBounds.IsValid)
+	{
+		return;
+	}
+	Build(LevelBounds, Params);
+}
+
+void UPACS_OrbitCenterGrid::Build(const FBox& Area, const FPACS_OrbitCenterGridParams& InParams)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PACSOrbitCenterGrid_Build);
+
+	Params = InParams;
+	Cells.Reset();
+	AllowedCells = 0;
+
+	UWorld* World = GetWorld();
+	if (!World || !Area.IsValid || Params.MaxZCm <= Params.MinZCm)
+	{
+		return;
+	}
+
+	// Coarsen rather than exceed the cell budget on very large levels
+	const FVector Size = Area.GetSize();
+	const int32 MaxCells = FMath::Max(Params.MaxCellsPerAxis, 1);
+	CellCm = FMath::Max3(Params.CellCm, float(Size.X) / MaxCells, float(Size.Y) / MaxCells);
+	NumX = FMath::Clamp(FMath::CeilToInt(Size.X / CellCm), 1, MaxCells);
+	NumY = FMath::Clamp(FMath::CeilToInt(Size.Y / CellCm), 1, MaxCells);
+	Origin = FVector2D(Area.Min.X, Area.Min.Y);
+
+	// A probe anywhere in the cell's column fits inside this box
+	const float HalfCell = CellCm * 0.5f;
+	const FCollisionShape Column = FCollisionShape::MakeBox(FVector(HalfCell + ProbeRadiusCm, HalfCell + ProbeRadiusCm,
+		(Params.MaxZCm - Params.MinZCm) * 0.5f + ProbeRadiusCm));
+	const float MidZ = (Params.MinZCm + Params.MaxZCm) * 0.5f;
+	FCollisionQueryParams Q(SCENE_QUERY_STAT(OrbitCenterGrid), false);
+
+	Cells.SetNumUninitialized(NumX * NumY);
+	for (int32 Y = 0; Y < NumY; ++Y)
+	{
+		for (int32 X = 0; X < NumX; ++X)
+		{
+			const FVector Center(Origin.X + (X + 0.5f) * CellCm, Origin.Y + (Y + 0.5f) * CellCm, MidZ);
+			const bool bBlocked = World->OverlapAnyTestByChannel(Center, FQuat::Identity, ECC_WorldStatic, Column, Q);
+			Cells[Y * NumX + X] = bBlocked ? EPACS_OrbitCenterCell::Boundary : EPACS_OrbitCenterCell::Allowed;
+			AllowedCells += bBlocked ? 0 : 1;
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("PACS_OrbitCenterGrid: %dx%d cells of %.0f cm, %d allowed, %d need overlap"),
+		NumX, NumY, CellCm, AllowedCells, Cells.Num() - AllowedCells);
+}
+
+EPACS_OrbitCenterCell UPACS_OrbitCenterGrid::GetCell(const FVector& Location, bool& bOutInGrid) const
+{
+	bOutInGrid = false;
+	if (Cells.Num() == 0 || Location.Z < Params.MinZCm || Location.Z > Params.MaxZCm)
+	{
+		return EPACS_OrbitCenterCell::Boundary;
+	}
+
+	const int32 X = FMath::FloorToInt((Location.X - Origin.X) / CellCm);
+	const int32 Y = FMath::FloorToInt((Location.Y - Origin.Y) / CellCm);
+	if (X < 0 || Y < 0 || X >= NumX || Y >= NumY)
+	{
+		return EPACS_OrbitCenterCell::Boundary;
+	}
+
+	bOutInGrid = true;
+	return Cells[Y * NumX + X];
+}
+
+bool UPACS_OrbitCenterGrid::IsCenterValid(const FVector& Proposed, const AActor* IgnoreActor)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PACSOrbitCenterGrid_Query);
+
+	bool bInGrid = false;
+	const EPACS_OrbitCenterCell Cell = GetCell(Proposed, bInGrid);
+	if (!bInGrid)
+	{
+		++FallbackOverlaps;
+		return OverlapCenter(GetWorld(), Proposed, IgnoreActor);
+	}
+
+	if (Cell == EPACS_OrbitCenterCell::Allowed)
+	{
+		// Static geometry was ruled out at build time; pawns and blockers that move in still count
+		++GridAccepts;
+		return OverlapCenter(GetWorld(), Proposed, IgnoreActor, EQueryMobilityType::Dynamic);
+	}
+
+	++BoundaryOverlaps;
+	return OverlapCenter(GetWorld(), Proposed, IgnoreActor);
+}
+
+bool UPACS_OrbitCenterGrid::OverlapCenter(const UWorld* World, const FVector& Proposed, const AActor* IgnoreActor,
+	EQueryMobilityType Mobility)
+{
+	if (!World)
+	{
+		return false;
+	}
+
+	FCollisionQueryParams Q(SCENE_QUERY_STAT(OrbitCenter), false, IgnoreActor);
+	Q.MobilityType = Mobility;
+	const FCollisionShape Probe = FCollisionShape::MakeSphere(ProbeRadiusCm);
+	return !World->OverlapAnyTestByChannel(Proposed, FQuat::Identity, ECC_WorldStatic, Probe, Q);
+}
@@ -0,0 +1,45 @@
+#include "Subsystems/PACS_SelectableRegistrySubsystem.h"
+#include "Components/PACS_SelectionPlaneComponent.h"
+#include "Engine/World.h"
+
+bool UPACS_SelectableRegistrySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Hover and selection visuals are client-only
+	UWorld* World = Cast<UWorld>(Outer);
+	if (!World)
+	{
+		return false;
+	}
+
+	return World->GetNetMode() != NM_DedicatedServer;
+}
+
+void UPACS_SelectableRegistrySubsystem::Deinitialize()
+{
+	Selectables.Reset();
+	++Generation;
+
+	Super::Deinitialize();
+}
+
+void UPACS_SelectableRegistrySubsystem::Register(UPACS_SelectionPlaneComponent* Component)
+{
+	if (!Component || Selectables.Contains(Component))
+	{
+		return;
+	}
+
+	Selectables.Add(Component);
+	++Generation;
+}
+
+void UPACS_SelectableRegistrySubsystem::Unregister(UPACS_SelectionPlaneComponent* Component)
+{
+	// Order is irrelevant to consumers; swap-remove keeps this O(1) after the find
+	const int32 Index = Selectables.IndexOfByKey(Component);
+	if (Index != INDEX_NONE)
+	{
+		Selectables.RemoveAtSwap(Index);
+		++Generation;
+	}
+}
@@ -0,0 +1,270 @@
+#include "Subsystems/PACS_SelectionPlaneBudgeter.h"
+#include "Subsystems/PACS_SelectableRegistrySubsystem.h"
+#include "Components/PACS_SelectionPlaneComponent.h"
+#include "Data/Settings/PACS_CustomSignificanceManager.h"
+#include "Data/PACS_SignificanceViewpoints.h"
+#include "Settings/PACS_NetPerfSettings.h"
+#include "Engine/World.h"
+
+DECLARE_STATS_GROUP(TEXT("PACS_SelectionBudget"), STATGROUP_PACSSelectionBudget, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("SelectionBudget RunBudget"), STAT_PACSSelectionBudget_Run, STATGROUP_PACSSelectionBudget);
+DECLARE_DWORD_COUNTER_STAT(TEXT("SelectionBudget Visible Planes"), STAT_PACSSelectionBudget_Visible, STATGROUP_PACSSelectionBudget);
+
+const FName UPACS_SelectionPlaneBudgeter::SignificanceTag(TEXT("PACS.SelectionPlane"));
+
+namespace
+{
+	// Selected planes rank above any distance-based significance (which is at most 1)
+	constexpr float SelectedSignificance = 2.0f;
+
+	float MinDistanceToViews(const UPACS_SelectionPlaneComponent* Plane, TArrayView<const FTransform> Viewpoints)
+	{
+		const AActor* Owner = Plane->GetOwner();
+		if (!Owner || Viewpoints.Num() == 0)
+		{
+			return 0.0f;
+		}
+
+		const FVector Location = Owner->GetActorLocation();
+		float MinDistance = TNumericLimits<float>::Max();
+		for (const FTransform& View : Viewpoints)
+		{
+			MinDistance = FMath::Min(MinDistance, FPACS_SignificanceViewpoints::WeightedDistance(Location, View));
+		}
+		return MinDistance;
+	}
+}
+
+FPACS_PlaneBudgetParams FPACS_PlaneBudgetParams::FromSettings()
+{
+	FPACS_PlaneBudgetParams Params;
+	if (const UPACS_NetPerfSettings* Settings = UPACS_NetPerfSettings::Get())
+	{
+		Params.MaxVisible = Settings->MaxVisibleSelectionPlanes;
+		Params.MaxDistance = Settings->SelectionPlaneMaxDistance;
+		Params.NearDistance = Settings->NearDistanceThreshold;
+		Params.NearUpdateRate = Settings->NearSelectionUpdateRate;
+		Params.FarUpdateRate = Settings->FarSelectionUpdateRate;
+		Params.bThrottleUpdates = Settings->bThrottleSelectionUpdates;
+	}
+	return Params;
+}
+
+bool UPACS_SelectionPlaneBudgeter::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Selection visuals are client-only
+	UWorld* World = Cast<UWorld>(Outer);
+	if (!World)
+	{
+		return false;
+	}
+
+	return World->GetNetMode() != NM_DedicatedServer;
+}
+
+void UPACS_SelectionPlaneBudgeter::Deinitialize()
+{
+	if (UPACS_CustomSignificanceManager* SignificanceManager = UPACS_CustomSignificanceManager::Get(GetWorld()))
+	{
+		for (const TWeakObjectPtr<UPACS_SelectionPlaneComponent>& Plane : RegisteredPlanes)
+		{
+			if (Plane.IsValid())
+			{
+				SignificanceManager->UnregisterObject(Plane.Get());
+			}
+		}
+	}
+	RegisteredPlanes.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UPACS_SelectionPlaneBudgeter::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPACS_SelectionPlaneBudgeter, STATGROUP_Tickables);
+}
+
+void UPACS_SelectionPlaneBudgeter::Tick(float DeltaTime)
+{
+	// Visibility is rebalanced at the far update rate; per-plane update slots run in the plane manager
+	const FPACS_PlaneBudgetParams Params = FPACS_PlaneBudgetParams::FromSettings();
+	TimeSinceBudget += DeltaTime;
+	if (TimeSinceBudget < 1.0f / FMath::Max(Params.FarUpdateRate, 1.0f))
+	{
+		return;
+	}
+	TimeSinceBudget = 0.0f;
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// Player views, or HMD plus orbit look-ahead for helicopter candidates
+	ScratchViewpoints.Reset();
+	FPACS_SignificanceViewpoints::GatherLocal(World, ScratchViewpoints);
+
+	if (ScratchViewpoints.Num() > 0)
+	{
+		RunBudget(ScratchViewpoints);
+	}
+}
+
+float UPACS_SelectionPlaneBudgeter::ComputePlaneSignificance(const UPACS_SelectionPlaneComponent* Plane, const FTransform& Viewpoint)
+{
+	const AActor* Owner = Plane ? Plane->GetOwner() : nullptr;
+	if (!Owner)
+	{
+		return 0.0f;
+	}
+
+	if (Plane->GetSelectionState() == (uint8)ESelectionVisualState::Selected)
+	{
+		return SelectedSignificance;
+	}
+
+	// (0, 1]: 1 at the camera, falling off with (weighted) distance
+	return FPACS_SignificanceViewpoints::DistanceSignificance(Owner->GetActorLocation(), Viewpoint);
+}
+
+void UPACS_SelectionPlaneBudgeter::SyncSignificanceRegistrations(UPACS_CustomSignificanceManager* SignificanceManager, UPACS_SelectableRegistrySubsystem* Registry)
+{
+	if (Registry->GetGeneration() == LastRegistryGeneration)
+	{
+		return;
+	}
+	LastRegistryGeneration = Registry->GetGeneration();
+
+	TSet<TWeakObjectPtr<UPACS_SelectionPlaneComponent>> Current;
+	Current.Reserve(Registry->Num());
+
+	for (const TWeakObjectPtr<UPACS_SelectionPlaneComponent>& WeakPlane : Registry->GetSelectables())
+	{
+		UPACS_SelectionPlaneComponent* Plane = WeakPlane.Get();
+		if (!Plane)
+		{
+			continue;
+		}
+
+		Current.Add(Plane);
+		if (!RegisteredPlanes.Contains(Plane))
+		{
+			SignificanceManager->RegisterObject(Plane, SignificanceTag,
+				[](USignificanceManager::FManagedObjectInfo* Info, const FTransform& Viewpoint)
+				{
+					return ComputePlaneSignificance(Cast<UPACS_SelectionPlaneComponent>(Info->GetObject()), Viewpoint);
+				});
+		}
+	}
+
+	for (const TWeakObjectPtr<UPACS_SelectionPlaneComponent>& Plane : RegisteredPlanes)
+	{
+		if (!Current.Contains(Plane) && Plane.IsValid())
+		{
+			SignificanceManager->UnregisterObject(Plane.Get());
+		}
+	}
+
+	RegisteredPlanes = MoveTemp(Current);
+}
+
+void UPACS_SelectionPlaneBudgeter::RunBudget(TArrayView<const FTransform> Viewpoints)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PACSSelectionBudget_Run);
+
+	UWorld* World = GetWorld();
+	UPACS_SelectableRegistrySubsystem* Registry = World ? World->GetSubsystem<UPACS_SelectableRegistrySubsystem>() : nullptr;
+	if (!Registry)
+	{
+		return;
+	}
+
+	ScratchPlanes.Reset();
+	ScratchInputs.Reset();
+
+	if (UPACS_CustomSignificanceManager* SignificanceManager = UPACS_CustomSignificanceManager::Get(World))
+	{
+		// Significance itself is updated every frame by UPACS_SignificanceUpdateSubsystem; planes
+		// registered by this pass are ranked from their first update on
+		SyncSignificanceRegistrations(SignificanceManager, Registry);
+
+		for (const USignificanceManager::FManagedObjectInfo* Info : SignificanceManager->GetManagedObjects(SignificanceTag))
+		{
+			if (UPACS_SelectionPlaneComponent* Plane = Cast<UPACS_SelectionPlaneComponent>(Info->GetObject()))
+			{
+				ScratchPlanes.Add(Plane);
+				ScratchInputs.Add({ Info->GetSignificance(), MinDistanceToViews(Plane, Viewpoints),
+					Plane->GetSelectionState() == (uint8)ESelectionVisualState::Selected });
+			}
+		}
+	}
+	else
+	{
+		// No PACS significance manager in this world - rank locally against the first view
+		const FTransform View = Viewpoints.Num() > 0 ? Viewpoints[0] : FTransform::Identity;
+		for (const TWeakObjectPtr<UPACS_SelectionPlaneComponent>& WeakPlane : Registry->GetSelectables())
+		{
+			if (UPACS_SelectionPlaneComponent* Plane = WeakPlane.Get())
+			{
+				ScratchPlanes.Add(Plane);
+				ScratchInputs.Add({ ComputePlaneSignificance(Plane, View), MinDistanceToViews(Plane, Viewpoints),
+					Plane->GetSelectionState() == (uint8)ESelectionVisualState::Selected });
+			}
+		}
+	}
+
+	ComputeBudget(ScratchInputs, FPACS_PlaneBudgetParams::FromSettings(), ScratchResults);
+
+	LastVisibleCount = 0;
+	for (int32 i = 0; i < ScratchPlanes.Num(); ++i)
+	{
+		ScratchPlanes[i]->ApplyBudget(ScratchResults[i].bVisible, ScratchResults[i].UpdateInterval);
+		LastVisibleCount += ScratchResults[i].bVisible ? 1 : 0;
+	}
+
+	SET_DWORD_STAT(STAT_PACSSelectionBudget_Visible, LastVisibleCount);
+}
+
+void UPACS_SelectionPlaneBudgeter::ComputeBudget(const TArray<FPACS_PlaneBudgetInput>& Inputs, const FPACS_PlaneBudgetParams& Params, TArray<FPACS_PlaneBudgetResult>& OutResults)
+{
+	OutResults.SetNum(Inputs.Num());
+
+	// Rank: selected first, then by significance
+	TArray<int32, TInlineAllocator<512>> Order;
+	Order.SetNumUninitialized(Inputs.Num());
+	for (int32 i = 0; i < Inputs.Num(); ++i)
+	{
+		Order[i] = i;
+	}
+	Order.Sort([&Inputs](int32 A, int32 B)
+	{
+		if (Inputs[A].bSelected != Inputs[B].bSelected)
+		{
+			return Inputs[A].bSelected;
+		}
+		return Inputs[A].Significance > Inputs[B].Significance;
+	});
+
+	const float NearInterval = 1.0f / FMath::Max(Params.NearUpdateRate, 1.0f);
+	const float FarInterval = 1.0f / FMath::Max(Params.FarUpdateRate, 1.0f);
+
+	int32 Shown = 0;
+	for (int32 Index : Order)
+	{
+		const FPACS_PlaneBudgetInput& Input = Inputs[Index];
+		FPACS_PlaneBudgetResult& Result = OutResults[Index];
+
+		Result.bVisible = Input.bSelected || (Shown < Params.MaxVisible && Input.Distance <= Params.MaxDistance);
+		Shown += Result.bVisible ? 1 : 0;
+
+		if (!Params.bThrottleUpdates)
+		{
+			Result.UpdateInterval = 0.0f;
+		}
+		else
+		{
+			Result.UpdateInterval = (Input.Distance <= Params.NearDistance) ? NearInterval : FarInterval;
+		}
+	}
+}
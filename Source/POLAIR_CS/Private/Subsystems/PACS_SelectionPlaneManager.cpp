@@ -0,0 +1,435 @@
+#include "Subsystems/PACS_SelectionPlaneManager.h"
+#include "Components/PACS_SelectionPlaneComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Materials/MaterialInterface.h"
+#include "Core/PACS_CollisionChannels.h"
+#include "Settings/PACS_NetPerfSettings.h"
+
+DECLARE_STATS_GROUP(TEXT("PACS_SelectionPlanes"), STATGROUP_PACSSelectionPlanes, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("SelectionPlanes Tick"), STAT_PACSSelectionPlanes_Tick, STATGROUP_PACSSelectionPlanes);
+DECLARE_DWORD_COUNTER_STAT(TEXT("SelectionPlanes Transform Updates"), STAT_PACSSelectionPlanes_TransformUpdates, STATGROUP_PACSSelectionPlanes);
+
+namespace
+{
+	UPACS_SelectionPlaneComponent* ToMutable(const UPACS_SelectionPlaneComponent* Plane)
+	{
+		return const_cast<UPACS_SelectionPlaneComponent*>(Plane);
+	}
+}
+
+bool UPACS_SelectionPlaneManager::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Selection visuals are client-only
+	UWorld* World = Cast<UWorld>(Outer);
+	if (!World)
+	{
+		return false;
+	}
+
+	return World->GetNetMode() != NM_DedicatedServer;
+}
+
+void UPACS_SelectionPlaneManager::Deinitialize()
+{
+	Entries.Reset();
+	Batches.Reset();
+
+	if (HostActor)
+	{
+		HostActor->Destroy();
+		HostActor = nullptr;
+	}
+
+	Super::Deinitialize();
+}
+
+TStatId UPACS_SelectionPlaneManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPACS_SelectionPlaneManager, STATGROUP_Tickables);
+}
+
+void UPACS_SelectionPlaneManager::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PACSSelectionPlanes_Tick);
+
+	const UWorld* World = GetWorld();
+	const int32 Updated = UpdateMovedInstances(World ? World->GetTimeSeconds() : 0.0);
+	SET_DWORD_STAT(STAT_PACSSelectionPlanes_TransformUpdates, Updated);
+}
+
+UMaterialInterface* UPACS_SelectionPlaneManager::GetInstancedMaterial()
+{
+	if (!InstancedMaterial)
+	{
+		const UPACS_NetPerfSettings* Settings = UPACS_NetPerfSettings::Get();
+		if (Settings && !Settings->InstancedSelectionPlaneMaterial.IsNull())
+		{
+			InstancedMaterial = Settings->InstancedSelectionPlaneMaterial.LoadSynchronous();
+		}
+	}
+	return InstancedMaterial;
+}
+
+AActor* UPACS_SelectionPlaneManager::GetOrCreateHostActor()
+{
+	if (HostActor)
+	{
+		return HostActor;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Name = MakeUniqueObjectName(World->PersistentLevel, AActor::StaticClass(), TEXT("PACS_SelectionPlaneHost"));
+	SpawnParams.ObjectFlags |= RF_Transient;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	HostActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+	if (!HostActor)
+	{
+		UE_LOG(LogTemp, Error, TEXT("SelectionPlaneManager: Failed to spawn host actor"));
+		return nullptr;
+	}
+
+	// Instances are placed in world space, so the host just needs an identity root
+	USceneComponent* Root = NewObject<USceneComponent>(HostActor, TEXT("Root"), RF_Transient);
+	HostActor->SetRootComponent(Root);
+	Root->RegisterComponent();
+
+	return HostActor;
+}
+
+int32 UPACS_SelectionPlaneManager::FindBatchIndex(const UStaticMesh* Mesh, const UMaterialInterface* Material) const
+{
+	return Batches.IndexOfByPredicate([Mesh, Material](const FPACS_SelectionPlaneBatch& Batch)
+	{
+		return Batch.Mesh == Mesh && Batch.Material == Material;
+	});
+}
+
+int32 UPACS_SelectionPlaneManager::FindOrCreateBatch(UStaticMesh* Mesh, UMaterialInterface* Material)
+{
+	const int32 Existing = FindBatchIndex(Mesh, Material);
+	if (Existing != INDEX_NONE)
+	{
+		return Existing;
+	}
+
+	AActor* Host = GetOrCreateHostActor();
+	if (!Host)
+	{
+		return INDEX_NONE;
+	}
+
+	UInstancedStaticMeshComponent* ISM = NewObject<UInstancedStaticMeshComponent>(Host, NAME_None, RF_Transient);
+	ISM->SetupAttachment(Host->GetRootComponent());
+	ISM->SetStaticMesh(Mesh);
+	ISM->SetMaterial(0, Material);
+	ISM->SetNumCustomDataFloats(NumCustomDataFloats);
+
+	// Same collision setup as the per-NPC plane so hover/selection traces keep working
+	ISM->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	ISM->SetCollisionObjectType(ECC_GameTraceChannel2); // SelectionObject type
+	ISM->SetCollisionResponseToAllChannels(ECR_Ignore);
+	ISM->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Block); // Block SelectionTrace channel
+	ISM->SetCollisionProfileName(PACS_CollisionProfiles::SelectionProfile);
+
+	// Visual settings for performance
+	ISM->SetCastShadow(false);
+	ISM->SetReceivesDecals(false);
+	ISM->bUseAsOccluder = false;
+	ISM->SetGenerateOverlapEvents(false);
+	ISM->SetIsReplicated(false);
+	ISM->RegisterComponent();
+
+	FPACS_SelectionPlaneBatch& Batch = Batches.AddDefaulted_GetRef();
+	Batch.ISM = ISM;
+	Batch.Mesh = Mesh;
+	Batch.Material = Material;
+
+	return Batches.Num() - 1;
+}
+
+FTransform UPACS_SelectionPlaneManager::ComputeWorldTransform(const UPACS_SelectionPlaneComponent* Plane, const FPlaneEntry& Entry, FTransform& OutAnchorTransform) const
+{
+	const AActor* Owner = Plane ? Plane->GetOwner() : nullptr;
+	const USceneComponent* Anchor = Owner ? Owner->GetRootComponent() : nullptr;
+
+	OutAnchorTransform = Anchor ? Anchor->GetComponentTransform() : FTransform::Identity;
+	return Entry.RelativeTransform * OutAnchorTransform;
+}
+
+bool UPACS_SelectionPlaneManager::AddOrUpdatePlane(UPACS_SelectionPlaneComponent* Plane, UStaticMesh* Mesh, UMaterialInterface* Material, const FTransform& RelativeTransform)
+{
+	if (!Plane || !Mesh)
+	{
+		return false;
+	}
+
+	// Changing mesh or material moves the plane to another batch
+	if (FPlaneEntry* Existing = Entries.Find(Plane))
+	{
+		const FPACS_SelectionPlaneBatch& CurrentBatch = Batches[Existing->BatchIndex];
+		if (CurrentBatch.Mesh == Mesh && CurrentBatch.Material == Material)
+		{
+			Existing->RelativeTransform = RelativeTransform;
+			const FTransform World = ComputeWorldTransform(Plane, *Existing, Existing->LastAnchorTransform);
+			CurrentBatch.ISM->UpdateInstanceTransform(Existing->InstanceIndex, World, true, true, true);
+			return true;
+		}
+
+		RemovePlane(Plane);
+	}
+
+	const int32 BatchIndex = FindOrCreateBatch(Mesh, Material);
+	if (BatchIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	FPACS_SelectionPlaneBatch& Batch = Batches[BatchIndex];
+
+	FPlaneEntry Entry;
+	Entry.BatchIndex = BatchIndex;
+	Entry.RelativeTransform = RelativeTransform;
+	const FTransform World = ComputeWorldTransform(Plane, Entry, Entry.LastAnchorTransform);
+
+	Entry.InstanceIndex = Batch.ISM->AddInstance(World, true);
+	check(Entry.InstanceIndex == Batch.InstanceOwners.Num());
+	Batch.InstanceOwners.Add(Plane);
+
+	Entries.Add(Plane, Entry);
+	return true;
+}
+
+void UPACS_SelectionPlaneManager::RemovePlane(UPACS_SelectionPlaneComponent* Plane)
+{
+	FPlaneEntry Entry;
+	if (!Entries.RemoveAndCopyValue(Plane, Entry))
+	{
+		return;
+	}
+
+	FPACS_SelectionPlaneBatch& Batch = Batches[Entry.BatchIndex];
+	UInstancedStaticMeshComponent* ISM = Batch.ISM;
+	const int32 LastIndex = Batch.InstanceOwners.Num() - 1;
+
+	// Swap the last instance into the freed slot so indices stay dense and no other instance shifts
+	if (Entry.InstanceIndex != LastIndex)
+	{
+		FTransform LastTransform;
+		ISM->GetInstanceTransform(LastIndex, LastTransform, true);
+		ISM->UpdateInstanceTransform(Entry.InstanceIndex, LastTransform, true, false, true);
+
+		TArray<float> LastCustomData;
+		LastCustomData.Append(&ISM->PerInstanceSMCustomData[LastIndex * NumCustomDataFloats], NumCustomDataFloats);
+		ISM->SetCustomData(Entry.InstanceIndex, LastCustomData, false);
+
+		const TWeakObjectPtr<UPACS_SelectionPlaneComponent> MovedOwner = Batch.InstanceOwners[LastIndex];
+		Batch.InstanceOwners[Entry.InstanceIndex] = MovedOwner;
+		if (FPlaneEntry* MovedEntry = Entries.Find(MovedOwner))
+		{
+			MovedEntry->InstanceIndex = Entry.InstanceIndex;
+		}
+	}
+
+	ISM->RemoveInstance(LastIndex);
+	Batch.InstanceOwners.Pop();
+}
+
+void UPACS_SelectionPlaneManager::SetPlaneCustomData(UPACS_SelectionPlaneComponent* Plane, const FLinearColor& Color, float Brightness, uint8 DisplayState)
+{
+	FPlaneEntry* Entry = Entries.Find(Plane);
+	if (!Entry)
+	{
+		return;
+	}
+
+	// Same layout as the per-NPC CustomPrimitiveData, plus the display state
+	const float CustomData[NumCustomDataFloats] = { Color.R, Color.G, Color.B, Brightness, Color.A, float(DisplayState) };
+	FMemory::Memcpy(Entry->PendingCustomData, CustomData, sizeof(CustomData));
+	Entry->bCustomDataPending = true;
+
+	// Unbudgeted planes write straight away; budgeted ones wait for their update slot
+	if (Entry->UpdateInterval <= 0.0f && Entry->bVisible)
+	{
+		FlushPendingCustomData(*Entry);
+	}
+}
+
+void UPACS_SelectionPlaneManager::FlushPendingCustomData(FPlaneEntry& Entry)
+{
+	if (!Entry.bCustomDataPending)
+	{
+		return;
+	}
+
+	FPACS_SelectionPlaneBatch& Batch = Batches[Entry.BatchIndex];
+	Batch.ISM->SetCustomData(Entry.InstanceIndex, MakeArrayView(Entry.PendingCustomData, NumCustomDataFloats), true);
+	Entry.bCustomDataPending = false;
+}
+
+void UPACS_SelectionPlaneManager::SetPlaneVisible(UPACS_SelectionPlaneComponent* Plane, bool bVisible)
+{
+	FPlaneEntry* Entry = Entries.Find(Plane);
+	if (!Entry || Entry->bVisible == bVisible)
+	{
+		return;
+	}
+
+	Entry->bVisible = bVisible;
+	FPACS_SelectionPlaneBatch& Batch = Batches[Entry->BatchIndex];
+
+	if (bVisible)
+	{
+		// Catch up immediately rather than waiting for the next slot
+		const FTransform World = ComputeWorldTransform(Plane, *Entry, Entry->LastAnchorTransform);
+		Batch.ISM->UpdateInstanceTransform(Entry->InstanceIndex, World, true, true, true);
+		FlushPendingCustomData(*Entry);
+		Entry->NextUpdateTime = 0.0;
+	}
+	else
+	{
+		// Zero scale keeps the instance (and its index) without drawing it
+		FTransform Hidden = Entry->RelativeTransform * Entry->LastAnchorTransform;
+		Hidden.SetScale3D(FVector::ZeroVector);
+		Batch.ISM->UpdateInstanceTransform(Entry->InstanceIndex, Hidden, true, true, true);
+	}
+}
+
+void UPACS_SelectionPlaneManager::SetPlaneUpdateInterval(UPACS_SelectionPlaneComponent* Plane, float Interval)
+{
+	if (FPlaneEntry* Entry = Entries.Find(Plane))
+	{
+		Entry->UpdateInterval = FMath::Max(Interval, 0.0f);
+	}
+}
+
+bool UPACS_SelectionPlaneManager::IsPlaneVisible(const UPACS_SelectionPlaneComponent* Plane) const
+{
+	const FPlaneEntry* Entry = Entries.Find(ToMutable(Plane));
+	return Entry && Entry->bVisible;
+}
+
+int32 UPACS_SelectionPlaneManager::GetPlaneUpdateCount(const UPACS_SelectionPlaneComponent* Plane) const
+{
+	const FPlaneEntry* Entry = Entries.Find(ToMutable(Plane));
+	return Entry ? Entry->UpdateCount : 0;
+}
+
+int32 UPACS_SelectionPlaneManager::UpdateMovedInstances(double Now)
+{
+	int32 Updated = 0;
+
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		UPACS_SelectionPlaneComponent* Plane = It.Key().Get();
+		if (!Plane)
+		{
+			continue; // Cleaned up by RemovePlane from EndPlay
+		}
+
+		// Hidden planes and planes between update slots are left alone
+		FPlaneEntry& Entry = It.Value();
+		if (!Entry.bVisible || Now < Entry.NextUpdateTime)
+		{
+			continue;
+		}
+
+		if (Entry.UpdateInterval > 0.0f)
+		{
+			// Stay on the cadence, but restart it after a hitch instead of bunching up updates
+			Entry.NextUpdateTime += Entry.UpdateInterval;
+			if (Entry.NextUpdateTime <= Now)
+			{
+				Entry.NextUpdateTime = Now + Entry.UpdateInterval;
+			}
+		}
+		++Entry.UpdateCount;
+
+		FlushPendingCustomData(Entry);
+
+		FTransform AnchorTransform;
+		const FTransform World = ComputeWorldTransform(Plane, Entry, AnchorTransform);
+
+		if (AnchorTransform.Equals(Entry.LastAnchorTransform, KINDA_SMALL_NUMBER))
+		{
+			continue;
+		}
+
+		Entry.LastAnchorTransform = AnchorTransform;
+
+		FPACS_SelectionPlaneBatch& Batch = Batches[Entry.BatchIndex];
+		Batch.ISM->UpdateInstanceTransform(Entry.InstanceIndex, World, true, true, true);
+		++Updated;
+	}
+
+	return Updated;
+}
+
+UPACS_SelectionPlaneComponent* UPACS_SelectionPlaneManager::ResolveHitPlane(const FHitResult& HitResult) const
+{
+	const UPrimitiveComponent* HitComponent = HitResult.GetComponent();
+	if (!HitComponent || HitComponent->GetOwner() != HostActor || HitResult.Item == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	for (const FPACS_SelectionPlaneBatch& Batch : Batches)
+	{
+		if (Batch.ISM == HitComponent)
+		{
+			return Batch.InstanceOwners.IsValidIndex(HitResult.Item) ? Batch.InstanceOwners[HitResult.Item].Get() : nullptr;
+		}
+	}
+
+	return nullptr;
+}
+
+AActor* UPACS_SelectionPlaneManager::ResolveHitActor(const FHitResult& HitResult) const
+{
+	if (const UPACS_SelectionPlaneComponent* Plane = ResolveHitPlane(HitResult))
+	{
+		return Plane->GetOwner();
+	}
+
+	return HitResult.GetActor();
+}
+
+bool UPACS_SelectionPlaneManager::HasPlane(const UPACS_SelectionPlaneComponent* Plane) const
+{
+	return Entries.Contains(ToMutable(Plane));
+}
+
+int32 UPACS_SelectionPlaneManager::GetBatchInstanceCount(int32 BatchIndex) const
+{
+	return Batches.IsValidIndex(BatchIndex) ? Batches[BatchIndex].InstanceOwners.Num() : 0;
+}
+
+UPACS_SelectionPlaneComponent* UPACS_SelectionPlaneManager::GetInstanceOwner(int32 BatchIndex, int32 InstanceIndex) const
+{
+	if (!Batches.IsValidIndex(BatchIndex) || !Batches[BatchIndex].InstanceOwners.IsValidIndex(InstanceIndex))
+	{
+		return nullptr;
+	}
+
+	return Batches[BatchIndex].InstanceOwners[InstanceIndex].Get();
+}
+
+int32 UPACS_SelectionPlaneManager::GetInstanceIndex(const UPACS_SelectionPlaneComponent* Plane) const
+{
+	const FPlaneEntry* Entry = Entries.Find(ToMutable(Plane));
+	return Entry ? Entry->InstanceIndex : INDEX_NONE;
+}
+
+UInstancedStaticMeshComponent* UPACS_SelectionPlaneManager::GetBatchComponent(int32 BatchIndex) const
+{
+	return Batches.IsValidIndex(BatchIndex) ? Batches[BatchIndex].ISM : nullptr;
+}
@@ -0,0 +1,104 @@
+#include "Subsystems/PACS_ServerClockSubsystem.h"
+#include "Settings/PACS_NetPerfSettings.h"
+#include "GameFramework/GameStateBase.h"
+#include "Engine/World.h"
+
+FPACS_ServerClockParams FPACS_ServerClockParams::FromSettings()
+{
+	FPACS_ServerClockParams Out;
+	if (const UPACS_NetPerfSettings* Settings = UPACS_NetPerfSettings::Get())
+	{
+		Out.bSmooth = Settings->bSmoothServerClock;
+		Out.SlewRate = Settings->ServerClockSlewRate;
+		Out.SnapThresholdS = Settings->ServerClockSnapThresholdS;
+	}
+	return Out;
+}
+
+double FPACS_SmoothedServerClock::Update(double RawServerS, double LocalS, const FPACS_ServerClockParams& Params)
+{
+	if (!bInitialized || !Params.bSmooth)
+	{
+		SmoothedS = RawServerS;
+		LastLocalS = LocalS;
+		ErrorS = 0.0;
+		bInitialized = true;
+		return SmoothedS;
+	}
+
+	// Local time going backwards means a new world or a rewind; nothing to smooth across
+	const double DeltaS = LocalS - LastLocalS;
+	LastLocalS = LocalS;
+	if (DeltaS < 0.0)
+	{
+		SmoothedS = RawServerS;
+		ErrorS = 0.0;
+		++SnapCount;
+		return SmoothedS;
+	}
+
+	const double PredictedS = SmoothedS + DeltaS;
+	const double Error = RawServerS - PredictedS;
+
+	if (FMath::Abs(Error) > Params.SnapThresholdS)
+	{
+		SmoothedS = RawServerS;
+		ErrorS = 0.0;
+		++SnapCount;
+		return SmoothedS;
+	}
+
+	const double MaxCorrection = FMath::Clamp<double>(Params.SlewRate, 0.0, 0.95) * DeltaS;
+	SmoothedS = PredictedS + FMath::Clamp(Error, -MaxCorrection, MaxCorrection);
+	ErrorS = RawServerS - SmoothedS;
+	return SmoothedS;
+}
+
+void UPACS_ServerClockSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	Params = FPACS_ServerClockParams::FromSettings();
+}
+
+double UPACS_ServerClockSubsystem::ReadRawServerS() const
+{
+	const UWorld* World = GetWorld();
+	if (const AGameStateBase* GS = World->GetGameState())
+	{
+		return GS->GetServerWorldTimeSeconds();
+	}
+	return World->GetTimeSeconds();
+}
+
+double UPACS_ServerClockSubsystem::GetServerNowS()
+{
+	const double LocalS = GetWorld()->GetTimeSeconds();
+	if (bHasCachedValue && LocalS == CachedLocalS)
+	{
+		return CachedServerS;
+	}
+
+	CachedServerS = Clock.Update(ReadRawServerS(), LocalS, Params);
+	CachedLocalS = LocalS;
+	bHasCachedValue = true;
+	return CachedServerS;
+}
+
+double UPACS_ServerClockSubsystem::GetServerNowS(const UWorld* World)
+{
+	if (!World)
+	{
+		return 0.0;
+	}
+
+	if (UPACS_ServerClockSubsystem* Subsystem = World->GetSubsystem<UPACS_ServerClockSubsystem>())
+	{
+		return Subsystem->GetServerNowS();
+	}
+
+	if (const AGameStateBase* GS = World->GetGameState())
+	{
+		return GS->GetServerWorldTimeSeconds();
+	}
+	return World->GetTimeSeconds();
+}
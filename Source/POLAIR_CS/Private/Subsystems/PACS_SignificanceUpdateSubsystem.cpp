@@ -0,0 +1,40 @@
+#include "Subsystems/PACS_SignificanceUpdateSubsystem.h"
+#include "Data/Settings/PACS_CustomSignificanceManager.h"
+#include "Data/PACS_SignificanceViewpoints.h"
+#include "Engine/World.h"
+
+bool UPACS_SignificanceUpdateSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// The PACS significance manager only exists on clients
+	UWorld* World = Cast<UWorld>(Outer);
+	if (!World)
+	{
+		return false;
+	}
+
+	return World->GetNetMode() != NM_DedicatedServer;
+}
+
+TStatId UPACS_SignificanceUpdateSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPACS_SignificanceUpdateSubsystem, STATGROUP_Tickables);
+}
+
+void UPACS_SignificanceUpdateSubsystem::Tick(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	UPACS_CustomSignificanceManager* SignificanceManager = UPACS_CustomSignificanceManager::Get(World);
+	if (!SignificanceManager)
+	{
+		return;
+	}
+
+	// Player views, or HMD plus orbit look-ahead for helicopter candidates
+	ScratchViewpoints.Reset();
+	FPACS_SignificanceViewpoints::GatherLocal(World, ScratchViewpoints);
+
+	if (ScratchViewpoints.Num() > 0)
+	{
+		SignificanceManager->UpdateOncePerFrame(ScratchViewpoints);
+	}
+}
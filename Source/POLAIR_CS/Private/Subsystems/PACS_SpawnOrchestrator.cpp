@@ -13,6 +13,7 @@
 #include "GameFramework/Actor.h"
 #include "TimerManager.h"
 #include "Engine/AssetManager.h"
+#include "Core/PACS_Log.h"
 
 void UPACS_SpawnOrchestrator::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -459,15 +460,11 @@ void UPACS_SpawnOrchestrator::PrepareActorForUse(AActor* Actor, const FSpawnRequ
 {
 	if (!Actor)
 	{
-		UE_LOG(LogTemp, Error, TEXT("PACS_SpawnOrchestrator: PrepareActorForUse called with null actor"));
+		UE_LOG(LogPACSSpawn, Error, TEXT("PACS_SpawnOrchestrator: PrepareActorForUse called with null actor"));
 		return;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("======================================================================"));
-	UE_LOG(LogTemp, Warning, TEXT("PACS_SpawnOrchestrator::PrepareActorForUse: START for %s"), *Actor->GetName());
-
 	// Set transform
-	UE_LOG(LogTemp, Warning, TEXT("PACS_SpawnOrchestrator::PrepareActorForUse: [STEP 1] Setting actor transform"));
 	Actor->SetActorTransform(Params.Transform);
 
 	// Set ownership
@@ -482,7 +479,6 @@ void UPACS_SpawnOrchestrator::PrepareActorForUse(AActor* Actor, const FSpawnRequ
 
 	// Apply selection profile from spawn config
 	// IMPORTANT: Profiles loaded on DS for SK mesh replication
-	UE_LOG(LogTemp, Warning, TEXT("PACS_SpawnOrchestrator::PrepareActorForUse: [STEP 2] Applying selection profile"));
 	FGameplayTag* TagPtr = ActorToTagMap.Find(Actor);
 	if (TagPtr && SpawnConfig)
 	{
@@ -493,42 +489,38 @@ void UPACS_SpawnOrchestrator::PrepareActorForUse(AActor* Actor, const FSpawnRequ
 			UPACS_SelectionProfileAsset* ProfileAsset = Config.SelectionProfile.Get();
 			if (ProfileAsset)
 			{
-				UE_LOG(LogTemp, Warning, TEXT("PACS_SpawnOrchestrator::PrepareActorForUse: Applying profile %s"), *ProfileAsset->GetName());
+				PACS_LOG_HOT(LogPACSSpawn, Verbose, TEXT("PACS_SpawnOrchestrator::PrepareActorForUse: Applying profile %s"), *ProfileAsset->GetName());
 				ApplySelectionProfileToActor(Actor, ProfileAsset);
 			}
 			else
 			{
 				// Profile wasn't preloaded - this is an error
-				UE_LOG(LogTemp, Error, TEXT("PACS_SpawnOrchestrator: Selection profile not preloaded for tag %s"),
+				UE_LOG(LogPACSSpawn, Error, TEXT("PACS_SpawnOrchestrator: Selection profile not preloaded for tag %s"),
 					*TagPtr->ToString());
 			}
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("PACS_SpawnOrchestrator::PrepareActorForUse: No selection profile configured for tag %s"),
+			PACS_LOG_HOT(LogPACSSpawn, Log, TEXT("PACS_SpawnOrchestrator::PrepareActorForUse: No selection profile configured for tag %s"),
 				TagPtr ? *TagPtr->ToString() : TEXT("NULL"));
 		}
 	}
 
 	// Enable actor
-	UE_LOG(LogTemp, Warning, TEXT("PACS_SpawnOrchestrator::PrepareActorForUse: [STEP 3] Enabling actor"));
 	Actor->SetActorHiddenInGame(false);
 	Actor->SetActorEnableCollision(true);
 	Actor->SetActorTickEnabled(true);
 
 	// Prepare replication
-	UE_LOG(LogTemp, Warning, TEXT("PACS_SpawnOrchestrator::PrepareActorForUse: [STEP 4] Preparing replication state"));
 	PrepareReplicationState(Actor);
 
 	// Call poolable interface if implemented
-	UE_LOG(LogTemp, Warning, TEXT("PACS_SpawnOrchestrator::PrepareActorForUse: [STEP 5] Calling OnAcquiredFromPool"));
 	if (Actor->GetClass()->ImplementsInterface(UPACS_Poolable::StaticClass()))
 	{
 		IPACS_Poolable::Execute_OnAcquiredFromPool(Actor);
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("PACS_SpawnOrchestrator::PrepareActorForUse: COMPLETE for %s"), *Actor->GetName());
-	UE_LOG(LogTemp, Warning, TEXT("======================================================================"));
+	PACS_LOG_HOT(LogPACSSpawn, Verbose, TEXT("PACS_SpawnOrchestrator::PrepareActorForUse: prepared %s"), *Actor->GetName());
 }
 
 void UPACS_SpawnOrchestrator::LoadActorClass(FGameplayTag SpawnTag)
@@ -104,6 +104,9 @@ protected:
 	// Visual feedback
 	virtual void UpdateSelectionVisuals();
 
+	// Selected/hovered NPCs tick at full rate; the significance manager restores the distance band after
+	void RefreshSignificance();
+
 	// Pool state management
 	virtual void ResetForPool();
 	virtual void PrepareForUse();
@@ -28,8 +28,9 @@ public:
     APACS_AssessorPawn();
 
     // IPACS_InputReceiver
-    virtual EPACS_InputHandleResult HandleInputAction(FName ActionName, const FInputActionValue& Value) override;
+    virtual EPACS_InputHandleResult HandleInputActionId(uint16 ActionId, FName ActionName, const FInputActionValue& Value) override;
     virtual int32 GetInputPriority() const override { return PACS_InputPriority::Gameplay; }
+    virtual void GetSubscribedActions(TArray<FName>& OutActions) const override;
 
     // Config
     UPROPERTY(EditDefaultsOnly, Category="Assessor|Config")
@@ -1,6 +1,7 @@
 #pragma once
 #include "GameFramework/Character.h"
 #include "Data/PACS_InputTypes.h"
+#include "Data/PACS_OrbitMessages.h"
 #include "PACS_CandidateHelicopterCharacter.generated.h"
 
 class UPACS_HeliMovementComponent;
@@ -150,9 +151,9 @@ public:
 
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out) const override;
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void PossessedBy(AController* NewController) override;
     virtual void OnRep_Controller() override;
-    virtual void Tick(float DeltaSeconds) override;
 
     UFUNCTION(BlueprintCallable) void CenterSeatedPose(bool bSnapYawToVehicleForward = true);
     void NudgeSeatX(float Sign); void NudgeSeatY(float Sign); void NudgeSeatZ(float Sign);
@@ -160,17 +161,47 @@ public:
 
     UFUNCTION(Server, Reliable) void Server_ApplyOrbitParams(const struct FPACS_OrbitEdit& Edit);
 
+    // Client: merge an edit into the accumulator; sent through Server_ApplyOrbitParams at the NetPerf rate.
+    // Entry point for orbit edit UI, which calls this instead of the RPC
+    void QueueOrbitEdit(const FPACS_OrbitEdit& Edit);
+    void FlushOrbitEdits();
+
+    // Server: validate and apply the edits coalesced since last tick with a single version bump
+    void ApplyPendingOrbitEdits();
+
+    uint32 OrbitEditRPCsSent = 0;
+    uint32 OrbitCenterValidations = 0;
+
     UFUNCTION(Server, Reliable) void Server_RequestSelect(APlayerState* Requestor);
     UFUNCTION(Server, Reliable) void Server_ReleaseSelect(APlayerState* Requestor);
 
     void ApplyOffsetsThenSeed(const FPACS_OrbitOffsets* Off);
 
+    // Keeps CCTV camera 2 above the helicopter with a fixed world rotation; driven by the movement step
+    void UpdateStaticCameraPosition(float DeltaSeconds);
+
+    // Significance manager tag for simulated-proxy helicopters
+    static const FName SignificanceTag;
+
+    // Local VR candidate's significance views: HMD pose, gaze ground point and the upcoming orbit arc
+    void GetSignificanceViewpoints(TArray<FTransform>& Out) const;
+
+    // Simulated proxies: distant ones (no local view within DistantBankDistanceCm) update bank less often.
+    // Registered from BeginPlay; unregistered on EndPlay even if the role changed since
+    void RegisterSignificance();
+    void UnregisterSignificance();
+    bool IsSignificanceRegistered() const { return bSignificanceRegistered; }
+
+    // Bank and the static camera follow run from the movement step; only Blueprint tick needs the actor tick (BeginPlay)
+    void DisableActorTickIfUnused();
+
     // Register with input on local possess; unregister on unpossess
     virtual void UnPossessed() override;
 
     // IPACS_InputReceiver
-    virtual EPACS_InputHandleResult HandleInputAction(FName ActionName, const FInputActionValue& Value) override;
+    virtual EPACS_InputHandleResult HandleInputActionId(uint16 ActionId, FName ActionName, const FInputActionValue& Value) override;
     virtual int32 GetInputPriority() const override { return PACS_InputPriority::Gameplay; } // keep it at gameplay
+    virtual void GetSubscribedActions(TArray<FName>& OutActions) const override;
 
 private:
     void RegisterAsReceiverIfLocal();
@@ -185,7 +216,9 @@ private:
     void ToggleCamZoom();  // Legacy - cycles through ortho zoom levels now
     void SetupCCTV2();
     void ToggleCam2Zoom(); // Legacy - cycles through ortho zoom levels now
-    void UpdateStaticCameraPosition(float DeltaSeconds);
+
+    // Hand both CCTV cameras to the world's capture scheduler; each counts as displayed while its cockpit monitor is rendered
+    void RegisterCCTVFeeds();
 
     // Orthographic zoom cycling
     void CycleCamera1Zoom();
@@ -195,11 +228,20 @@ private:
     UPROPERTY(EditDefaultsOnly, Category = "PACS|VR Seat")
     float SeatNudgeStepCm = 2.f; // tune in BP/data
 
+    FPACS_OrbitEditAccumulator OrbitEditAccumulator;
+    FTimerHandle OrbitEditSendTimer;
+
+    FPACS_OrbitEdit PendingServerEdit;
+    bool bHasPendingServerEdit = false;
+
+    // The significance manager holds a raw pointer to us while this is set
+    bool bSignificanceRegistered = false;
+    FTimerHandle OrbitEditApplyTimer;
+
 protected:
     UFUNCTION() void OnRep_OrbitTargets();
     UFUNCTION() void OnRep_OrbitAnchors();
     UFUNCTION() void OnRep_SelectedBy();
 
     bool ValidateOrbitCenter(const FVector& Proposed) const;
-    void UpdateBankVisual(float DeltaSeconds);
 };
\ No newline at end of file
@@ -7,11 +7,18 @@
 class UPACS_InputHandlerComponent;
 class APACS_AssessorPawn;
 class UAssessorPawnConfig;
+class IInputProcessor;
+class FViewport;
 
 /**
  * Edge scrolling component for PlayerController
  * Handles mouse edge detection and applies movement to AssessorPawn
  * Client-side only - no replication required
+ *
+ * Event driven: the tick is off while the cursor is away from the edges. A Slate input
+ * pre-processor re-enables it on mouse movement; the tick reads the cursor once and turns
+ * itself off again outside the edge margin. Window/menu/modal/capture state is cached and
+ * only re-queried after focus, activation, modal, mouse button or viewport resize events.
  */
 UCLASS(NotBlueprintable, ClassGroup=(Input), meta=(BlueprintSpawnableComponent=false))
 class POLAIR_CS_API UPACS_EdgeScrollComponent : public UActorComponent
@@ -23,7 +30,7 @@ public:
 
     // Enable/disable edge scrolling (for debugging/testing)
     UFUNCTION(BlueprintCallable, Category="PACS|EdgeScroll")
-    void SetEnabled(bool bNewEnabled) { bEnabled = bNewEnabled; }
+    void SetEnabled(bool bNewEnabled);
 
     UFUNCTION(BlueprintPure, Category="PACS|EdgeScroll")
     bool IsEnabled() const { return bEnabled; }
@@ -38,6 +45,27 @@ public:
     UFUNCTION(BlueprintPure, Category="PACS|EdgeScroll|Debug")
     bool IsDebugVisualizationEnabled() const { return bShowDebugVisualization; }
 
+    // --- Event entry points (input pre-processor, viewport resize) ---
+
+    // Mouse moved somewhere: wake the tick so the next frame re-reads the cursor
+    void NotifyCursorActivity();
+
+    // Mouse button went down/up; bAnyHeld = buttons still pressed after the event
+    void NotifyMouseButtons(bool bAnyHeld);
+
+    // Viewport size in pixels and its DPI scale (resize event, or read lazily once)
+    void SetViewportMetrics(const FVector2D& SizePx, float DPIScale);
+
+    // Evaluate a cursor position (viewport pixels); keeps the tick on only inside the edge margin
+    void ProcessCursor(const FVector2D& MousePos);
+
+    bool IsCursorInEdgeZone(const FVector2D& MousePos) const;
+
+    // Slate / viewport queries issued (window, menus, modal, capture, cursor, viewport size)
+    int32 GetSlateQueryCount() const { return SlateQueryCount; }
+    int32 GetActiveTickCount() const { return ActiveTickCount; }
+    void ResetCounters() { SlateQueryCount = 0; ActiveTickCount = 0; }
+
 protected:
     virtual void BeginPlay() override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -56,17 +84,19 @@ private:
     bool bIsActivelyScrolling = false;
     bool bComponentReady = false;
 
-    // Performance caching
-    mutable bool bPermissionCacheValid = false;
-    mutable bool bCachedPermissionResult = false;
-    mutable float PermissionCacheTime = 0.0f;
-    static constexpr float PermissionCacheLifetime = 0.1f; // 100ms cache
+    // Slate-side permission (focus, modal, menus, capture, buttons); recomputed only after an event
+    mutable bool bSlatePermissionDirty = true;
+    mutable bool bCachedSlatePermission = false;
+    bool bMouseButtonHeld = false;
 
-    // Viewport caching (invalidated on window resize)
+    // Viewport caching (invalidated on viewport resize)
     mutable FVector2D CachedViewportSize = FVector2D::ZeroVector;
     mutable float CachedDPIScale = 1.0f;
     mutable bool bViewportCacheValid = false;
 
+    mutable int32 SlateQueryCount = 0;
+    int32 ActiveTickCount = 0;
+
     // Component references (cached for performance)
     UPROPERTY()
     TWeakObjectPtr<UPACS_InputHandlerComponent> CachedInputHandler;
@@ -74,16 +104,30 @@ private:
     UPROPERTY()
     TWeakObjectPtr<APACS_AssessorPawn> CachedAssessorPawn;
 
+#if !UE_SERVER
+    TSharedPtr<IInputProcessor> InputProcessor;
+    FDelegateHandle ActivationChangedHandle;
+    FDelegateHandle FocusChangingHandle;
+    FDelegateHandle PreModalHandle;
+    FDelegateHandle PostModalHandle;
+    FDelegateHandle ViewportResizedHandle;
+#endif
+
+    void BindSlateEvents();
+    void UnbindSlateEvents();
+    void MarkSlatePermissionDirty() { bSlatePermissionDirty = true; }
+    void HandleViewportResized(FViewport* Viewport, uint32 Unused);
+
     // Core logic methods
     bool ShouldAllowEdgeScrolling() const;
-    FVector2D ComputeEdgeScrollInput() const;
+    bool GetSlatePermission() const;
+    FVector2D ComputeEdgeScrollInput(const FVector2D& MousePos) const;
 
     // Helper methods
     bool GetDPIAwareMousePosition(FVector2D& OutMousePos) const;
-    bool IsMouseOverInteractiveUI(const FVector2D& MousePos, const FVector2D& ViewportSize, int32 EdgeMarginPx) const;
-    bool IsMouseCapturedOrButtonPressed() const;
     bool IsCurrentContextAllowedForEdgeScrolling() const;
     bool UpdateViewportCache() const;
+    int32 GetEdgeMarginPx() const;
     void UpdateComponentReadiness();
     void InvalidateCaches();
     void DrawDebugVisualization() const;
@@ -93,6 +137,4 @@ private:
     APACS_AssessorPawn* GetAssessorPawn() const;
     const UAssessorPawnConfig* GetAssessorConfig() const;
     APlayerController* GetPlayerController() const;
-
-    // Note: Viewport resize handling moved to tick-based checking in UE5.5
 };
\ No newline at end of file
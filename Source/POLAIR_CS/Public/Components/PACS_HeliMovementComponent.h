@@ -2,6 +2,10 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "PACS_HeliMovementComponent.generated.h"
 
+struct FPACS_OrbitTargets;
+struct FPACS_OrbitAnchors;
+struct FPACS_HeliOrbitState;
+
 UENUM()
 enum class EPACS_HeliMoveMode : uint8 { CMOVE_HeliOrbit = 0 };
 
@@ -19,6 +23,7 @@ public:
     UPROPERTY(EditDefaultsOnly) TObjectPtr<class UPACS_CandidateHelicopterData> Data;
 
     virtual void OnRegister() override;
+    virtual void OnUnregister() override;
     virtual void PhysCustom(float DeltaTime, int32 Iterations) override;
     virtual void OnMovementModeChanged(EMovementMode PrevMovementMode, uint8 PreviousCustomMode) override;
 
@@ -39,5 +44,57 @@ public:
     void ApplyAltitudePlane();
     void StepKinematics(float Dt);
 
+    // Visual bank after the step: coordinated-turn roll for the current angular velocity, clamped to
+    // MaxBankDeg, eased and written to HelicopterFrame only past BankApplyThresholdDeg.
+    void UpdateBank(float Dt);
+    static float ComputeBankTargetDeg(float InSpeedCms, float InRadiusCm, float MaxBankDeg);
+
+    // Seconds between bank updates (0 = every step); raised for distant proxies from significance
+    float BankUpdateInterval = 0.f;
+    int32 BankTransformUpdates = 0;
+
+    // Closed-form orbit: P(a) = Center + R*(-cos a, sin a, 0) at AltitudeCm; its derivative is the tangent below.
+    static FVector OrbitPositionAt(const FVector& Center, float Radius, float Angle, float Altitude);
+    static FVector OrbitTangentAt(float Angle);
+
+    // Pure orbit math shared by the per-component path and UPACS_HeliOrbitSolver (which may run it off the game thread)
+    static void EvalOrbitTargets(const FPACS_OrbitTargets& Targets, const FPACS_OrbitAnchors& Anchors,
+                                 const UPACS_CandidateHelicopterData& D, float NowS, float FrameDt,
+                                 FVector& InOutCenterCm, float& InOutAltitudeCm, float& InOutRadiusCm, float& InOutSpeedCms);
+    static float EvalOrbitAngle(const FPACS_OrbitAnchors& Anchors, float InSpeedCms, float InRadiusCm, float NowS, float CurrentAngleRad);
+    FVector EvalOrbitPosition() const { return OrbitPositionAt(CenterCm, RadiusCm, AngleRad, AltitudeCm); }
+
+    // Simulated-proxy step: same clock/eval/angle as the other roles, then the analytic placement.
+    void SimulateProxyStep(float Dt);
+    void StepAnalytic(float Dt);
+
+    // Cached coarse check for world-static geometry around the orbit; re-run every ProxyGeometryCheckIntervalS.
+    bool IsNearGeometry_Proxy();
+    void InvalidateProxyGeometryCache() { NextProxyGeometryCheckS = TNumericLimits<float>::Lowest(); }
+
+    int32 ProxyTeleportSteps = 0;
+    int32 ProxySweepSteps = 0;
+    int32 ProxyGeometryChecks = 0;
+    void ResetProxyCounters() { ProxyTeleportSteps = ProxySweepSteps = ProxyGeometryChecks = 0; }
+
+    // World-level solver: eligible components are gathered into the solver's state array each frame
+    bool IsOrbitSolverEligible() const;
+    void GatherOrbitState(FPACS_HeliOrbitState& Out) const;
+    void ApplyOrbitState(const FPACS_HeliOrbitState& In, double SolvedAtS);
+
+    // Runs the solver for this frame if needed; true when this component's orbit state is already up to date
+    bool ConsumeSolvedOrbit();
+
 private:
+    void SweepTo(const FVector& Target, const FRotator& Rot);
+
+    void PostStepVisuals(float Dt);
+
+    double SolvedAtS = -1.0;
+
+    float BankAccumS = 0.f;
+    float AppliedBankDeg = 0.f;
+
+    bool  bProxyNearGeometry = true;
+    float NextProxyGeometryCheckS = TNumericLimits<float>::Lowest();
 };
\ No newline at end of file
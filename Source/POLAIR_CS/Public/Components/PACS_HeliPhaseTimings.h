@@ -0,0 +1,63 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("PACS_Heli"), STATGROUP_PACSHeli, STATCAT_Advanced);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Heli TickClock"),          STAT_PACSHeli_TickClock,          STATGROUP_PACSHeli, POLAIR_CS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Heli Eval"),               STAT_PACSHeli_Eval,               STATGROUP_PACSHeli, POLAIR_CS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Heli ApplyAltitudePlane"), STAT_PACSHeli_ApplyAltitudePlane, STATGROUP_PACSHeli, POLAIR_CS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Heli UpdateAngle"),        STAT_PACSHeli_UpdateAngle,        STATGROUP_PACSHeli, POLAIR_CS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Heli StepKinematics"),     STAT_PACSHeli_StepKinematics,     STATGROUP_PACSHeli, POLAIR_CS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Heli UpdateBankVisual"),   STAT_PACSHeli_UpdateBankVisual,   STATGROUP_PACSHeli, POLAIR_CS_API);
+
+enum class EPACS_HeliPhase : uint8
+{
+    TickClock,
+    Eval,
+    ApplyAltitudePlane,
+    UpdateAngle,
+    StepKinematics,
+    UpdateBankVisual,
+    Count
+};
+
+/**
+ * Per-phase cycle totals for the helicopter update, collected only while bEnabled is set
+ * (benchmarks). The stat counters above cover the same scopes for "stat PACS_Heli" / Insights.
+ * Game thread only.
+ */
+struct POLAIR_CS_API FPACS_HeliPhaseTimings
+{
+    static constexpr int32 NumPhases = (int32)EPACS_HeliPhase::Count;
+
+    static bool   bEnabled;
+    static uint64 Cycles[NumPhases];
+    static uint64 Calls[NumPhases];
+
+    static void Reset();
+    static double GetMicroseconds(EPACS_HeliPhase Phase);
+    static const TCHAR* GetPhaseName(EPACS_HeliPhase Phase);
+};
+
+struct FPACS_ScopedHeliPhase
+{
+    explicit FPACS_ScopedHeliPhase(EPACS_HeliPhase InPhase)
+    : Phase(InPhase), StartCycles(FPACS_HeliPhaseTimings::bEnabled ? FPlatformTime::Cycles64() : 0) {}
+
+    ~FPACS_ScopedHeliPhase()
+    {
+        if (StartCycles)
+        {
+            FPACS_HeliPhaseTimings::Cycles[(int32)Phase] += FPlatformTime::Cycles64() - StartCycles;
+            ++FPACS_HeliPhaseTimings::Calls[(int32)Phase];
+        }
+    }
+
+private:
+    EPACS_HeliPhase Phase;
+    uint64 StartCycles;
+};
+
+#define PACS_HELI_PHASE(Phase) \
+    SCOPE_CYCLE_COUNTER(STAT_PACSHeli_##Phase); \
+    FPACS_ScopedHeliPhase PACSHeliPhaseScope_##Phase(EPACS_HeliPhase::Phase)
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Engine/EngineTypes.h"
+#include "Core/PACS_HoverScreenBucket.h"
 #include "PACS_HoverProbeComponent.generated.h"
 
 class APACS_PlayerController;
@@ -12,6 +13,12 @@ class UInputMappingContext;
  * Lean local-only hover probe component for NPCs
  * Runs at 30Hz, attaches to PlayerController, with input context gating
  * Epic pattern: Component-based hover detection with robust cleanup
+ *
+ * Hover cache (bUseHoverCache):
+ * - Probes are skipped while the cursor and camera stay within the thresholds below
+ * - Selectables from the registry are projected into a per-frame screen-space bucket; empty space
+ *   and unobstructed selectables resolve without a physics trace
+ * - A single confirming trace is issued only when the selectable under the cursor changes
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class POLAIR_CS_API UPACS_HoverProbeComponent : public UActorComponent
@@ -51,6 +58,43 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PACS|Hover")
 	TArray<TEnumAsByte<EObjectTypeQuery>> HoverObjectTypes;
 
+	// Resolve hovers from the screen-space bucket and skip probes when nothing moved
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PACS|Hover|Cache")
+	bool bUseHoverCache = true;
+
+	// Cursor movement (pixels) below which the previous probe result is reused
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PACS|Hover|Cache", meta=(ClampMin="0", EditCondition="bUseHoverCache"))
+	float CursorMoveThresholdPx = 2.0f;
+
+	// Camera translation (cm) below which the previous probe result is reused
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PACS|Hover|Cache", meta=(ClampMin="0", EditCondition="bUseHoverCache"))
+	float CameraMoveThreshold = 1.0f;
+
+	// Camera rotation (degrees) below which the previous probe result is reused
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PACS|Hover|Cache", meta=(ClampMin="0", EditCondition="bUseHoverCache"))
+	float CameraRotationThreshold = 0.1f;
+
+	// Re-probe at least this often even when idle, so NPCs walking under a still cursor are picked up
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PACS|Hover|Cache", meta=(ClampMin="0", EditCondition="bUseHoverCache"))
+	float MaxCacheAge = 0.25f;
+
+	// Extra pixels added around each projected selectable
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PACS|Hover|Cache", meta=(ClampMin="0", EditCondition="bUseHoverCache"))
+	float ScreenBoundsPaddingPx = 4.0f;
+
+	// Run one probe at an explicit cursor position and view (ProbeOnce feeds this from the PlayerController)
+	void ProbeAtScreenPosition(const FVector2D& CursorPosition, const FVector& ViewLocation, const FRotator& ViewRotation, double Now);
+
+	// Screen-space bucket used by the cache (exposed so tests can fill it without a viewport)
+	FPACS_HoverScreenBucket& GetScreenBucket() { return ScreenBucket; }
+
+	// Counters
+	int32 GetTraceCount() const { return TraceCount; }
+	int32 GetSkippedProbeCount() const { return SkippedProbeCount; }
+	void ResetProbeCounters() { TraceCount = 0; SkippedProbeCount = 0; }
+
+	class UPACS_SelectionPlaneComponent* GetCurrentHoverPlane() const { return CurrentHoverPlaneComponent.Get(); }
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -75,6 +119,40 @@ private:
 	void ProbeOnce();
 	void ClearHover();
 
+	// Legacy path: up to three cursor traces per probe
+	void ProbeWithTraces(const FVector2D& CursorPosition);
+
+	// Counted cursor traces
+	bool TraceObjectsAt(const FVector2D& CursorPosition, FHitResult& OutHit);
+	bool TraceChannelAt(const FVector2D& CursorPosition, ECollisionChannel Channel, FHitResult& OutHit);
+
+	// Project registered selectables into the bucket (once per frame)
+	void RebuildScreenBucket(const FVector& ViewLocation, const FRotator& ViewRotation);
+
+	// Selection plane hit by a trace (instanced planes resolve through the plane manager)
+	class UPACS_SelectionPlaneComponent* ResolveHitPlane(const FHitResult& HitResult);
+
+	// Cached FindComponentByClass
+	class UPACS_SelectionPlaneComponent* FindPlaneComponent(AActor* Actor);
+
+	// Hover the given plane if it is Available, otherwise clear
+	void ApplyHover(class UPACS_SelectionPlaneComponent* PlaneComponent);
+
+	// Hover cache state
+	FPACS_HoverScreenBucket ScreenBucket;
+	TMap<TWeakObjectPtr<AActor>, TWeakObjectPtr<class UPACS_SelectionPlaneComponent>> PlaneComponentCache;
+	TWeakObjectPtr<class UPACS_SelectionPlaneComponent> LastBucketCandidate;
+	TWeakObjectPtr<class UPACS_SelectionPlaneComponent> LastResolvedPlane;
+	FVector2D LastProbeCursor = FVector2D::ZeroVector;
+	FVector LastProbeViewLocation = FVector::ZeroVector;
+	FRotator LastProbeViewRotation = FRotator::ZeroRotator;
+	double LastProbeTime = 0.0;
+	double LastConfirmTime = 0.0;
+	bool bHasCachedProbe = false;
+
+	int32 TraceCount = 0;
+	int32 SkippedProbeCount = 0;
+
 	// Cleanup handlers
 	UFUNCTION()
 	void OnNPCDestroyed(AActor* DestroyedActor);
@@ -5,9 +5,15 @@
 #include "EnhancedInputSubsystems.h"
 #include "Data/PACS_InputTypes.h"
 #include "Data/Configs/PACS_InputMappingConfig.h"
+#include "Engine/StreamableManager.h"
 #include "PACS_InputHandlerComponent.generated.h"
 
 struct FInputActionInstance;
+class APawn;
+class UPACS_InputHandlerComponent;
+
+// Broadcast once per play session, the moment the handler has initialized
+DECLARE_MULTICAST_DELEGATE_OneParam(FPACS_OnInputReady, UPACS_InputHandlerComponent* /*Handler*/);
 
 UCLASS(NotBlueprintable, ClassGroup=(Input), meta=(BlueprintSpawnableComponent=false))
 class POLAIR_CS_API UPACS_InputHandlerComponent : public UActorComponent
@@ -20,8 +26,15 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="PACS|Input")
     TObjectPtr<UPACS_InputMappingConfig> InputConfig;
 
+    // Loaded asynchronously when InputConfig is not set directly; initialization waits for it
+    UPROPERTY(EditDefaultsOnly, Category="PACS|Input")
+    TSoftObjectPtr<UPACS_InputMappingConfig> InputConfigAsset;
+
     bool IsHealthy() const { return bIsInitialized && InputConfig && InputConfig->IsValid(); }
 
+    // Fired from inside the event that completed the last prerequisite
+    FPACS_OnInputReady OnInputReady;
+
     // --- Public API ---
     
     UFUNCTION(BlueprintCallable, Category="PACS|Input")
@@ -55,6 +68,12 @@ public:
     UFUNCTION(BlueprintPure, Category="PACS|Input")
     int32 GetOverlayCount() const { return OverlayStack.Num(); }
 
+    // Overlay pushes and pops are applied together at end of frame; this applies them now
+    void FlushContextChanges();
+
+    // Context diffs sent to the subsystem, each one deferred control-mapping rebuild
+    int32 GetContextRebuildRequests() const { return ContextRebuildRequests; }
+
     UFUNCTION(BlueprintPure, Category="PACS|Input")
     FString GetCurrentContextName() const;
 
@@ -62,8 +81,25 @@ public:
     UFUNCTION(BlueprintPure, Category="PACS|Input")
     UInputMappingContext* GetCurrentBaseContext() const;
 
+    // Resolves the UInputAction through the action map; kept for bindings made without an ID
     void HandleAction(const FInputActionInstance& Instance);
 
+    // Binding target with the action ID as payload (see ResolveActionId)
+    void HandleActionById(const FInputActionInstance& Instance, uint16 ActionId);
+
+    // Action ID for a configured UInputAction, InvalidId if it is not in InputConfig
+    uint16 ResolveActionId(const UInputAction* Action);
+
+    // Route an already-resolved action to its subscribers
+    EPACS_InputHandleResult DispatchAction(FName ActionName, const FInputActionValue& Value);
+    EPACS_InputHandleResult DispatchActionId(uint16 ActionId, const FInputActionValue& Value);
+
+    // Receivers that would be offered ActionName, in priority order
+    int32 GetDispatchReceiverCount(FName ActionName) const;
+
+    // Readiness events. Initialization runs inside whichever one completes the prerequisites
+    // (local player with an Enhanced Input subsystem, valid InputConfig); nothing polls.
+    void NotifyLocalPlayerReady();
     void OnSubsystemAvailable();
     void OnSubsystemUnavailable();
 
@@ -71,6 +107,14 @@ protected:
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
+#if !UE_SERVER
+    // Owner is a local player controller whose LocalPlayer has the Enhanced Input subsystem
+    virtual bool IsLocalPlayerReady() const;
+
+    // Issue the removes and adds with deferred options; false if there is no subsystem
+    virtual bool ApplyContextDiff(const FPACS_InputContextDiff& Diff);
+#endif
+
 private:
     UPROPERTY() 
     TArray<FPACS_InputReceiverEntry> Receivers;
@@ -84,8 +128,9 @@ private:
     UPROPERTY() 
     TArray<FPACS_OverlayEntry> OverlayStack;
 
+    // Contexts and priorities as last applied to the subsystem
     UPROPERTY()
-    TSet<TObjectPtr<UInputMappingContext>> ManagedContexts;
+    TMap<TObjectPtr<UInputMappingContext>, int32> ManagedContexts;
 
 #if !UE_SERVER
     bool bIsInitialized = false;
@@ -95,20 +140,41 @@ private:
     uint32 RegistrationCounter = 0;
     int32 InvalidReceiverCount = 0;
 
+    // Built with ActionToNameMap: UInputAction -> action ID, and which IDs an overlay blocks
+    TMap<const UInputAction*, uint16> ActionToIdMap;
+    TBitArray<> BlockedById;
+
+    // Indexed by action ID: indices into Receivers (already priority sorted), wildcard receivers merged in.
+    // IDs past the end of the table use WildcardDispatch. Rebuilt on register/unregister only.
+    TArray<TArray<int32>> DispatchById;
+    TArray<int32> WildcardDispatch;
+    uint32 DispatchVersion = 0;
+
     TWeakObjectPtr<UEnhancedInputLocalPlayerSubsystem> CachedSubsystem;
-    FTimerHandle InitRetryHandle;
-    uint32 LocalControllerRetryCount = 0;
-    static constexpr uint32 MaxLocalControllerRetries = 50; // ~5 seconds at 0.1s intervals
+    TSharedPtr<FStreamableHandle> ConfigLoadHandle;
+    FDelegateHandle PawnChangedHandle;
+
+    // Bound to FCoreDelegates::OnEndFrame while overlay changes are pending
+    FDelegateHandle ContextFlushHandle;
+    int32 ContextRebuildRequests = 0;
 
+    void TryInitialize();
     void Initialize();
     void Shutdown();
+    void RequestInputConfig();
+    void HandleInputConfigLoaded();
+    void HandlePawnChanged(APawn* NewPawn);
     void BuildActionNameMap();
     void EnsureActionMapBuilt();
     
-    EPACS_InputHandleResult RouteActionInternal(FName ActionName, const FInputActionValue& Value);
+    EPACS_InputHandleResult RouteActionInternal(uint16 ActionId, FName ActionName, const FInputActionValue& Value);
+    bool IsActionBlocked(uint16 ActionId, FName ActionName) const;
     void CleanInvalidReceivers();
     void SortReceivers();
+    void RebuildDispatchTable();
+    const TArray<int32>& GetDispatchList(uint16 ActionId) const;
     
+    void RequestContextUpdate();
     void UpdateManagedContexts();
     void RemoveAllManagedContexts();
     
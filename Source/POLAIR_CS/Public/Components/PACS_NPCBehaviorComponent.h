@@ -4,6 +4,7 @@
 #include "Components/ActorComponent.h"
 #include "Interfaces/PACS_Poolable.h"
 #include "Data/PACS_InputTypes.h"
+#include "Data/PACS_InputActionIds.h"
 #include "PACS_NPCBehaviorComponent.generated.h"
 
 class UPACS_InputHandlerComponent;
@@ -34,8 +35,9 @@ public:
 	// ========================================
 	// IPACS_InputReceiver Interface
 	// ========================================
-	virtual EPACS_InputHandleResult HandleInputAction(FName ActionName, const FInputActionValue& Value) override;
+	virtual EPACS_InputHandleResult HandleInputActionId(uint16 ActionId, FName ActionName, const FInputActionValue& Value) override;
 	virtual int32 GetInputPriority() const override { return 350; } // Below Gameplay (400)
+	virtual void GetSubscribedActions(TArray<FName>& OutActions) const override { OutActions.Add(PACS_InputActions::RightClick.GetName()); }
 
 	// ========================================
 	// Movement Commands
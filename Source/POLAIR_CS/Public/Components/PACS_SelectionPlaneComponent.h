@@ -10,6 +10,7 @@ class UStaticMeshComponent;
 class UMaterialInterface;
 class UStaticMesh;
 class UPACS_SelectionProfileAsset;
+class UPACS_SelectionPlaneManager;
 
 /**
  * Struct for storing state visuals (color + brightness)
@@ -32,6 +33,10 @@ struct FSelectionStateVisuals
  *
  * Uses CustomPrimitiveData for efficient per-actor customization
  * Compatible with object pooling system
+ *
+ * With bUseInstancedSelectionPlanes and an InstancedSelectionPlaneMaterial (NetPerf settings) no mesh
+ * component is created; the plane is drawn as an instance on UPACS_SelectionPlaneManager and the same
+ * values go to per-instance custom data
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class POLAIR_CS_API UPACS_SelectionPlaneComponent : public UActorComponent, public IPACS_Poolable
@@ -63,6 +68,16 @@ protected:
 	// Whether the component is initialized
 	bool bIsInitialized = false;
 
+	// Plane is drawn by the instanced selection plane manager instead of SelectionPlane
+	bool bUseInstancedPlane = false;
+
+	// Visibility granted by the selection plane budgeter
+	bool bBudgetVisible = true;
+
+	// Budgeter's last update interval, and the floor set by NPC significance throttling
+	float BudgetUpdateInterval = 0.0f;
+	float MinUpdateInterval = 0.0f;
+
 public:
 	// Initialize the selection plane (automatically called in BeginPlay for clients)
 	UFUNCTION(BlueprintCallable, Category = "PACS|Selection")
@@ -88,10 +103,24 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "PACS|Selection")
 	void SetHoverState(bool bHovered);
 
-	// Get the selection plane mesh component
+	// Get the selection plane mesh component (null when the plane is instanced)
 	UFUNCTION(BlueprintPure, Category = "PACS|Selection")
 	UStaticMeshComponent* GetSelectionPlane() const { return SelectionPlane; }
 
+	// Apply plane mesh, material and relative transform to whichever plane representation is active
+	void ApplyPlaneAssets(UStaticMesh* Mesh, UMaterialInterface* Material, const FTransform& RelativeTransform);
+
+	// True when this plane is rendered by the instanced selection plane manager
+	bool IsInstancedPlane() const { return bUseInstancedPlane; }
+
+	// Apply the budgeter's decision (visibility and update interval, 0 = every frame)
+	void ApplyBudget(bool bVisible, float UpdateInterval);
+	bool IsBudgetVisible() const { return bBudgetVisible; }
+
+	// Lower bound on the instanced plane update interval (owner's significance band, 0 = none)
+	void SetMinUpdateInterval(float Interval);
+	float GetMinUpdateInterval() const { return MinUpdateInterval; }
+
 	// Get current selection state (0=Hovered, 1=Selected, 2=Unavailable, 3=Available)
 	UFUNCTION(BlueprintPure, Category = "PACS|Selection")
 	uint8 GetSelectionState() const { return SelectionState; }
@@ -117,6 +146,12 @@ protected:
 	// Validate and apply mesh/material references (client-side)
 	void ValidateAndApplyAssets();
 
+	// Instanced plane manager for this world (null on dedicated servers)
+	UPACS_SelectionPlaneManager* GetPlaneManager() const;
+
+	// Relative transform of the plane; kept for re-adding the instance after a pool round trip
+	FTransform CachedPlaneRelativeTransform = FTransform::Identity;
+
 	// Replication callback
 	UFUNCTION()
 	void OnRep_SelectionState();
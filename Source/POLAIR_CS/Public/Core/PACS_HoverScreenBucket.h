@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UPACS_SelectionPlaneComponent;
+
+/**
+ * Screen-space bucket of projected selectable bounds
+ *
+ * Rebuilt at most once per frame from the selectable registry. Each selectable is stored as a
+ * screen rectangle plus view depth and hashed into a coarse grid, so a cursor lookup only tests
+ * the handful of rectangles in its cell instead of issuing a physics trace.
+ *
+ * Plain C++ (no UObject) so it can be filled directly by automation tests.
+ */
+class POLAIR_CS_API FPACS_HoverScreenBucket
+{
+public:
+	// Clear all entries and stamp the bucket with the frame it is being built for
+	void Reset(uint64 InFrameNumber, float InCellSize = 64.0f);
+
+	// Add a selectable's screen rectangle (pixels, viewport space) and distance from the view
+	void Add(const FBox2D& ScreenRect, float Depth, UPACS_SelectionPlaneComponent* Plane);
+
+	// Nearest (smallest depth) selectable whose rectangle contains the point, or nullptr
+	UPACS_SelectionPlaneComponent* FindNearestAt(const FVector2D& ScreenPoint) const;
+
+	int32 Num() const { return Entries.Num(); }
+	uint64 GetBuildFrame() const { return BuildFrame; }
+
+private:
+	struct FEntry
+	{
+		FBox2D Rect;
+		float Depth = 0.0f;
+		TWeakObjectPtr<UPACS_SelectionPlaneComponent> Plane;
+	};
+
+	FIntPoint ToCell(const FVector2D& ScreenPoint) const;
+
+	TArray<FEntry> Entries;
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	// Entries spanning too many cells (selectables right in front of the camera) are tested linearly
+	TArray<int32> Oversized;
+
+	float CellSize = 64.0f;
+	uint64 BuildFrame = MAX_uint64;
+};
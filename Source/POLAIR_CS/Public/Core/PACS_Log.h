@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogMacros.h"
+
+/**
+ * PACS logging policy
+ *
+ * - Each subsystem logs to its own category, declared with PACS_LOG_COMPILE_MAX as the compile-time
+ *   ceiling: Shipping and Test builds keep Warning and above, everything below compiles out
+ * - Per-action / per-actor lines use PACS_LOG_HOT. Nothing (arguments included) is evaluated unless
+ *   the category is active and the call site is sampled by pacs.Log.Hot:
+ *   0 = hot-path lines off (default), 1 = every line, N = one in N per call site
+ * - Errors and rare state changes keep plain UE_LOG
+ */
+#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+#define PACS_LOG_COMPILE_MAX Warning
+#else
+#define PACS_LOG_COMPILE_MAX All
+#endif
+
+POLAIR_CS_API DECLARE_LOG_CATEGORY_EXTERN(LogPACSSelection, Log, PACS_LOG_COMPILE_MAX);
+POLAIR_CS_API DECLARE_LOG_CATEGORY_EXTERN(LogPACSSpawn, Log, PACS_LOG_COMPILE_MAX);
+
+namespace PACS_Log
+{
+    // Backing value of pacs.Log.Hot
+    extern POLAIR_CS_API int32 HotSampleRate;
+
+    // Advances the call site's counter; true when this call should be logged
+    FORCEINLINE bool ShouldSampleHot(uint32& SiteCounter)
+    {
+        const int32 Rate = HotSampleRate;
+        if (Rate <= 0)
+        {
+            return false;
+        }
+        return (SiteCounter++ % uint32(Rate)) == 0;
+    }
+}
+
+// Sampled log line for hot paths (game thread; the per-site counter is not atomic)
+#define PACS_LOG_HOT(CategoryName, Verbosity, Format, ...) \
+    do \
+    { \
+        if (UE_LOG_ACTIVE(CategoryName, Verbosity)) \
+        { \
+            static uint32 PACSHotLogSiteCounter = 0; \
+            if (PACS_Log::ShouldSampleHot(PACSHotLogSiteCounter)) \
+            { \
+                UE_LOG(CategoryName, Verbosity, Format, ##__VA_ARGS__); \
+            } \
+        } \
+    } while (0)
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EPACS_MarqueeState : uint8
+{
+    // Button up: nothing is evaluated
+    Idle,
+    // Button down, waiting for a mouse move past the drag threshold
+    Pressed,
+    // Marquee shown; a query is due whenever the rect changes
+    Dragging
+};
+
+/**
+ * Input-driven marquee selection state
+ *
+ * - Press records the start point; mouse-move events are the only samples
+ * - A sample further than the drag threshold from the start turns Pressed into Dragging
+ * - While dragging, a query is due when the rect differs from the one last queried, no more
+ *   often than the configured rate; GetQueryDelay tells the caller when a held-back one may run
+ * - Release (Reset) returns to Idle
+ *
+ * Nothing happens between events, so an idle or motionless cursor costs nothing.
+ * Plain C++ (no UObject) so it can be driven directly by automation tests.
+ */
+class POLAIR_CS_API FPACS_MarqueeTracker
+{
+public:
+    void Configure(float InDragThresholdPx, float InMaxQueryRateHz);
+
+    void Press(const FVector2D& Pos);
+
+    // Returns true when this sample started the marquee
+    bool Move(const FVector2D& Pos);
+
+    // Release or cancel: back to Idle
+    void Reset();
+
+    // True (and the rect marked as queried) when the rect changed since the last query and the
+    // rate allows a query now; bIgnoreRate is for the final query on release
+    bool ConsumeQuery(double NowS, bool bIgnoreRate = false);
+
+    bool IsQueryPending() const;
+
+    // Seconds until a pending query may run (0 = now), negative if none is pending
+    float GetQueryDelay(double NowS) const;
+
+    EPACS_MarqueeState GetState() const { return State; }
+    bool IsDragging() const { return State == EPACS_MarqueeState::Dragging; }
+    const FVector2D& GetStart() const { return Start; }
+    const FVector2D& GetCurrent() const { return Current; }
+    void GetRect(FVector2D& OutMin, FVector2D& OutMax) const;
+
+    // Queries handed out since the last ResetCounters
+    int32 GetQueryCount() const { return QueryCount; }
+    void ResetCounters() { QueryCount = 0; }
+
+private:
+    EPACS_MarqueeState State = EPACS_MarqueeState::Idle;
+    FVector2D Start = FVector2D::ZeroVector;
+    FVector2D Current = FVector2D::ZeroVector;
+
+    float DragThresholdPx = 5.0f;
+    float MinQueryIntervalS = 1.0f / 30.0f;
+
+    // Corner the last query used (Start is fixed for the drag)
+    FVector2D LastQueried = FVector2D::ZeroVector;
+    bool bHasQueried = false;
+    double LastQueryTimeS = 0.0;
+
+    int32 QueryCount = 0;
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+
+/**
+ * A move command waiting on the server-side queue
+ * Keyed by the (order-independent) set of NPCs it targets; SetKey is only a bucket, SortedSet decides
+ */
+struct FPACS_PendingMoveCommand
+{
+    TArray<TWeakObjectPtr<AActor>> NPCs;
+    FVector TargetLocation = FVector::ZeroVector;
+    uint32 SetKey = 0;
+
+    // NPC pointers sorted by address, compared when keys match so a hash collision never merges two selections
+    TArray<UPTRINT> SortedSet;
+
+    // Number of earlier commands for the same set that this one superseded
+    int32 CoalescedCount = 0;
+};
+
+/**
+ * Per-player server-side move command queue
+ *
+ * - Commands for the same NPC set arriving before the next flush coalesce; the latest target wins
+ * - Flushing is gated by a token bucket (RefillPerSecond tokens/s, up to BurstSize); commands without
+ *   a token stay queued and keep coalescing until a token is available
+ * - Commands for new NPC sets are rejected once MaxPending distinct sets are waiting
+ *
+ * Plain C++ (no UObject) so it can be driven directly by automation tests.
+ */
+class POLAIR_CS_API FPACS_MoveCommandQueue
+{
+public:
+    void Configure(float InRefillPerSecond, int32 InBurstSize, int32 InMaxPending);
+
+    // Queue (or coalesce) a command. Returns false if it was rejected because the queue is full.
+    bool Enqueue(const TArray<AActor*>& NPCs, const FVector& TargetLocation, double Now);
+
+    // Move every command that has a token into OutReady (oldest set first)
+    void Flush(double Now, TArray<FPACS_PendingMoveCommand>& OutReady);
+
+    // Seconds until the next token is available (0 if one is available now)
+    float GetTimeUntilNextToken(double Now) const;
+
+    bool HasPending() const { return Pending.Num() > 0; }
+    int32 GetPendingCount() const { return Pending.Num(); }
+
+    // Counters since the last ConsumeDropStats call
+    void ConsumeDropStats(int32& OutCoalesced, int32& OutRejected);
+
+    void Reset();
+
+    // Order-independent key for an NPC set
+    static uint32 MakeSetKey(const TArray<AActor*>& NPCs);
+    static uint32 MakeSortedSetKey(const TArray<UPTRINT>& SortedSet);
+
+    // Non-null NPC pointers sorted by address, so selection order does not matter
+    static void MakeSortedSet(const TArray<AActor*>& NPCs, TArray<UPTRINT>& OutSortedSet);
+
+private:
+    void Refill(double Now);
+
+    TArray<FPACS_PendingMoveCommand> Pending;
+
+    float RefillPerSecond = 10.0f;
+    int32 BurstSize = 5;
+    int32 MaxPending = 8;
+
+    float Tokens = 5.0f;
+    double LastRefillTime = -1.0;
+
+    int32 CoalescedSinceLastReport = 0;
+    int32 RejectedSinceLastReport = 0;
+};
@@ -5,6 +5,8 @@
 #include "Components/PACS_InputHandlerComponent.h"
 #include "Data/PACS_InputTypes.h"
 #include "Core/PACS_PlayerState.h"
+#include "Core/PACS_MoveCommandQueue.h"
+#include "Core/PACS_MarqueeTracker.h"
 #include "Engine/TimerHandle.h"
 #include "Components/PACS_EdgeScrollComponent.h"
 #include "Components/PACS_HoverProbeComponent.h"
@@ -24,6 +26,7 @@ protected:
     virtual void SetupInputComponent() override;
     virtual void BeginPlay() override;
     virtual void PostInitializeComponents() override;
+    virtual void ReceivedPlayer() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void OnPossess(APawn* InPawn) override;
     virtual void OnUnPossess() override;
@@ -68,9 +71,6 @@ public:
 
 #pragma region Input System
 public:
-    // Timer handle for InputConfig retry binding
-    FTimerHandle InputConfigRetryTimer;
-
     // Debug input context display
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PACS|Debug")
     bool bShowInputContextDebug = false;
@@ -84,12 +84,14 @@ public:
         meta=(DisplayName="Movement Trace Channel"))
     TEnumAsByte<ECollisionChannel> MovementTraceChannel = ECC_Visibility;
 
-    // Called by InputHandler when initialization completes
+    // Runs from SetupInputComponent and again from InputHandler->OnInputReady
     void BindInputActions();
+    void HandleInputReady(UPACS_InputHandlerComponent* Handler);
 
     // IPACS_InputReceiver interface
-    virtual EPACS_InputHandleResult HandleInputAction(FName ActionName, const FInputActionValue& Value) override;
+    virtual EPACS_InputHandleResult HandleInputActionId(uint16 ActionId, FName ActionName, const FInputActionValue& Value) override;
     virtual int32 GetInputPriority() const override { return PACS_InputPriority::Gameplay; }
+    virtual void GetSubscribedActions(TArray<FName>& OutActions) const override;
 
     // Component getters
     UPACS_InputHandlerComponent* GetInputHandler() const { return InputHandler; }
@@ -160,19 +162,42 @@ public:
     // Client notification for selection changes
     UFUNCTION(Client, Reliable)
     void ClientUpdateSelectedNPCs(const TArray<AActor*>& SelectedNPCs);
+
+private:
+    // Server-side move command queue (per-set coalescing + token bucket rate limit)
+    FPACS_MoveCommandQueue MoveCommandQueue;
+    FTimerHandle MoveCommandFlushTimer;
+    bool bMoveCommandFlushScheduled = false;
+
+    // Execute queued commands that have a token, report drops, reschedule if commands remain
+    void FlushMoveCommands();
+
+    // Validate ownership and issue pathing for one move command (server-side)
+    void ExecuteMoveCommand(const TArray<AActor*>& NPCs, const FVector& TargetLocation);
 #pragma endregion
 
 #pragma region Marquee Selection
 public:
     // Marquee state accessors
     UFUNCTION(BlueprintPure, Category = "PACS|Marquee")
-    bool IsMarqueeActive() const { return bIsMarqueeActive; }
+    bool IsMarqueeActive() const { return Marquee.IsDragging(); }
 
     UFUNCTION(BlueprintPure, Category = "PACS|Marquee")
-    FVector2D GetMarqueeStartPos() const { return MarqueeStartPos; }
+    FVector2D GetMarqueeStartPos() const { return Marquee.GetStart(); }
 
     UFUNCTION(BlueprintPure, Category = "PACS|Marquee")
-    FVector2D GetMarqueeCurrentPos() const { return MarqueeCurrentPos; }
+    FVector2D GetMarqueeCurrentPos() const { return Marquee.GetCurrent(); }
+
+    // Mouse moved while the select button is held (from the marquee input processor, Slate screen space)
+    void HandleMarqueeMouseMove(const FVector2D& ScreenSpacePos);
+
+    // Marquee input in viewport pixels (the space of GetMousePosition)
+    void BeginMarqueePress(const FVector2D& ViewportPos);
+    void MoveMarquee(const FVector2D& ViewportPos);
+    void ReleaseMarquee(const FVector2D& ViewportPos);
+
+    // Actor queries run for the marquee rect
+    int32 GetMarqueeQueryCount() const { return Marquee.GetQueryCount(); }
 
     // Marquee configuration
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PACS|Marquee",
@@ -180,22 +205,23 @@ public:
     float MarqueeDragThreshold = 5.0f;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PACS|Marquee",
-        meta = (DisplayName = "Marquee Update Rate (Hz)", ClampMin = "10", ClampMax = "60"))
+        meta = (DisplayName = "Marquee Update Rate (Hz)", ClampMin = "10", ClampMax = "60",
+            ToolTip = "Maximum rate of marquee queries; a query only runs when the rectangle has changed"))
     float MarqueeUpdateRate = 30.0f;
 
 private:
-    // Marquee selection state
-    FVector2D MarqueeStartPos;
-    FVector2D MarqueeCurrentPos;
-    bool bIsMarqueeActive = false;
-    bool bLeftMousePressed = false;
-    bool bIsLeftClickHeld = false;  // Track Enhanced Input click state
+    // Press -> mouse-move -> release state machine; nothing runs between input events
+    FPACS_MarqueeTracker Marquee;
     TArray<TWeakObjectPtr<AActor>> MarqueeHoveredActors;
 
-    // Marquee update timer
+    // Forwards mouse moves to HandleMarqueeMouseMove; registered on press, removed on release
+    TSharedPtr<class IInputProcessor> MarqueeInputProcessor;
+
+    // One-shot for a rect change held back by MarqueeUpdateRate; cleared on release
     FTimerHandle MarqueeUpdateTimer;
 
     // Marquee helper methods
+    void EndMarqueePress();
     void StartMarquee();
     void UpdateMarquee();
     void FinalizeMarquee();
@@ -306,4 +332,4 @@ private:
     UPROPERTY()
     TObjectPtr<UUserWidget> SpawnUIWidget;
 #pragma endregion
-};
\ No newline at end of file
+};
\ No newline at end of file
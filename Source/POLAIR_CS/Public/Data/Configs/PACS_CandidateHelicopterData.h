@@ -1,8 +1,11 @@
 #pragma once
 #include "Engine/DataAsset.h"
 #include "Curves/CurveFloat.h"
+#include "Data/PACS_CurveLUT.h"
 #include "PACS_CandidateHelicopterData.generated.h"
 
+enum class EPACS_OrbitCurve : uint8 { Center, Alt, Radius, Speed };
+
 UCLASS(BlueprintType)
 class POLAIR_CS_API UPACS_CandidateHelicopterData : public UPrimaryDataAsset
 {
@@ -15,6 +18,12 @@ public:
 
     UPROPERTY(EditDefaultsOnly, meta=(ClampMin="0", ClampMax="10")) float MaxBankDeg = 10.f;
 
+    // Bank is only written to the frame when it moved by more than this
+    UPROPERTY(EditDefaultsOnly, Category = "Bank", meta=(ClampMin="0")) float BankApplyThresholdDeg = 0.05f;
+    // Simulated proxies further than this from every local view update bank at the interval below
+    UPROPERTY(EditDefaultsOnly, Category = "Bank", meta=(ClampMin="0")) float DistantBankDistanceCm  = 50000.f;
+    UPROPERTY(EditDefaultsOnly, Category = "Bank", meta=(ClampMin="0")) float DistantBankUpdateIntervalS = 0.25f;
+
     UPROPERTY(EditDefaultsOnly) TObjectPtr<UCurveFloat> CenterInterp = nullptr;
     UPROPERTY(EditDefaultsOnly) TObjectPtr<UCurveFloat> AltInterp    = nullptr;
     UPROPERTY(EditDefaultsOnly) TObjectPtr<UCurveFloat> RadiusInterp = nullptr;
@@ -25,8 +34,18 @@ public:
     UPROPERTY(EditDefaultsOnly) float RadiusDurS = 3.f;
     UPROPERTY(EditDefaultsOnly) float SpeedDurS  = 2.f;
 
+    // Interp curves are baked into fixed-size tables on load/edit; turn off to evaluate the curves exactly.
+    UPROPERTY(EditDefaultsOnly, Category = "Curves") bool bUseCurveLUTs = true;
+    UPROPERTY(EditDefaultsOnly, Category = "Curves", meta=(ClampMin="2", ClampMax="1024", EditCondition="bUseCurveLUTs")) int32 CurveLUTSamples = FPACS_CurveLUT::DefaultSamples;
+
     UPROPERTY(EditDefaultsOnly) float MaxCenterDriftCms = 3000.f; // drift clamp for visuals
 
+    // Simulated proxies place themselves on the closed-form orbit without sweeping,
+    // unless the coarse geometry check finds world-static collision nearby.
+    UPROPERTY(EditDefaultsOnly, Category = "Proxy") bool  bAnalyticProxyMovement      = true;
+    UPROPERTY(EditDefaultsOnly, Category = "Proxy", meta=(ClampMin="0.05")) float ProxyGeometryCheckIntervalS = 0.5f;
+    UPROPERTY(EditDefaultsOnly, Category = "Proxy", meta=(ClampMin="0"))    float ProxyGeometryClearanceCm    = 1000.f;
+
     UPROPERTY(EditDefaultsOnly) FVector SeatLocalClamp = FVector(50,50,50);
 
     UPROPERTY(EditDefaultsOnly) FTransform AssessorFollowView;
@@ -49,4 +68,26 @@ public:
         meta = (DisplayName = "Camera 2 - Ortho Width Levels",
         EditCondition = "bCamera2UseOrtho", EditConditionHides))
     TArray<float> Camera2OrthoWidths = {500.0f, 1000.0f, 2000.0f};
+
+    // Normalised-time (0..1) evaluation of one of the orbit interp curves; linear when the curve is unset.
+    float EvalOrbitCurve01(EPACS_OrbitCurve Which, float T) const;
+
+    // Rebake all four tables from the current curves
+    void BakeCurveLUTs();
+
+    // Bake any stale table now so EvalOrbitCurve01 is read-only afterwards (call on the game thread before parallel evaluation)
+    void PrepareCurveLUTs() const;
+
+    const FPACS_CurveLUT& GetCurveLUT(EPACS_OrbitCurve Which) const { return LUTs[(int32)Which]; }
+
+    virtual void PostLoad() override;
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+    const UCurveFloat* GetOrbitCurve(EPACS_OrbitCurve Which) const;
+
+    // Rebaked lazily if the source curve or (in PrepareCurveLUTs and editor builds) its keys changed since the last bake
+    mutable FPACS_CurveLUT LUTs[4];
 };
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+#include "CoreMinimal.h"
+
+class UCurveFloat;
+
+/**
+ * Fixed-size lookup table baked from a UCurveFloat over the normalised domain [0,1].
+ * Evaluation is a clamp, one multiply and a linear blend between two samples, which is what the
+ * orbit interpolators need every frame instead of a rich-curve key search.
+ */
+struct POLAIR_CS_API FPACS_CurveLUT
+{
+    static constexpr int32 DefaultSamples = 64;
+
+    // Sample Curve at NumSamples evenly spaced points in [0,1]. A null curve leaves the table empty.
+    void Bake(const UCurveFloat* Curve, int32 NumSamples = DefaultSamples);
+    void Reset();
+
+    // Same curve object as the last bake; cheap enough for the per-eval path in cooked builds
+    bool HasSource(const UCurveFloat* Curve) const { return Curve && Source.Get() == Curve && Samples.Num() >= 2; }
+
+    // Same curve object and the same keys as the last bake (editing the asset's keys makes this false)
+    bool IsBakedFrom(const UCurveFloat* Curve) const { return HasSource(Curve) && KeyHash == HashCurve(Curve); }
+
+    // Hash of everything that shapes the curve: keys, tangents, interp modes, extrapolation
+    static uint32 HashCurve(const UCurveFloat* Curve);
+
+    // T is clamped to [0,1]
+    float Eval(float T) const
+    {
+        const float X = FMath::Clamp(T, 0.f, 1.f) * StepScale;
+        const int32 I = FMath::Min(FMath::FloorToInt32(X), Samples.Num() - 2);
+        return FMath::Lerp(Samples[I], Samples[I + 1], X - float(I));
+    }
+
+    int32 Num() const { return Samples.Num(); }
+
+private:
+    TArray<float> Samples;
+    float StepScale = 0.f;
+    TWeakObjectPtr<const UCurveFloat> Source;
+    uint32 KeyHash = 0;
+};
@@ -0,0 +1,15 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "PACS_FormationTypes.generated.h"
+
+/**
+ * Formation layouts used by the group move service when several NPCs share one move command.
+ * Slot 0 is always in the front rank of the formation; later slots fill backwards from there.
+ */
+UENUM(BlueprintType)
+enum class EPACS_FormationType : uint8
+{
+    Grid   = 0,  // Square-ish block centred on the target
+    Wedge  = 1,  // Arrow head pointing along the travel direction
+    Column = 2   // Single file along the travel direction
+};
@@ -1,7 +1,7 @@
 #pragma once
 #include "GameFramework/CharacterMovementComponent.h"
 
-struct FSavedMove_HeliOrbit : public FSavedMove_Character
+struct POLAIR_CS_API FSavedMove_HeliOrbit : public FSavedMove_Character
 {
     float   SavedAngleRad = 0.f;
     FVector SavedCenterCm = FVector::ZeroVector;
@@ -25,19 +25,25 @@ struct FSavedMove_HeliOrbit : public FSavedMove_Character
         const FSavedMove_HeliOrbit* H = static_cast<const FSavedMove_HeliOrbit*>(NewMove.Get());
         if (!H) return false;
         
-        const bool SameVersion = (SavedOrbitVersion == H->SavedOrbitVersion);
-        const bool SameCenter  = SavedCenterCm.Equals(H->SavedCenterCm, 1.f);
-        return SameVersion && SameCenter && FSavedMove_Character::CanCombineWith(NewMove, InCharacter, MaxDelta);
+        // Within one orbit version the centre drift is a function of time alone, so it never blocks combining.
+        if (SavedOrbitVersion != H->SavedOrbitVersion) return false;
+        return FSavedMove_Character::CanCombineWith(NewMove, InCharacter, MaxDelta);
     }
 };
 
-struct FNetworkPredictionData_Client_HeliOrbit : public FNetworkPredictionData_Client_Character
+struct POLAIR_CS_API FNetworkPredictionData_Client_HeliOrbit : public FNetworkPredictionData_Client_Character
 {
-    FNetworkPredictionData_Client_HeliOrbit(const UCharacterMovementComponent& ClientMovement)
-    : FNetworkPredictionData_Client_Character(ClientMovement) {}
+    // Moves allocated up front; acknowledged moves go back to FreeMoves, so steady state never allocates.
+    static constexpr int32 PrewarmMoveCount = 32;
 
+    FNetworkPredictionData_Client_HeliOrbit(const UCharacterMovementComponent& ClientMovement);
+
+    // Single allocation (object + reference controller); only reached when FreeMoves is empty.
     virtual FSavedMovePtr AllocateNewMove() override
     {
-        return MakeShareable(new FSavedMove_HeliOrbit());
+        ++NumAllocatedMoves;
+        return MakeShared<FSavedMove_HeliOrbit>();
     }
+
+    int32 NumAllocatedMoves = 0;
 };
\ No newline at end of file
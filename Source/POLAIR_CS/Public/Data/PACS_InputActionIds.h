@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Compiled input action IDs.
+// Every ActionIdentifier gets a dense uint16 (1..N, 0 = none) the first time it is seen, either from the
+// native list below at static init or from an input config when the handler builds its action map.
+// IDs never change for the lifetime of the process, so receivers can compare integers instead of FNames.
+// Game thread only (static init aside).
+struct POLAIR_CS_API FPACS_InputActionRegistry
+{
+    static constexpr uint16 InvalidId = 0;
+
+    static uint16 FindOrAdd(FName Identifier);
+    static uint16 Find(FName Identifier);
+    static FName GetName(uint16 Id);
+
+    // Highest assigned ID + 1, i.e. the size of a table indexed by ID
+    static int32 GetTableSize();
+};
+
+// An identifier known to code, registered at static init
+struct POLAIR_CS_API FPACS_NativeInputAction
+{
+    explicit FPACS_NativeInputAction(const TCHAR* Identifier)
+        : Name(Identifier)
+        , Id(FPACS_InputActionRegistry::FindOrAdd(Name))
+    {}
+
+    operator uint16() const { return Id; }
+    uint16 GetId() const { return Id; }
+    FName GetName() const { return Name; }
+
+private:
+    FName Name;
+    uint16 Id;
+};
+
+// Native actions used by code receivers. Add an entry here and the ID is registered with the others;
+// the identifier must match the ActionIdentifier in the input config.
+#define PACS_NATIVE_INPUT_ACTIONS(X) \
+    X(VRSeat_Center,        "VRSeat.Center") \
+    X(VRSeat_X,             "VRSeat.X") \
+    X(VRSeat_Y,             "VRSeat.Y") \
+    X(VRSeat_Z,             "VRSeat.Z") \
+    X(Cam_ZoomToggle,       "Cam.ZoomToggle") \
+    X(Cam2_ZoomToggle,      "Cam2.ZoomToggle") \
+    X(Assessor_MoveForward, "Assessor.MoveForward") \
+    X(Assessor_MoveRight,   "Assessor.MoveRight") \
+    X(Assessor_Zoom,        "Assessor.Zoom") \
+    X(Assessor_RotateLeft,  "Assessor.RotateLeft") \
+    X(Assessor_RotateRight, "Assessor.RotateRight") \
+    X(MenuToggle,           "MenuToggle") \
+    X(UI,                   "UI") \
+    X(LeftClick,            "LeftClick") \
+    X(Select,               "Select") \
+    X(RightClick,           "RightClick") \
+    X(Cancel,               "Cancel") \
+    X(Deselect,             "Deselect")
+
+namespace PACS_InputActions
+{
+#define PACS_DECLARE_NATIVE_INPUT_ACTION(Symbol, Identifier) extern POLAIR_CS_API const FPACS_NativeInputAction Symbol;
+    PACS_NATIVE_INPUT_ACTIONS(PACS_DECLARE_NATIVE_INPUT_ACTION)
+#undef PACS_DECLARE_NATIVE_INPUT_ACTION
+}
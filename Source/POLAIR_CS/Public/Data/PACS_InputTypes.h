@@ -5,10 +5,11 @@
 #include "InputAction.h"
 #include "InputMappingContext.h"
 #include "InputActionValue.h"
+#include "Core/PACS_Log.h"
 #include "PACS_InputTypes.generated.h"
 
-// Logging category
-DECLARE_LOG_CATEGORY_EXTERN(LogPACSInput, Log, All);
+// Logging category (see Core/PACS_Log.h for the policy)
+POLAIR_CS_API DECLARE_LOG_CATEGORY_EXTERN(LogPACSInput, Log, PACS_LOG_COMPILE_MAX);
 
 // Production logging macros
 #define PACS_INPUT_ERROR(Format, ...) UE_LOG(LogPACSInput, Error, TEXT(Format), ##__VA_ARGS__)
@@ -16,6 +17,9 @@ DECLARE_LOG_CATEGORY_EXTERN(LogPACSInput, Log, All);
 #define PACS_INPUT_LOG(Format, ...) UE_LOG(LogPACSInput, Log, TEXT(Format), ##__VA_ARGS__)
 #define PACS_INPUT_VERBOSE(Format, ...) UE_LOG(LogPACSInput, VeryVerbose, TEXT(Format), ##__VA_ARGS__)
 
+// Per-action lines, sampled by pacs.Log.Hot
+#define PACS_INPUT_HOT(Format, ...) PACS_LOG_HOT(LogPACSInput, Log, TEXT(Format), ##__VA_ARGS__)
+
 // Safety constants
 namespace PACS_InputLimits
 {
@@ -70,8 +74,19 @@ class IPACS_InputReceiver
 {
     GENERATED_BODY()
 public:
-    virtual EPACS_InputHandleResult HandleInputAction(FName ActionName, const FInputActionValue& Value) = 0;
+    // Called by the router. Native receivers override this and compare ActionId against PACS_InputActions
+    // (Data/PACS_InputActionIds.h); the default forwards to the FName overload.
+    virtual EPACS_InputHandleResult HandleInputActionId(uint16 ActionId, FName ActionName, const FInputActionValue& Value)
+    {
+        return HandleInputAction(ActionName, Value);
+    }
+
+    virtual EPACS_InputHandleResult HandleInputAction(FName ActionName, const FInputActionValue& Value) { return EPACS_InputHandleResult::NotHandled; }
     virtual int32 GetInputPriority() const { return PACS_InputPriority::Gameplay; }
+
+    // Action identifiers this receiver handles; leave empty to be offered every action.
+    // Read once at RegisterReceiver, re-register to change it.
+    virtual void GetSubscribedActions(TArray<FName>& OutActions) const {}
 };
 
 USTRUCT()
@@ -88,6 +103,10 @@ struct FPACS_InputReceiverEntry
     UPROPERTY() 
     uint32 RegistrationOrder = 0;
 
+    // Empty = every action
+    UPROPERTY()
+    TArray<FName> SubscribedActions;
+
     IPACS_InputReceiver* GetInterface() const
     {
         if (UObject* Obj = ReceiverObject.Get())
@@ -122,4 +141,19 @@ struct FPACS_OverlayEntry
     
     UPROPERTY()
     int32 Priority = 0;
+};
+
+/**
+ * Subsystem calls that turn the applied context set into the desired one. A context whose
+ * priority changed is only re-added: AddMappingContext updates the priority in place.
+ */
+struct POLAIR_CS_API FPACS_InputContextDiff
+{
+    TArray<UInputMappingContext*> Removes;
+    TArray<TPair<UInputMappingContext*, int32>> Adds;
+
+    bool IsEmpty() const { return Removes.Num() == 0 && Adds.Num() == 0; }
+
+    static FPACS_InputContextDiff Compute(const TMap<TObjectPtr<UInputMappingContext>, int32>& Applied,
+        const TMap<TObjectPtr<UInputMappingContext>, int32>& Desired);
 };
\ No newline at end of file
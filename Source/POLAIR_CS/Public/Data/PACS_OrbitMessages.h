@@ -23,4 +23,38 @@ struct FPACS_OrbitEdit
 
     UPROPERTY() uint16 TransactionId=0;
     UPROPERTY() EPACS_AnchorPolicy AnchorPolicy = EPACS_AnchorPolicy::PreserveAngleOnce;
+
+    bool HasAnyChange() const { return bHasCenter || bHasAlt || bHasRadius || bHasSpeed; }
+
+    // Serial number order for the wrapping uint16 id: A is newer if it is less than half the range ahead of B
+    static bool IsNewerTransaction(uint16 A, uint16 B) { return int16(uint16(A - B)) > 0; }
+
+    // Fold a later edit into this one: fields it carries (value + duration) and its anchor policy win.
+    POLAIR_CS_API void MergeFrom(const FPACS_OrbitEdit& Later);
+};
+
+/**
+ * Client-side accumulator for orbit edits (e.g. an assessor scrubbing a slider).
+ * Edits fold into one pending edit which is sent under the next TransactionId at most
+ * MaxPerSecond times a second; whatever is pending when the window reopens is sent, so the
+ * final value always goes out.
+ */
+struct POLAIR_CS_API FPACS_OrbitEditAccumulator
+{
+    void Add(const FPACS_OrbitEdit& Edit);
+    bool HasPending() const { return bPending; }
+
+    // Seconds until the next send is allowed (0 = now)
+    double GetSendDelay(double NowS, float MaxPerSecond) const;
+
+    // Take the pending edit, stamped with a fresh TransactionId
+    FPACS_OrbitEdit Consume(double NowS);
+
+    uint16 GetLastTransactionId() const { return LastTransactionId; }
+
+private:
+    FPACS_OrbitEdit Pending;
+    bool   bPending = false;
+    double LastSendS = -UE_BIG_NUMBER;
+    uint16 LastTransactionId = 0;
 };
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+#include "CoreMinimal.h"
+
+struct FPACS_OrbitTargets;
+class UWorld;
+
+/**
+ * Look-ahead limits for helicopter viewpoints, normally read from UPACS_NetPerfSettings
+ */
+struct FPACS_HeliViewParams
+{
+    float LookAheadS = 10.0f;
+    int32 LookAheadSamples = 4;
+    float ArcWeight = 2.0f;
+
+    static FPACS_HeliViewParams FromSettings();
+};
+
+/**
+ * Viewpoints fed to UPACS_CustomSignificanceManager
+ *
+ * A viewpoint's uniform scale carries its weight: distances to it are divided by the weight, so a
+ * weight-2 viewpoint makes an object 4000 cm away score like one 2000 cm from an ordinary (weight 1)
+ * view. Player views keep weight 1. A VR candidate in a helicopter instead contributes its HMD pose,
+ * the ground point the HMD looks at, and samples of the orbit arc the helicopter is about to fly,
+ * weighted from ArcWeight (next sample) down to 1 (end of the look-ahead).
+ */
+struct POLAIR_CS_API FPACS_SignificanceViewpoints
+{
+    static float GetWeight(const FTransform& Viewpoint);
+    static float WeightedDistance(const FVector& Location, const FTransform& Viewpoint);
+
+    // (0, 1]: 1 at the viewpoint, falling off with weighted distance; the PACS distance significance
+    static float DistanceSignificance(const FVector& Location, const FTransform& Viewpoint);
+
+    // Viewpoints for a helicopter on Targets' orbit at AngleRad (orbit ground plane is Targets.CenterCm.Z)
+    static void BuildHeliViewpoints(const FTransform& HMDPose, const FPACS_OrbitTargets& Targets, float AngleRad,
+                                    const FPACS_HeliViewParams& Params, TArray<FTransform>& Out);
+
+    // Every local player's viewpoints: helicopter candidates through BuildHeliViewpoints, others their player view
+    static void GatherLocal(const UWorld* World, TArray<FTransform>& Out);
+};
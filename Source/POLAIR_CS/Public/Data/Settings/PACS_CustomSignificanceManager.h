@@ -4,8 +4,73 @@
 
 #include "CoreMinimal.h"
 #include "SignificanceManager.h"
+#include "UObject/ObjectKey.h"
+#include "Engine/EngineTypes.h"
 #include "PACS_CustomSignificanceManager.generated.h"
 
+class ACharacter;
+
+/**
+ * NPC significance bands; the band is the NPC's significance value, so higher is more significant.
+ * Full is reserved for selected or hovered NPCs.
+ */
+enum class EPACS_NPCSignificanceBand : uint8
+{
+    Distant = 0,
+    Far,
+    Mid,
+    Near,
+    Full
+};
+
+/**
+ * NPC throttling limits, normally read from UPACS_NetPerfSettings
+ */
+struct FPACS_NPCThrottleParams
+{
+    bool bEnabled = true;
+    float NearDistanceCm = 2500.0f;
+    float MidDistanceCm = 6000.0f;
+    float FarDistanceCm = 15000.0f;
+    float MidTickRate = 30.0f;
+    float FarTickRate = 10.0f;
+    float DistantTickRate = 4.0f;
+
+    static FPACS_NPCThrottleParams FromSettings();
+};
+
+/**
+ * What one band means for an NPC (intervals in seconds, 0 = every frame). Also used for the
+ * NPC's own settings captured at registration, which Near and Full restore.
+ */
+struct FPACS_NPCTickSettings
+{
+    float ActorTickInterval = 0.f;
+    float MeshTickInterval = 0.f;
+    float MovementTickInterval = 0.f;
+    float SelectionPlaneInterval = 0.f;
+    EVisibilityBasedAnimTickOption AnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+    bool bUpdateRateOptimizations = false;
+    ENetworkSmoothingMode SmoothingMode = ENetworkSmoothingMode::Exponential;
+
+    // The character's current actor, mesh, movement and selection plane settings
+    static FPACS_NPCTickSettings Capture(const ACharacter* Character);
+};
+
+/**
+ * Budget bookkeeping for one registered object. The registered significance function is
+ * wrapped so that base Update only runs it for objects marked due this frame; every other
+ * object keeps the significance from its last scoring.
+ */
+struct FPACS_SignificanceSlot
+{
+    TObjectKey<UObject> Object;
+    USignificanceManager::FSignificanceFunction Score;
+    float Significance = 0.f;
+    int32 DistanceBucket = INDEX_NONE;
+    bool bDue = true;
+};
+
 /**
  * Custom SignificanceManager for PACS that ensures proper creation on clients
  * This class configures the SignificanceManager to be created on client instances
@@ -13,6 +78,15 @@
  *
  * This is NOT the game logic manager - that's PACS_SignificanceManager.
  * This class only configures the ENGINE's SignificanceManager system.
+ *
+ * Update is budgeted: each slice re-scores the next MaxObjectsToProcessPerFrame objects in
+ * registration order (round robin), at most once per UpdateFrequency seconds. Objects whose
+ * nearest-viewpoint distance bucket changed since their last scoring are re-scored in the same
+ * frame regardless of the budget, as are newly registered objects.
+ *
+ * Register and unregister through this type (see Get): the base RegisterObject/UnregisterObject
+ * are not virtual, so calls through a USignificanceManager pointer skip the budget bookkeeping.
+ * Update drops slots the base no longer manages and ensures both sides track the same objects.
  */
 UCLASS(config=Engine)
 class POLAIR_CS_API UPACS_CustomSignificanceManager : public USignificanceManager
@@ -25,21 +99,100 @@ public:
     // Override to provide custom initialization if needed
     virtual void BeginDestroy() override;
 
-    // Optional: Override to customize update frequency
-    // virtual void Update(const FTransform& ViewTransform) override;
+    // Budgeted: scores a round-robin slice plus bucket changes, then runs the base sort/post pass
+    virtual void Update(TArrayView<const FTransform> Viewpoints) override;
+
+    // Hide the base versions so every registration goes through the budget; not virtual, so
+    // calling them through USignificanceManager* bypasses the slots
+    void RegisterObject(UObject* Object, FName Tag, FSignificanceFunction SignificanceFunction,
+        EPostSignificanceType InPostSignificanceType = EPostSignificanceType::None,
+        FPostSignificanceFunction InPostSignificanceFunction = nullptr);
+    void UnregisterObject(UObject* Object);
+
+    // UPACS_SignificanceUpdateSubsystem calls this every frame; only the first call in a frame
+    // runs Update. Returns true if this call updated.
+    bool UpdateOncePerFrame(TArrayView<const FTransform> Viewpoints);
+
+    // The world's significance manager if it is a PACS one (null on dedicated servers)
+    static UPACS_CustomSignificanceManager* Get(const UWorld* World);
+
+    // Budget overrides (tests, console); <= 0 objects means score everything each slice
+    void SetUpdateBudget(int32 InMaxObjectsToProcessPerFrame, float InUpdateFrequency);
+
+    // Bucket index for a distance: DistanceBucketCm wide, everything past MaximumDistance shares one
+    int32 GetDistanceBucket(float DistanceCm) const;
+
+    // Objects scored by the last Update (slice + bucket changes + new), and the bucket-driven part
+    int32 GetLastScoredCount() const { return LastScoredCount; }
+    int32 GetLastBucketRescoreCount() const { return LastBucketRescoreCount; }
+    int32 GetNumBudgetedObjects() const { return Slots.Num(); }
+
+    // Re-score this object on the next Update regardless of the budget
+    void MarkDirty(UObject* Object);
+
+    // --- NPC throttling ---
+
+    // Significance manager tag for NPC characters
+    static const FName NPCTag;
+
+    // Client-side: the post-significance callback applies the band's tick settings on change.
+    // Registration captures the NPC's own settings; unregistering restores them.
+    void RegisterNPC(ACharacter* Character);
+    void UnregisterNPC(ACharacter* Character);
+
+    // Selection or hover changed: go to full rate now, re-score the distance band next Update
+    void RefreshNPC(ACharacter* Character);
+
+    // Band last applied to an NPC (Near, i.e. unthrottled, if none has been applied)
+    EPACS_NPCSignificanceBand GetNPCBand(const ACharacter* Character) const;
+
+    // Full when selected by anyone or locally hovered, otherwise by (weighted) distance to the view
+    static EPACS_NPCSignificanceBand ComputeNPCBand(const ACharacter* Character, const FTransform& Viewpoint, const FPACS_NPCThrottleParams& Params);
+    static EPACS_NPCSignificanceBand GetBandForDistance(float DistanceCm, const FPACS_NPCThrottleParams& Params);
+    // Near and Full return Original; farther bands throttle it, never making anything more expensive
+    static FPACS_NPCTickSettings GetNPCTickSettings(EPACS_NPCSignificanceBand Band, const FPACS_NPCThrottleParams& Params,
+        const FPACS_NPCTickSettings& Original);
+
+    // Actor tick and movement are only throttled on simulated proxies; mesh and selection plane always
+    static void ApplyNPCTickSettings(ACharacter* Character, const FPACS_NPCTickSettings& Settings);
 
 protected:
-    // Configuration properties that could be exposed if needed:
+    // Maximum number of objects re-scored by one round-robin slice
+    UPROPERTY(Config, EditAnywhere, Category = "Significance", meta = (ClampMin = "0"))
+    int32 MaxObjectsToProcessPerFrame = 100;
+
+    // Seconds between round-robin slices (0 = a slice every Update)
+    UPROPERTY(Config, EditAnywhere, Category = "Significance", meta = (ClampMin = "0.0"))
+    float UpdateFrequency = 0.1f;
+
+    // Width of one viewpoint distance bucket
+    UPROPERTY(Config, EditAnywhere, Category = "Significance", meta = (ClampMin = "1.0"))
+    float DistanceBucketCm = 2500.0f;
+
+    // Distances beyond this all fall in the last bucket
+    UPROPERTY(Config, EditAnywhere, Category = "Significance", meta = (ClampMin = "0.0"))
+    float MaximumDistance = 15000.0f;
+
+private:
+    // Drops stale slots, then marks slots whose bucket changed; returns how many were newly marked
+    int32 MarkBucketChanges(TArrayView<const FTransform> Viewpoints);
+    void RemoveSlotAt(int32 Index);
+    int32 MarkRoundRobinSlice();
+
+    uint64 LastUpdateFrame = MAX_uint64;
+
+    // Registration order; RoundRobinCursor is the next slot a slice scores
+    TArray<TSharedRef<FPACS_SignificanceSlot>> Slots;
+    TMap<TObjectKey<UObject>, int32> SlotIndexByObject;
+    int32 RoundRobinCursor = 0;
+    double LastSliceTime = -1.0;
 
-    // Maximum number of objects to process per frame
-    // UPROPERTY(Config, EditAnywhere, Category = "Significance")
-    // int32 MaxObjectsToProcessPerFrame = 100;
+    int32 LastScoredCount = 0;
+    int32 LastBucketRescoreCount = 0;
 
-    // Update frequency in seconds
-    // UPROPERTY(Config, EditAnywhere, Category = "Significance")
-    // float UpdateFrequency = 0.1f;
+    void ApplyNPCBand(ACharacter* Character, EPACS_NPCSignificanceBand Band);
 
-    // Distance thresholds for quick rejection
-    // UPROPERTY(Config, EditAnywhere, Category = "Significance")
-    // float MaximumDistance = 15000.0f;
+    FPACS_NPCThrottleParams NPCParams;
+    TMap<TObjectKey<ACharacter>, EPACS_NPCSignificanceBand> AppliedNPCBands;
+    TMap<TObjectKey<ACharacter>, FPACS_NPCTickSettings> OriginalNPCSettings;
 };
\ No newline at end of file
@@ -2,8 +2,11 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DeveloperSettings.h"
+#include "Data/PACS_FormationTypes.h"
 #include "PACS_NetPerfSettings.generated.h"
 
+class UMaterialInterface;
+
 /**
  * Developer settings for PACS Network and Performance configuration
  * Accessible via Project Settings -> PACS -> NetPerf
@@ -38,6 +41,16 @@ public:
         ToolTip="If true, selection planes are hidden when NPCs are in Available state"))
     bool bHideSelectionWhenAvailable = true;
 
+    UPROPERTY(config, EditAnywhere, Category="Selection|Visual",
+        meta=(DisplayName="Instanced Selection Planes",
+        ToolTip="If true, selection planes are drawn by one instanced mesh component per mesh instead of one mesh component per NPC. Needs Instanced Selection Plane Material"))
+    bool bUseInstancedSelectionPlanes = false;
+
+    UPROPERTY(config, EditAnywhere, Category="Selection|Visual",
+        meta=(DisplayName="Instanced Selection Plane Material", EditCondition="bUseInstancedSelectionPlanes",
+        ToolTip="Material for instanced selection planes. Must read PerInstanceCustomData 0-2 RGB, 3 Brightness, 4 Alpha, 5 display state instead of CustomPrimitiveData. Planes stay per-NPC while unset"))
+    TSoftObjectPtr<UMaterialInterface> InstancedSelectionPlaneMaterial;
+
     // --- Significance Settings ---
 
     UPROPERTY(config, EditAnywhere, Category="Significance|VR",
@@ -50,6 +63,21 @@ public:
         ToolTip="Maximum LOD level for NPCs in VR"))
     int32 VRMaxLOD = 2;
 
+    UPROPERTY(config, EditAnywhere, Category="Significance|VR",
+        meta=(DisplayName="Heli View Look-Ahead", ClampMin=0.0, ClampMax=60.0,
+        ToolTip="Seconds of upcoming orbit arc a VR candidate's significance views cover"))
+    float HeliViewLookAheadS = 10.0f;
+
+    UPROPERTY(config, EditAnywhere, Category="Significance|VR",
+        meta=(DisplayName="Heli View Look-Ahead Samples", ClampMin=0, ClampMax=16,
+        ToolTip="Viewpoints placed along the upcoming orbit arc (0 = HMD and gaze point only)"))
+    int32 HeliViewLookAheadSamples = 4;
+
+    UPROPERTY(config, EditAnywhere, Category="Significance|VR",
+        meta=(DisplayName="Heli View Arc Weight", ClampMin=1.0, ClampMax=10.0,
+        ToolTip="Distance divisor for the nearest look-ahead sample; later samples fall back to 1"))
+    float HeliViewArcWeight = 2.0f;
+
     UPROPERTY(config, EditAnywhere, Category="Significance|Selection",
         meta=(DisplayName="Max Visible Selection Planes", ClampMin=1, ClampMax=100,
         ToolTip="Maximum number of selection planes visible at once"))
@@ -60,6 +88,41 @@ public:
         ToolTip="Maximum distance at which selection planes are visible (in cm)"))
     float SelectionPlaneMaxDistance = 15000.0f;
 
+    UPROPERTY(config, EditAnywhere, Category="Significance|NPC",
+        meta=(DisplayName="Throttle NPC Ticks",
+        ToolTip="If true, client-side NPC actor, mesh, movement and selection plane updates slow down with distance from the local views"))
+    bool bThrottleNPCTicks = true;
+
+    UPROPERTY(config, EditAnywhere, Category="Significance|NPC",
+        meta=(DisplayName="NPC Near Distance", ClampMin=100.0, ClampMax=50000.0, EditCondition="bThrottleNPCTicks",
+        ToolTip="NPCs closer than this to a local view tick at full rate (in cm)"))
+    float NPCNearDistanceCm = 2500.0f;
+
+    UPROPERTY(config, EditAnywhere, Category="Significance|NPC",
+        meta=(DisplayName="NPC Mid Distance", ClampMin=100.0, ClampMax=50000.0, EditCondition="bThrottleNPCTicks",
+        ToolTip="NPCs between the near and mid distances tick at the mid rate (in cm)"))
+    float NPCMidDistanceCm = 6000.0f;
+
+    UPROPERTY(config, EditAnywhere, Category="Significance|NPC",
+        meta=(DisplayName="NPC Far Distance", ClampMin=100.0, ClampMax=100000.0, EditCondition="bThrottleNPCTicks",
+        ToolTip="NPCs between the mid and far distances tick at the far rate; beyond it at the distant rate (in cm)"))
+    float NPCFarDistanceCm = 15000.0f;
+
+    UPROPERTY(config, EditAnywhere, Category="Significance|NPC",
+        meta=(DisplayName="NPC Mid Tick Rate", ClampMin=1.0, ClampMax=120.0, EditCondition="bThrottleNPCTicks",
+        ToolTip="Tick rate for NPCs in the mid band (per second)"))
+    float NPCMidTickRate = 30.0f;
+
+    UPROPERTY(config, EditAnywhere, Category="Significance|NPC",
+        meta=(DisplayName="NPC Far Tick Rate", ClampMin=1.0, ClampMax=120.0, EditCondition="bThrottleNPCTicks",
+        ToolTip="Tick rate for NPCs in the far band (per second)"))
+    float NPCFarTickRate = 10.0f;
+
+    UPROPERTY(config, EditAnywhere, Category="Significance|NPC",
+        meta=(DisplayName="NPC Distant Tick Rate", ClampMin=0.5, ClampMax=120.0, EditCondition="bThrottleNPCTicks",
+        ToolTip="Tick rate for NPCs beyond the far distance (per second)"))
+    float NPCDistantTickRate = 4.0f;
+
     // --- Network Optimization ---
 
     UPROPERTY(config, EditAnywhere, Category="Network|Replication",
@@ -82,6 +145,71 @@ public:
         ToolTip="Time window for batching selection updates (in seconds)"))
     float SelectionBatchWindowTime = 0.1f;
 
+    UPROPERTY(config, EditAnywhere, Category="Network|MoveCommands",
+        meta=(DisplayName="Rate Limit Move Commands",
+        ToolTip="If true, the server queues, coalesces and rate limits move commands per player"))
+    bool bRateLimitMoveCommands = true;
+
+    UPROPERTY(config, EditAnywhere, Category="Network|MoveCommands",
+        meta=(DisplayName="Move Commands Per Second", ClampMin=0.5, ClampMax=60.0, EditCondition="bRateLimitMoveCommands",
+        ToolTip="Token bucket refill rate for move commands executed per player (per second)"))
+    float MoveCommandTokensPerSecond = 10.0f;
+
+    UPROPERTY(config, EditAnywhere, Category="Network|MoveCommands",
+        meta=(DisplayName="Move Command Burst", ClampMin=1, ClampMax=50, EditCondition="bRateLimitMoveCommands",
+        ToolTip="Token bucket capacity - move commands a player can execute back to back"))
+    int32 MoveCommandBurstSize = 5;
+
+    UPROPERTY(config, EditAnywhere, Category="Network|MoveCommands",
+        meta=(DisplayName="Max Pending Move Commands", ClampMin=1, ClampMax=50, EditCondition="bRateLimitMoveCommands",
+        ToolTip="Distinct NPC sets that may wait in a player's queue; further sets are dropped"))
+    int32 MaxPendingMoveCommands = 8;
+
+    UPROPERTY(config, EditAnywhere, Category="Network|OrbitEdits",
+        meta=(DisplayName="Orbit Edits Per Second", ClampMin=1.0, ClampMax=60.0,
+        ToolTip="Maximum orbit edit RPCs a client sends per helicopter per second; edits in between are merged and the final value is always sent"))
+    float MaxOrbitEditsPerSecond = 10.0f;
+
+    UPROPERTY(config, EditAnywhere, Category="Network|OrbitEdits",
+        meta=(DisplayName="Use Orbit Center Grid",
+        ToolTip="If true, the server validates requested orbit centres against a grid built at map load; only cells near collision run an overlap test"))
+    bool bUseOrbitCenterGrid = true;
+
+    UPROPERTY(config, EditAnywhere, Category="Network|OrbitEdits",
+        meta=(DisplayName="Orbit Center Grid Cell Size", ClampMin=100.0, ClampMax=100000.0, EditCondition="bUseOrbitCenterGrid",
+        ToolTip="Edge length of a grid cell (in cm); grown automatically if the level would need more than Max Cells Per Axis"))
+    float OrbitCenterGridCellCm = 2500.0f;
+
+    UPROPERTY(config, EditAnywhere, Category="Network|OrbitEdits",
+        meta=(DisplayName="Orbit Center Grid Max Cells Per Axis", ClampMin=8, ClampMax=1024, EditCondition="bUseOrbitCenterGrid",
+        ToolTip="Upper bound on grid resolution, which also bounds the map load cost"))
+    int32 OrbitCenterGridMaxCellsPerAxis = 256;
+
+    UPROPERTY(config, EditAnywhere, Category="Network|OrbitEdits",
+        meta=(DisplayName="Orbit Center Grid Min Height", EditCondition="bUseOrbitCenterGrid",
+        ToolTip="Lowest centre height covered by the grid (in cm); centres outside the height band use the overlap test"))
+    float OrbitCenterGridMinZCm = 2000.0f;
+
+    UPROPERTY(config, EditAnywhere, Category="Network|OrbitEdits",
+        meta=(DisplayName="Orbit Center Grid Max Height", EditCondition="bUseOrbitCenterGrid",
+        ToolTip="Highest centre height covered by the grid (in cm)"))
+    float OrbitCenterGridMaxZCm = 150000.0f;
+
+    UPROPERTY(config, EditAnywhere, Category="Network|ServerClock",
+        meta=(DisplayName="Smooth Server Clock",
+        ToolTip="If true, helicopter orbits are evaluated against a per-world server clock that slews towards new server time samples instead of jumping"))
+    bool bSmoothServerClock = true;
+
+    UPROPERTY(config, EditAnywhere, Category="Network|ServerClock",
+        meta=(DisplayName="Server Clock Slew Rate", ClampMin=0.0, ClampMax=0.5, EditCondition="bSmoothServerClock",
+        ToolTip="Seconds of correction applied per second when the smoothed clock drifts from the server time estimate"))
+    float ServerClockSlewRate = 0.05f;
+
+    UPROPERTY(config, EditAnywhere, Category="Network|ServerClock",
+        meta=(DisplayName="Server Clock Snap Threshold", ClampMin=0.05, ClampMax=10.0, EditCondition="bSmoothServerClock",
+        ToolTip="Errors larger than this (in seconds) are applied immediately instead of slewed"))
+    float ServerClockSnapThresholdS = 0.5f;
+
     // --- Performance Monitoring ---
 
     UPROPERTY(config, EditAnywhere, Category="Performance|Monitoring",
@@ -104,6 +232,26 @@ public:
         ToolTip="Memory usage threshold for critical alerts (in MB)"))
     int32 MemoryCriticalThresholdMB = 100;
 
+    UPROPERTY(config, EditAnywhere, Category="Performance|CCTV",
+        meta=(DisplayName="Schedule CCTV Captures",
+        ToolTip="If true, helicopter CCTV cameras stop capturing every frame and are captured round-robin by the CCTV scheduler. Feeds shown in UI only get the displayed rate once the UI calls SetFeedDisplayed"))
+    bool bScheduleCCTVCaptures = false;
+
+    UPROPERTY(config, EditAnywhere, Category="Performance|CCTV",
+        meta=(DisplayName="CCTV Captures Per Frame", ClampMin=1, ClampMax=16, EditCondition="bScheduleCCTVCaptures",
+        ToolTip="Maximum scene captures issued per frame across all CCTV feeds"))
+    int32 CCTVCapturesPerFrame = 2;
+
+    UPROPERTY(config, EditAnywhere, Category="Performance|CCTV",
+        meta=(DisplayName="Displayed Feed Rate", ClampMin=1.0, ClampMax=60.0, EditCondition="bScheduleCCTVCaptures",
+        ToolTip="Target capture rate for feeds shown on a monitor or assessor UI (per second)"))
+    float CCTVDisplayedFeedRate = 30.0f;
+
+    UPROPERTY(config, EditAnywhere, Category="Performance|CCTV",
+        meta=(DisplayName="Minimum Feed Rate", ClampMin=0.1, ClampMax=30.0, EditCondition="bScheduleCCTVCaptures",
+        ToolTip="Every registered feed is captured at least this often, displayed or not (per second)"))
+    float CCTVMinFeedRate = 2.0f;
+
     // --- Optimization Features ---
 
     UPROPERTY(config, EditAnywhere, Category="Optimization|Pooling",
@@ -141,6 +289,43 @@ public:
         ToolTip="Distance threshold for near/far update rates (in cm)"))
     float NearDistanceThreshold = 2000.0f;
 
+    UPROPERTY(config, EditAnywhere, Category="Optimization|Updates",
+        meta=(DisplayName="Parallel Helicopter Orbit Solver",
+        ToolTip="If true, orbit targets, angles and positions of all server and simulated helicopters are evaluated once per frame in a ParallelFor pass and consumed by each movement component"))
+    bool bParallelHeliOrbitSolver = false;
+
+    UPROPERTY(config, EditAnywhere, Category="Optimization|Updates",
+        meta=(DisplayName="Orbit Solver Min Parallel Count", ClampMin=1, ClampMax=4096, EditCondition="bParallelHeliOrbitSolver",
+        ToolTip="Below this many helicopters the solver runs on the game thread only"))
+    int32 HeliOrbitSolverMinParallelCount = 32;
+
+    // --- NPC Group Movement ---
+
+    UPROPERTY(config, EditAnywhere, Category="NPC|GroupMove",
+        meta=(DisplayName="Enable Group Move",
+        ToolTip="If true, multi-NPC move commands share one corridor path and spread into formation slots"))
+    bool bEnableGroupMove = true;
+
+    UPROPERTY(config, EditAnywhere, Category="NPC|GroupMove",
+        meta=(DisplayName="Default Formation", EditCondition="bEnableGroupMove",
+        ToolTip="Formation used when a move command targets more than one NPC"))
+    EPACS_FormationType DefaultFormation = EPACS_FormationType::Grid;
+
+    UPROPERTY(config, EditAnywhere, Category="NPC|GroupMove",
+        meta=(DisplayName="Formation Spacing", ClampMin=50.0, ClampMax=1000.0, EditCondition="bEnableGroupMove",
+        ToolTip="Distance between neighbouring formation slots (in cm)"))
+    float FormationSpacing = 150.0f;
+
+    UPROPERTY(config, EditAnywhere, Category="NPC|GroupMove",
+        meta=(DisplayName="Group Cohesion Radius", ClampMin=100.0, ClampMax=10000.0, EditCondition="bEnableGroupMove",
+        ToolTip="NPCs further than this from the group centroid get their own path instead of the shared corridor (in cm)"))
+    float GroupCohesionRadius = 2000.0f;
+
+    UPROPERTY(config, EditAnywhere, Category="NPC|GroupMove",
+        meta=(DisplayName="Slot Projection Extent", EditCondition="bEnableGroupMove",
+        ToolTip="Query extent used when projecting formation slots onto the navmesh (in cm)"))
+    FVector FormationProjectionExtent = FVector(200.0f, 200.0f, 500.0f);
+
     // --- Debug Settings ---
 
     UPROPERTY(config, EditAnywhere, Category="Debug",
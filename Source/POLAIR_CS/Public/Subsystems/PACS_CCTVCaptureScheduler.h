@@ -0,0 +1,108 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PACS_CCTVCaptureScheduler.generated.h"
+
+class USceneCaptureComponent2D;
+class UPrimitiveComponent;
+
+/**
+ * Issues the actual capture for a scheduled feed. The default implementation calls
+ * CaptureSceneDeferred; tests install a counting implementation so scheduling runs without a GPU.
+ */
+class POLAIR_CS_API IPACS_FeedCapturer
+{
+public:
+	virtual ~IPACS_FeedCapturer() = default;
+	virtual void CaptureFeed(USceneCaptureComponent2D* Capture) = 0;
+};
+
+/**
+ * Capture limits, normally read from UPACS_NetPerfSettings
+ */
+struct FPACS_CCTVScheduleParams
+{
+	int32 CapturesPerFrame = 2;
+	float DisplayedFeedRate = 30.0f;
+	float MinFeedRate = 2.0f;
+
+	static FPACS_CCTVScheduleParams FromSettings();
+};
+
+struct FPACS_CCTVFeedState
+{
+	// Marked displayed by whoever shows it (assessor / monitor UI)
+	bool bDisplayed = false;
+	double LastCaptureTime = -UE_BIG_NUMBER;
+	// Its monitor surface was rendered recently (refreshed every schedule run)
+	bool bMonitorRendered = false;
+
+	bool IsDisplayed() const { return bDisplayed || bMonitorRendered; }
+};
+
+/**
+ * Client-side CCTV capture scheduler
+ *
+ * Registered scene captures have bCaptureEveryFrame turned off and are captured from here,
+ * at most CapturesPerFrame per frame:
+ * - Any feed that has gone longer than 1 / MinFeedRate without a capture comes first (oldest first)
+ * - Then feeds shown on a monitor or assessor UI, at up to DisplayedFeedRate (oldest first).
+ *   A feed is shown when UI marked it with SetFeedDisplayed, or its monitor surface was
+ *   rendered within the last MonitorRenderedToleranceS
+ * - Feeds nobody is looking at only get the minimum rate
+ *
+ * Not created on dedicated servers.
+ */
+UCLASS()
+class POLAIR_CS_API UPACS_CCTVCaptureScheduler : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Take over a capture component (turns off per-frame capture); MonitorSurface is the in-world
+	// primitive showing the feed, if any
+	void RegisterFeed(USceneCaptureComponent2D* Capture, bool bDisplayed = false, UPrimitiveComponent* MonitorSurface = nullptr);
+	void UnregisterFeed(USceneCaptureComponent2D* Capture);
+
+	// Whether a UI (assessor panel, monitor widget) currently shows this feed
+	UFUNCTION(BlueprintCallable, Category = "PACS|CCTV")
+	void SetFeedDisplayed(USceneCaptureComponent2D* Capture, bool bDisplayed);
+
+	// How recently a monitor surface must have been rendered for its feed to count as displayed
+	static constexpr float MonitorRenderedToleranceS = 0.2f;
+
+	// Capture this frame's selection (Tick calls this with the world time)
+	void RunSchedule(double Now);
+
+	// Pure selection: indices into Feeds to capture this frame, in priority order
+	static void SelectCaptures(TArrayView<const FPACS_CCTVFeedState> Feeds, double Now, const FPACS_CCTVScheduleParams& Params, TArray<int32>& OutIndices);
+
+	// Replace the capture backend (nullptr restores the default)
+	void SetCapturer(TSharedPtr<IPACS_FeedCapturer> InCapturer);
+
+	int32 GetFeedCount() const { return Feeds.Num(); }
+	int32 GetLastFrameCaptureCount() const { return LastFrameCaptureCount; }
+
+private:
+	int32 FindFeed(const USceneCaptureComponent2D* Capture) const;
+	// Drops destroyed feeds and updates which monitor surfaces were rendered
+	void RefreshFeeds();
+
+	TArray<TWeakObjectPtr<USceneCaptureComponent2D>> Feeds;
+	TArray<FPACS_CCTVFeedState> FeedStates;
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> MonitorSurfaces;
+
+	TSharedPtr<IPACS_FeedCapturer> Capturer;
+	TArray<int32> ScratchIndices;
+	int32 LastFrameCaptureCount = 0;
+};
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Data/PACS_FormationTypes.h"
+#include "PACS_GroupMoveSubsystem.generated.h"
+
+class AActor;
+class ANavigationData;
+class UNavigationSystemV1;
+
+/**
+ * Navigation query counters for group move commands
+ * Used by perf tests and the stat view to verify that a group command costs 1 path + N projections
+ */
+struct FPACS_GroupMoveStats
+{
+	// Full navmesh path queries (shared corridors + per-NPC fallbacks)
+	int32 PathQueries = 0;
+
+	// ProjectPointToNavigation calls (centroid, target and formation slots)
+	int32 Projections = 0;
+
+	// NPCs that were handed a copy of the shared corridor
+	int32 SharedPathMoves = 0;
+
+	// NPCs that needed their own path query (too far from the group or no AI controller)
+	int32 FallbackMoves = 0;
+
+	// Navmesh raycasts checking each NPC's legs onto and off the shared corridor
+	int32 NavRaycasts = 0;
+
+	// Short local path queries for legs whose straight line left the navmesh
+	int32 LegPathQueries = 0;
+
+	// Group commands processed
+	int32 GroupCommands = 0;
+
+	void Reset() { *this = FPACS_GroupMoveStats(); }
+};
+
+/**
+ * Server-side group move service
+ *
+ * Replaces "every selected NPC runs its own MoveToLocation to the same point" with:
+ * - One corridor path query from the group centroid to the target
+ * - Formation slots (grid, wedge, column) laid out around the target and projected onto the navmesh
+ * - Each NPC follows a copy of the shared corridor, re-anchored at its own location and ending at its slot.
+ *   The legs onto and off the corridor are navmesh-raycast and replaced by a short local path if blocked
+ *
+ * NPCs that are far from the group centroid, or that are not AI-controlled characters, fall back
+ * to an individual move to their slot. Non-character selectables (vehicles) are always moved
+ * through IPACS_SelectableCharacterInterface so they keep their own movement logic.
+ */
+UCLASS()
+class POLAIR_CS_API UPACS_GroupMoveSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	// Issue one move command for a group of NPCs. Returns the number of NPCs that received a move.
+	int32 IssueGroupMove(const TArray<AActor*>& NPCs, const FVector& TargetLocation, EPACS_FormationType Formation);
+
+	// Build local-space slot offsets (X forward, Y right) for Count members. Slot 0 is in the front rank.
+	static void BuildFormationOffsets(EPACS_FormationType Formation, int32 Count, float Spacing, TArray<FVector2D>& OutOffsets);
+
+	// Query counters
+	const FPACS_GroupMoveStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats.Reset(); }
+
+protected:
+	// Move a single actor to a location via its own path query
+	bool MoveIndividually(AActor* NPC, const FVector& Destination);
+
+	// Shared corridor re-anchored from Start to Slot. Returns false if either end leg cannot be made navigable.
+	bool BuildCorridorCopy(UNavigationSystemV1* NavSys, const ANavigationData* NavData, const TArray<FVector>& Corridor,
+		const FVector& Start, const FVector& Slot, TArray<FVector>& OutPoints);
+
+	// Append a navigable leg from From (already the last point in OutPoints) to To
+	bool AppendNavLeg(UNavigationSystemV1* NavSys, const ANavigationData* NavData, const FVector& From, const FVector& To, TArray<FVector>& OutPoints);
+
+	// Project a point onto the navmesh, returning false if no navmesh is within the extent
+	bool ProjectToNav(UNavigationSystemV1* NavSys, const ANavigationData* NavData, const FVector& Point, FVector& OutProjected);
+
+private:
+	FPACS_GroupMoveStats Stats;
+};
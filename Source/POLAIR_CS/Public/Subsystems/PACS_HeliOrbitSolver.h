@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Actors/Pawn/PACS_CandidateHelicopterCharacter.h"
+#include "PACS_HeliOrbitSolver.generated.h"
+
+class UPACS_HeliMovementComponent;
+class UPACS_CandidateHelicopterData;
+
+/**
+ * One helicopter's orbit inputs and state, gathered contiguously for the solver
+ */
+struct POLAIR_CS_API FPACS_HeliOrbitState
+{
+	// Inputs
+	const UPACS_CandidateHelicopterData* Data = nullptr;
+	FPACS_OrbitTargets Targets;
+	FPACS_OrbitAnchors Anchors;
+	float NowS = 0.f;
+
+	// State (in: last frame, out: this frame)
+	FVector CenterCm = FVector::ZeroVector;
+	float AltitudeCm = 0.f;
+	float RadiusCm = 1.f;
+	float SpeedCms = 0.f;
+	float AngleRad = 0.f;
+
+	// Output
+	FVector PositionCm = FVector::ZeroVector;
+
+	// Same math, in the same order, as the per-component Eval/UpdateAngle path
+	void Solve(float InNowS, float FrameDt);
+};
+
+/**
+ * Optional world-level orbit solver
+ *
+ * Helicopter movement components register on OnRegister. When enabled (bParallelHeliOrbitSolver),
+ * the first movement component to run PhysCustom in a frame triggers SolveFrame: every eligible
+ * component (authority and simulated proxies in CMOVE_HeliOrbit) is gathered into one array,
+ * targets, angles and positions are evaluated with ParallelFor, and the results are written back.
+ * Components then only apply the altitude plane and move. Autonomous proxies keep the
+ * per-component path because client prediction replays saved moves through PhysCustom with
+ * each move's own dt, which a single batched step per frame cannot reproduce.
+ */
+UCLASS()
+class POLAIR_CS_API UPACS_HeliOrbitSolver : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	void RegisterComponent(UPACS_HeliMovementComponent* Component);
+	void UnregisterComponent(UPACS_HeliMovementComponent* Component);
+
+	bool IsEnabled() const { return bEnabled; }
+	void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; LastSolveTime = -1.0; }
+
+	// Gather, solve and scatter once per world time step; later calls in the same step are no-ops
+	void SolveFrame();
+
+	// Evaluate States in place (parallel when there are at least MinParallelCount entries)
+	static void SolveStates(TArrayView<FPACS_HeliOrbitState> States, float NowS, float FrameDt, int32 MinParallelCount);
+
+	double GetLastSolveTime() const { return LastSolveTime; }
+	int32 GetLastSolveCount() const { return LastSolveCount; }
+	int32 GetRegisteredCount() const { return Components.Num(); }
+
+private:
+	TArray<TWeakObjectPtr<UPACS_HeliMovementComponent>> Components;
+
+	// Reused each frame; States[i] belongs to Gathered[i]
+	TArray<FPACS_HeliOrbitState> States;
+	TArray<UPACS_HeliMovementComponent*> Gathered;
+
+	bool bEnabled = false;
+	int32 MinParallelCount = 32;
+	double LastSolveTime = -1.0;
+	int32 LastSolveCount = 0;
+};
@@ -94,6 +94,11 @@ public:
 	void RecordSpawnMessage(const FGameplayTag& SpawnTag, int32 MessageSizeBytes);
 	void RecordActorReplication(AActor* Actor, int32 BytesReplicated);
 
+	// Move command queue reporting (superseded by a newer target / rejected by a full queue)
+	void RecordDroppedMoveCommands(int32 CoalescedCount, int32 RejectedCount);
+	int32 GetCoalescedMoveCommandCount() const { return CoalescedMoveCommands; }
+	int32 GetRejectedMoveCommandCount() const { return RejectedMoveCommands; }
+
 	// Bandwidth queries - C++ API only
 	float GetCurrentBandwidthKBps() const { return CurrentBandwidthKBps; }
 	float GetPeakBandwidthKBps() const { return PeakBandwidthKBps; }
@@ -155,6 +160,10 @@ private:
 	float BytesSentThisSecond = 0.0f;
 	float TimeSinceLastMeasure = 0.0f;
 
+	// Move command drop counters (lifetime of the world)
+	int32 CoalescedMoveCommands = 0;
+	int32 RejectedMoveCommands = 0;
+
 	// Batch timing
 	float TimeSinceLastBatch = 0.0f;
 	float LastSpawnTime = 0.0f;
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "CollisionQueryParams.h"
+#include "PACS_OrbitCenterGrid.generated.h"
+
+class ULevel;
+
+/**
+ * Grid limits, normally read from UPACS_NetPerfSettings
+ */
+struct FPACS_OrbitCenterGridParams
+{
+	bool bEnabled = true;
+	float CellCm = 2500.0f;
+	int32 MaxCellsPerAxis = 256;
+	float MinZCm = 2000.0f;
+	float MaxZCm = 150000.0f;
+
+	static FPACS_OrbitCenterGridParams FromSettings();
+};
+
+enum class EPACS_OrbitCenterCell : uint8
+{
+	// No static WorldStatic collision in the cell's column at build time: only movable collision is checked
+	Allowed,
+	// Collision somewhere in the column: run the exact overlap
+	Boundary
+};
+
+/**
+ * Server-side orbit centre validation
+ *
+ * At map load the level's XY bounds are split into cells; each cell's column over the
+ * [MinZCm, MaxZCm] height band (grown by the probe radius) is overlap-tested once. A proposed
+ * centre in an Allowed cell skips the static scene and only overlaps movable collision (pawns,
+ * blockers spawned since); Boundary cells, centres outside the grid and centres outside the
+ * height band fall back to the full OverlapCenter, so results match the plain overlap test.
+ * Actors spawned with Static or Stationary collision turn the cells they cover into Boundary cells, and the
+ * grid is rebuilt next tick when a streamed level is added or removed.
+ */
+UCLASS()
+class POLAIR_CS_API UPACS_OrbitCenterGrid : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr float ProbeRadiusCm = 50.0f;
+
+	// UWorldSubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	// Whether a centre is free of WorldStatic collision (IgnoreActor is excluded from the overlap)
+	bool IsCenterValid(const FVector& Proposed, const AActor* IgnoreActor = nullptr);
+
+	// The exact test the grid stands in for; Allowed cells restrict it to movable collision
+	static bool OverlapCenter(const UWorld* World, const FVector& Proposed, const AActor* IgnoreActor = nullptr,
+		EQueryMobilityType Mobility = EQueryMobilityType::Any);
+
+	// Build over explicit XY bounds (map load uses the persistent level's bounds)
+	void Build(const FBox& Area, const FPACS_OrbitCenterGridParams& InParams);
+	void BuildFromLevel();
+
+	bool IsBuilt() const { return Cells.Num() > 0; }
+	EPACS_OrbitCenterCell GetCell(const FVector& Location, bool& bOutInGrid) const;
+
+	// Send every cell the box (grown by the probe radius) touches back to the full overlap
+	void MarkBoundary(const FBox& Bounds);
+
+	float GetCellSize() const { return CellCm; }
+	int32 GetNumCellsX() const { return NumX; }
+	int32 GetNumCellsY() const { return NumY; }
+	int32 GetAllowedCellCount() const { return AllowedCells; }
+
+	// Query counters; GridAccepts are Allowed-cell queries, answered by a movable-only overlap
+	int32 GridAccepts = 0;
+	int32 BoundaryOverlaps = 0;
+	int32 FallbackOverlaps = 0;
+	void ResetCounters() { GridAccepts = BoundaryOverlaps = FallbackOverlaps = 0; }
+
+private:
+	void OnLevelsChanged(ULevel* Level, UWorld* InWorld);
+	void OnActorSpawned(AActor* Actor);
+
+	FPACS_OrbitCenterGridParams Params;
+
+	TArray<EPACS_OrbitCenterCell> Cells;
+	FVector2D Origin = FVector2D::ZeroVector;
+	float CellCm = 0.0f;
+	int32 NumX = 0;
+	int32 NumY = 0;
+	int32 AllowedCells = 0;
+
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+	FDelegateHandle ActorSpawnedHandle;
+	FTimerHandle RebuildTimer;
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PACS_SelectableRegistrySubsystem.generated.h"
+
+class UPACS_SelectionPlaneComponent;
+
+/**
+ * Client-side registry of selectable NPCs
+ *
+ * Selection plane components register on BeginPlay and unregister on EndPlay, so systems that
+ * need "every selectable on screen" (hover bucket, marquee, plane budgeting) can iterate a flat
+ * array instead of GetAllActorsWithInterface / FindComponentByClass.
+ *
+ * Not created on dedicated servers - there is nothing to hover or draw there.
+ */
+UCLASS()
+class POLAIR_CS_API UPACS_SelectableRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	void Register(UPACS_SelectionPlaneComponent* Component);
+	void Unregister(UPACS_SelectionPlaneComponent* Component);
+
+	// Registered components; entries can be stale if an owner was destroyed without EndPlay
+	const TArray<TWeakObjectPtr<UPACS_SelectionPlaneComponent>>& GetSelectables() const { return Selectables; }
+	int32 Num() const { return Selectables.Num(); }
+
+	// Bumped on every register/unregister so consumers can cheaply detect membership changes
+	uint32 GetGeneration() const { return Generation; }
+
+private:
+	TArray<TWeakObjectPtr<UPACS_SelectionPlaneComponent>> Selectables;
+	uint32 Generation = 0;
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PACS_SelectionPlaneBudgeter.generated.h"
+
+class UPACS_SelectionPlaneComponent;
+
+/**
+ * Budget limits, normally read from UPACS_NetPerfSettings
+ */
+struct FPACS_PlaneBudgetParams
+{
+	int32 MaxVisible = 32;
+	float MaxDistance = 15000.0f;
+	float NearDistance = 2000.0f;
+	float NearUpdateRate = 60.0f;
+	float FarUpdateRate = 10.0f;
+	bool bThrottleUpdates = true;
+
+	static FPACS_PlaneBudgetParams FromSettings();
+};
+
+struct FPACS_PlaneBudgetInput
+{
+	float Significance = 0.0f;
+	float Distance = 0.0f;
+	bool bSelected = false;
+};
+
+struct FPACS_PlaneBudgetResult
+{
+	bool bVisible = false;
+
+	// Seconds between transform/custom data updates (0 = every frame)
+	float UpdateInterval = 0.0f;
+};
+
+/**
+ * Client-side selection plane budgeter
+ *
+ * Registers every selectable from the registry with UPACS_CustomSignificanceManager and, at the
+ * far update rate, ranks planes by the significance UPACS_SignificanceUpdateSubsystem keeps current:
+ * - Only the top MaxVisibleSelectionPlanes within SelectionPlaneMaxDistance stay visible
+ * - Selected planes are always visible
+ * - Visible planes within NearDistanceThreshold update at NearSelectionUpdateRate, the rest at
+ *   FarSelectionUpdateRate (when bThrottleSelectionUpdates is set)
+ *
+ * Falls back to local distance ranking if the world has no PACS significance manager.
+ * Not created on dedicated servers.
+ */
+UCLASS()
+class POLAIR_CS_API UPACS_SelectionPlaneBudgeter : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Significance manager tag for selection planes
+	static const FName SignificanceTag;
+
+	// UWorldSubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Rank and apply the budget for the given viewpoints (Tick feeds FPACS_SignificanceViewpoints::GatherLocal)
+	void RunBudget(TArrayView<const FTransform> Viewpoints);
+
+	// Pure budget decision: OutResults[i] corresponds to Inputs[i]
+	static void ComputeBudget(const TArray<FPACS_PlaneBudgetInput>& Inputs, const FPACS_PlaneBudgetParams& Params, TArray<FPACS_PlaneBudgetResult>& OutResults);
+
+	// Significance used for ranking: selected planes above everything, then nearer (weighted) is higher
+	static float ComputePlaneSignificance(const UPACS_SelectionPlaneComponent* Plane, const FTransform& Viewpoint);
+
+	int32 GetVisibleCount() const { return LastVisibleCount; }
+
+private:
+	// Keep significance manager registrations in step with the selectable registry
+	void SyncSignificanceRegistrations(class UPACS_CustomSignificanceManager* SignificanceManager, class UPACS_SelectableRegistrySubsystem* Registry);
+
+	TSet<TWeakObjectPtr<UPACS_SelectionPlaneComponent>> RegisteredPlanes;
+	uint32 LastRegistryGeneration = MAX_uint32;
+
+	float TimeSinceBudget = 0.0f;
+	int32 LastVisibleCount = 0;
+
+	// Scratch buffers reused between passes
+	TArray<FTransform> ScratchViewpoints;
+	TArray<UPACS_SelectionPlaneComponent*> ScratchPlanes;
+	TArray<FPACS_PlaneBudgetInput> ScratchInputs;
+	TArray<FPACS_PlaneBudgetResult> ScratchResults;
+};
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PACS_SelectionPlaneManager.generated.h"
+
+class AActor;
+class UInstancedStaticMeshComponent;
+class UMaterialInterface;
+class UStaticMesh;
+class UPACS_SelectionPlaneComponent;
+struct FHitResult;
+
+/**
+ * One instanced mesh component per (plane mesh, selection material) pair
+ * InstanceOwners[i] is the selection plane component drawn by instance i
+ */
+USTRUCT()
+struct FPACS_SelectionPlaneBatch
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UInstancedStaticMeshComponent> ISM;
+
+	UPROPERTY()
+	TObjectPtr<UStaticMesh> Mesh;
+
+	UPROPERTY()
+	TObjectPtr<UMaterialInterface> Material;
+
+	TArray<TWeakObjectPtr<UPACS_SelectionPlaneComponent>> InstanceOwners;
+};
+
+/**
+ * Client-side instanced renderer for NPC selection planes
+ *
+ * Replaces one UStaticMeshComponent (scene proxy + draw call) per NPC with one
+ * UInstancedStaticMeshComponent per selection material. Per-instance custom data uses the same
+ * slots as the per-NPC CustomPrimitiveData:
+ *   [0-2] = RGB, [3] = Brightness, [4] = Alpha, [5] = display state (0=Hovered .. 3=Available)
+ * The profile selection materials read CustomPrimitiveData, so instanced planes draw with
+ * InstancedSelectionPlaneMaterial (NetPerf settings), which must read PerInstanceCustomData.
+ *
+ * Instances are swap-removed so indices stay dense; each tick only NPCs whose root moved get an
+ * instance transform update. Writes mark the ISM render state dirty, which the engine flushes
+ * once per frame.
+ *
+ * UPACS_SelectionPlaneBudgeter can hide planes (zero-scale instance) and give each plane an update
+ * interval; budgeted planes only refresh their transform and custom data when their slot comes up.
+ *
+ * Not created on dedicated servers.
+ */
+UCLASS()
+class POLAIR_CS_API UPACS_SelectionPlaneManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 NumCustomDataFloats = 6;
+
+	// UWorldSubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Add a plane, or move it to the batch for a new mesh/material. Returns false if it could not be added.
+	bool AddOrUpdatePlane(UPACS_SelectionPlaneComponent* Plane, UStaticMesh* Mesh, UMaterialInterface* Material, const FTransform& RelativeTransform);
+
+	// Remove a plane's instance (pool return, EndPlay)
+	void RemovePlane(UPACS_SelectionPlaneComponent* Plane);
+
+	bool HasPlane(const UPACS_SelectionPlaneComponent* Plane) const;
+
+	// PerInstanceCustomData material from NetPerf settings, loaded on first use (null if unset)
+	UMaterialInterface* GetInstancedMaterial();
+
+	// Write the plane's visual state into its instance custom data (deferred to the next update slot when budgeted)
+	void SetPlaneCustomData(UPACS_SelectionPlaneComponent* Plane, const FLinearColor& Color, float Brightness, uint8 DisplayState);
+
+	// Budget controls: hidden planes keep their instance at zero scale; interval 0 = update every tick
+	void SetPlaneVisible(UPACS_SelectionPlaneComponent* Plane, bool bVisible);
+	void SetPlaneUpdateInterval(UPACS_SelectionPlaneComponent* Plane, float Interval);
+	bool IsPlaneVisible(const UPACS_SelectionPlaneComponent* Plane) const;
+
+	// Service planes whose update slot is due at Now: flush pending custom data and update the
+	// transform if the owner moved. Returns the number of instance transforms updated.
+	int32 UpdateMovedInstances(double Now = 0.0);
+
+	// Number of update slots a plane has been serviced in (debug / tests)
+	int32 GetPlaneUpdateCount(const UPACS_SelectionPlaneComponent* Plane) const;
+
+	// Map a hit on a batch ISM back to the selection plane (or NPC) that owns the instance
+	UPACS_SelectionPlaneComponent* ResolveHitPlane(const FHitResult& HitResult) const;
+	AActor* ResolveHitActor(const FHitResult& HitResult) const;
+
+	// Bookkeeping
+	int32 GetComponentCount() const { return Batches.Num(); }
+	int32 GetInstanceCount() const { return Entries.Num(); }
+	int32 GetBatchInstanceCount(int32 BatchIndex) const;
+	int32 FindBatchIndex(const UStaticMesh* Mesh, const UMaterialInterface* Material) const;
+	UPACS_SelectionPlaneComponent* GetInstanceOwner(int32 BatchIndex, int32 InstanceIndex) const;
+	int32 GetInstanceIndex(const UPACS_SelectionPlaneComponent* Plane) const;
+	UInstancedStaticMeshComponent* GetBatchComponent(int32 BatchIndex) const;
+
+private:
+	struct FPlaneEntry
+	{
+		int32 BatchIndex = INDEX_NONE;
+		int32 InstanceIndex = INDEX_NONE;
+		FTransform RelativeTransform;
+		FTransform LastAnchorTransform;
+
+		// Budget state
+		bool bVisible = true;
+		float UpdateInterval = 0.0f;
+		double NextUpdateTime = 0.0;
+		int32 UpdateCount = 0;
+
+		// Custom data waiting for the next update slot
+		float PendingCustomData[NumCustomDataFloats] = {};
+		bool bCustomDataPending = false;
+	};
+
+	void FlushPendingCustomData(FPlaneEntry& Entry);
+
+	int32 FindOrCreateBatch(UStaticMesh* Mesh, UMaterialInterface* Material);
+	AActor* GetOrCreateHostActor();
+	FTransform ComputeWorldTransform(const UPACS_SelectionPlaneComponent* Plane, const FPlaneEntry& Entry, FTransform& OutAnchorTransform) const;
+
+	UPROPERTY(Transient)
+	TArray<FPACS_SelectionPlaneBatch> Batches;
+
+	UPROPERTY(Transient)
+	TObjectPtr<AActor> HostActor;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UMaterialInterface> InstancedMaterial;
+
+	TMap<TWeakObjectPtr<UPACS_SelectionPlaneComponent>, FPlaneEntry> Entries;
+};
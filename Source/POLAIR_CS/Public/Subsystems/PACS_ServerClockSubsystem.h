@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PACS_ServerClockSubsystem.generated.h"
+
+/**
+ * Smoothing limits, normally read from UPACS_NetPerfSettings
+ */
+struct FPACS_ServerClockParams
+{
+	bool bSmooth = true;
+	// Seconds of correction applied per second of local time
+	float SlewRate = 0.05f;
+	// Errors larger than this are taken immediately instead of slewed
+	float SnapThresholdS = 0.5f;
+
+	static FPACS_ServerClockParams FromSettings();
+};
+
+/**
+ * Server time estimate that advances with local world time and slews towards new samples.
+ *
+ * GameState's GetServerWorldTimeSeconds jumps on clients whenever a new server time sample
+ * replicates. Here the estimate keeps advancing at the local rate and the error to the raw
+ * value is corrected by at most SlewRate * DeltaTime per update, so with SlewRate < 1 the
+ * result is strictly increasing while local time is.
+ */
+struct POLAIR_CS_API FPACS_SmoothedServerClock
+{
+	double Update(double RawServerS, double LocalS, const FPACS_ServerClockParams& Params);
+	void Reset() { bInitialized = false; }
+
+	double GetSmoothedS() const { return SmoothedS; }
+	// Raw minus smoothed after the last update
+	double GetErrorS() const { return ErrorS; }
+	int32 GetSnapCount() const { return SnapCount; }
+
+private:
+	double SmoothedS = 0.0;
+	double LastLocalS = 0.0;
+	double ErrorS = 0.0;
+	int32 SnapCount = 0;
+	bool bInitialized = false;
+};
+
+/**
+ * Per-world smoothed server clock
+ *
+ * Updated at most once per world time step, on first read, so every helicopter movement
+ * component (and anything else evaluating replicated orbit anchors) sees the same value.
+ * On the server the raw clock is the world time and the smoothing has nothing to correct.
+ */
+UCLASS()
+class POLAIR_CS_API UPACS_ServerClockSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	// Smoothed server time for this world step
+	double GetServerNowS();
+
+	// Convenience: smoothed clock for World, raw GameState time if the subsystem is missing
+	static double GetServerNowS(const UWorld* World);
+
+	// Drop the estimate; the next read starts from the raw value
+	void ResetClock() { Clock.Reset(); bHasCachedValue = false; }
+
+	const FPACS_SmoothedServerClock& GetClock() const { return Clock; }
+
+private:
+	double ReadRawServerS() const;
+
+	FPACS_ServerClockParams Params;
+	FPACS_SmoothedServerClock Clock;
+
+	double CachedLocalS = 0.0;
+	double CachedServerS = 0.0;
+	bool bHasCachedValue = false;
+};
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PACS_SignificanceUpdateSubsystem.generated.h"
+
+/**
+ * Client-side driver for UPACS_CustomSignificanceManager
+ *
+ * Runs the significance update every frame from the local viewpoints
+ * (FPACS_SignificanceViewpoints::GatherLocal). NPC tick throttling, helicopter visuals and the
+ * selection plane budgeter only read the result, so none of them depends on another system
+ * being present or on its update rate.
+ *
+ * Not created on dedicated servers.
+ */
+UCLASS()
+class POLAIR_CS_API UPACS_SignificanceUpdateSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	// Scratch buffer reused between frames
+	TArray<FTransform> ScratchViewpoints;
+};
@@ -30,7 +30,10 @@ public class POLAIR_CSEditor : ModuleRules
 			"Slate", 
 			"SlateCore",
 			"AutomationTest",
-			"Projects"
+			"Projects",
+			"AIModule",
+			"NavigationSystem",
+			"SignificanceManager"
 		});
 
 		if (Target.Configuration != UnrealTargetConfiguration.Shipping)
@@ -0,0 +1,118 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Subsystems/PACS_CCTVCaptureScheduler.h"
+#include "Settings/PACS_NetPerfSettings.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+namespace
+{
+    class FCountingCapturer final : public IPACS_FeedCapturer
+    {
+    public:
+        virtual void CaptureFeed(USceneCaptureComponent2D* Capture) override
+        {
+            ++Counts.FindOrAdd(Capture);
+            ++Total;
+        }
+
+        TMap<USceneCaptureComponent2D*, int32> Counts;
+        int32 Total = 0;
+    };
+}
+
+// ------- Spec: captures per frame, displayed priority and minimum feed rate (runs under -NullRHI) -------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_CCTVSchedulerSpec,
+    "PACS.CCTV.Scheduler.Budget",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPACS_CCTVSchedulerSpec::RunTest(const FString& Parameters)
+{
+    const FPACS_CCTVScheduleParams Params = FPACS_CCTVScheduleParams::FromSettings();
+
+    // Pure selection: starved feeds beat displayed ones, budget caps the frame
+    {
+        TArray<FPACS_CCTVFeedState> States;
+        States.Add({ true, 0.0 });    // displayed, due
+        States.Add({ false, -10.0 }); // hidden, starved
+        States.Add({ false, 0.99 });  // hidden, fresh
+        TArray<int32> Picked;
+        FPACS_CCTVScheduleParams One = Params;
+        One.CapturesPerFrame = 1;
+        UPACS_CCTVCaptureScheduler::SelectCaptures(States, 1.0, One, Picked);
+        TestEqual(TEXT("One capture per frame"), Picked.Num(), 1);
+        TestTrue(TEXT("Starved feed first"), Picked.Num() == 1 && Picked[0] == 1);
+
+        // A feed whose monitor was rendered is displayed without anyone marking it
+        TArray<FPACS_CCTVFeedState> Monitored;
+        Monitored.Add({ false, 0.9, false }); // hidden, fresh
+        Monitored.Add({ false, 0.9, true });  // monitor on screen, due at the displayed rate
+        UPACS_CCTVCaptureScheduler::SelectCaptures(Monitored, 1.0, Params, Picked);
+        TestTrue(TEXT("Rendered monitor counts as displayed"), Picked.Num() == 1 && Picked[0] == 1);
+    }
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("PACS_CCTVSchedulerTest"));
+    FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+    WorldContext.SetCurrentWorld(World);
+
+    UPACS_CCTVCaptureScheduler* Scheduler = World->GetSubsystem<UPACS_CCTVCaptureScheduler>();
+    TestNotNull(TEXT("Scheduler subsystem"), Scheduler);
+
+    if (Scheduler)
+    {
+        TSharedPtr<FCountingCapturer> Capturer = MakeShared<FCountingCapturer>();
+        Scheduler->SetCapturer(Capturer);
+
+        // Eight helicopters' worth of feeds; two are on an assessor panel
+        const int32 NumFeeds = 16;
+        AActor* Host = World->SpawnActor<AActor>();
+        TArray<USceneCaptureComponent2D*> Captures;
+        for (int32 i = 0; i < NumFeeds; ++i)
+        {
+            USceneCaptureComponent2D* Capture = NewObject<USceneCaptureComponent2D>(Host);
+            Capture->bCaptureEveryFrame = true;
+            Capture->RegisterComponent();
+            Scheduler->RegisterFeed(Capture, i < 2);
+            Captures.Add(Capture);
+        }
+        TestEqual(TEXT("Feeds registered"), Scheduler->GetFeedCount(), NumFeeds);
+        TestFalse(TEXT("Per-frame capture turned off"), Captures[0]->bCaptureEveryFrame);
+
+        // Five seconds at 60 fps
+        const int32 Frames = 300;
+        const double Dt = 1.0 / 60.0;
+        int32 MaxPerFrame = 0;
+        for (int32 Frame = 0; Frame < Frames; ++Frame)
+        {
+            Scheduler->RunSchedule(Frame * Dt);
+            MaxPerFrame = FMath::Max(MaxPerFrame, Scheduler->GetLastFrameCaptureCount());
+        }
+
+        const double Seconds = Frames * Dt;
+        TestTrue(TEXT("Never over the per-frame budget"), MaxPerFrame <= Params.CapturesPerFrame);
+
+        const int32 DisplayedCaptures = Capturer->Counts.FindRef(Captures[0]);
+        const int32 HiddenCaptures = Capturer->Counts.FindRef(Captures[NumFeeds - 1]);
+        AddInfo(FString::Printf(TEXT("%d captures over %.1fs: displayed feed %d, hidden feed %d"), Capturer->Total, Seconds, DisplayedCaptures, HiddenCaptures));
+
+        TestTrue(TEXT("Displayed feeds captured more often"), DisplayedCaptures > HiddenCaptures);
+        TestTrue(TEXT("Displayed feed within its target rate"), DisplayedCaptures <= FMath::CeilToInt(Seconds * Params.DisplayedFeedRate) + 1);
+        for (int32 i = 0; i < NumFeeds; ++i)
+        {
+            const int32 Count = Capturer->Counts.FindRef(Captures[i]);
+            TestTrue(FString::Printf(TEXT("Feed %d meets minimum rate"), i), Count >= FMath::FloorToInt(Seconds * Params.MinFeedRate) - 1);
+        }
+
+        Scheduler->UnregisterFeed(Captures[0]);
+        TestEqual(TEXT("Unregister removes feed"), Scheduler->GetFeedCount(), NumFeeds - 1);
+    }
+
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -1,7 +1,12 @@
 #include "Tests/PACS_Heli_KinematicsSpec.h"
 #include "Actors/Pawn/PACS_CandidateHelicopterCharacter.h"
 #include "Components/PACS_HeliMovementComponent.h"
+#include "Data/Configs/PACS_CandidateHelicopterData.h"
+#include "Curves/CurveFloat.h"
+#include "HAL/PlatformTime.h"
+#include "Data/Settings/PACS_CustomSignificanceManager.h"
 #include "Engine/World.h"
+#include "Engine/Engine.h"
 #include "Tests/PACS_Heli_TestHelpers.h"
 
 bool FPACS_Heli_KinematicsSpec::RunTest(const FString& Parameters)
@@ -19,24 +24,183 @@ bool FPACS_Heli_KinematicsSpec::RunTest(const FString& Parameters)
     if (!CMC) return false;
 
     // Set fixed speed and two different radii. Angular rate must change; linear speed must not.
-    CMC->SpeedCms = 2000.f;
-    CMC->RadiusCm = 10000.f;
-    CMC->AngleRad = 0.f;
+    // The pawn follows the closed-form orbit, so targets are set on the actor (instant) and the
+    // pawn is given a short settle before each measurement instead of being teleported.
+    Pawn->OrbitTargets.SpeedCms = 2000.f;
+    Pawn->OrbitTargets.RadiusCm = 10000.f;
+    Pawn->OrbitTargets.CenterDurS = Pawn->OrbitTargets.AltDurS = Pawn->OrbitTargets.RadiusDurS = Pawn->OrbitTargets.SpeedDurS = 0.f;
 
     // Pump world one second and capture distance traveled along tangent magnitude
     const float Dt = 1.f;
-    const FVector Start = Pawn->GetActorLocation();
+    const float Settle = 0.25f;
+    PACSHeliTest::PumpWorld(World, Settle);
+    const FVector Start1 = Pawn->GetActorLocation();
     PACSHeliTest::PumpWorld(World, Dt);
-    const float Dist1 = FVector::Dist(Start, Pawn->GetActorLocation());
+    const float Dist1 = FVector::Dist(Start1, Pawn->GetActorLocation());
 
     // Change radius only
-    CMC->RadiusCm = 20000.f;
-    Pawn->SetActorLocation(Start);
-    CMC->AngleRad = 0.f;
+    Pawn->OrbitTargets.RadiusCm = 20000.f;
+    PACSHeliTest::PumpWorld(World, Settle);
+    const FVector Start2 = Pawn->GetActorLocation();
     PACSHeliTest::PumpWorld(World, Dt);
-    const float Dist2 = FVector::Dist(Start, Pawn->GetActorLocation());
+    const float Dist2 = FVector::Dist(Start2, Pawn->GetActorLocation());
 
-    // Distances should be roughly equal (tolerance for numeric)
+    // Chords over one second differ by ~2.5 cm between these radii (tolerance for numeric)
     TestTrue(TEXT("Linear distance invariant over radius change"), FMath::IsNearlyEqual(Dist1, Dist2, 5.f));
+
+    // Pawn sits on the closed-form orbit point for the current angle
+    const FVector Expected = UPACS_HeliMovementComponent::OrbitPositionAt(CMC->CenterCm, CMC->RadiusCm, CMC->AngleRad, CMC->AltitudeCm);
+    TestTrue(TEXT("Pawn on closed-form orbit"), Pawn->GetActorLocation().Equals(Expected, 5.f));
+    return true;
+}
+
+bool FPACS_Heli_CurveLUTSpec::RunTest(const FString& Parameters)
+{
+    // Ease-in/ease-out curve with an overshoot, shaped like the authored orbit interps
+    UCurveFloat* Curve = NewObject<UCurveFloat>();
+    Curve->FloatCurve.AddKey(0.f,  0.f);
+    Curve->FloatCurve.AddKey(0.6f, 1.08f);
+    Curve->FloatCurve.AddKey(1.f,  1.f);
+    for (auto It = Curve->FloatCurve.GetKeyHandleIterator(); It; ++It)
+    {
+        Curve->FloatCurve.SetKeyInterpMode(*It, RCIM_Cubic);
+        Curve->FloatCurve.SetKeyTangentMode(*It, RCTM_Auto);
+    }
+
+    UPACS_CandidateHelicopterData* Data = NewObject<UPACS_CandidateHelicopterData>();
+    Data->CenterInterp = Curve;
+    Data->bUseCurveLUTs = true;
+    Data->CurveLUTSamples = FPACS_CurveLUT::DefaultSamples;
+    Data->BakeCurveLUTs();
+    TestEqual(TEXT("Center LUT baked"), Data->GetCurveLUT(EPACS_OrbitCurve::Center).Num(), FPACS_CurveLUT::DefaultSamples);
+    TestEqual(TEXT("Unset curve has no LUT"), Data->GetCurveLUT(EPACS_OrbitCurve::Alt).Num(), 0);
+
+    // Error bound vs the exact curve over a dense sweep (includes both ends)
+    const int32 Probes = 10000;
+    float MaxErr = 0.f;
+    for (int32 i = 0; i <= Probes; ++i)
+    {
+        const float T = float(i) / float(Probes);
+        MaxErr = FMath::Max(MaxErr, FMath::Abs(Data->EvalOrbitCurve01(EPACS_OrbitCurve::Center, T) - Curve->GetFloatValue(T)));
+    }
+    AddInfo(FString::Printf(TEXT("LUT %d samples: max abs error %.6f"), FPACS_CurveLUT::DefaultSamples, MaxErr));
+    TestTrue(TEXT("LUT error within 1e-3"), MaxErr < 1e-3f);
+    TestEqual(TEXT("Clamped below"), Data->EvalOrbitCurve01(EPACS_OrbitCurve::Center, -1.f), Curve->GetFloatValue(0.f));
+    TestEqual(TEXT("Clamped above"), Data->EvalOrbitCurve01(EPACS_OrbitCurve::Center,  2.f), Curve->GetFloatValue(1.f));
+    TestEqual(TEXT("Unset curve is linear"), Data->EvalOrbitCurve01(EPACS_OrbitCurve::Alt, 0.25f), 0.25f);
+
+    // Editing the asset's keys rebakes without reassigning the curve
+    const FKeyHandle MidKey = Curve->FloatCurve.FindKey(0.6f);
+    Curve->FloatCurve.SetKeyValue(MidKey, 1.2f);
+    Data->PrepareCurveLUTs();
+    TestTrue(TEXT("Prepare rebakes after a key edit"), Data->GetCurveLUT(EPACS_OrbitCurve::Center).IsBakedFrom(Curve));
+    TestTrue(TEXT("LUT follows the edited key"), FMath::IsNearlyEqual(Data->EvalOrbitCurve01(EPACS_OrbitCurve::Center, 0.6f), Curve->GetFloatValue(0.6f), 1e-3f));
+    Curve->FloatCurve.SetKeyValue(MidKey, 1.08f);
+    TestTrue(TEXT("Eval rebakes after a key edit"), FMath::IsNearlyEqual(Data->EvalOrbitCurve01(EPACS_OrbitCurve::Center, 0.6f), Curve->GetFloatValue(0.6f), 1e-3f));
+
+    // Fallback path is exact
+    Data->bUseCurveLUTs = false;
+    TestEqual(TEXT("Exact fallback"), Data->EvalOrbitCurve01(EPACS_OrbitCurve::Center, 0.37f), Curve->GetFloatValue(0.37f));
+
+    // Micro-benchmark: per-eval cost of LUT vs exact curve evaluation (reported only; timing is too noisy to assert on shared machines)
+    const int32 Iters = 1000000;
+    float Sink = 0.f;
+
+    Data->bUseCurveLUTs = true;
+    const double L0 = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Iters; ++i) { Sink += Data->EvalOrbitCurve01(EPACS_OrbitCurve::Center, float(i & 1023) * (1.f / 1023.f)); }
+    const double L1 = FPlatformTime::Seconds();
+
+    Data->bUseCurveLUTs = false;
+    for (int32 i = 0; i < Iters; ++i) { Sink += Data->EvalOrbitCurve01(EPACS_OrbitCurve::Center, float(i & 1023) * (1.f / 1023.f)); }
+    const double L2 = FPlatformTime::Seconds();
+
+    const double LutNs   = (L1 - L0) * 1e9 / Iters;
+    const double CurveNs = (L2 - L1) * 1e9 / Iters;
+    AddInfo(FString::Printf(TEXT("LUT %.1f ns/eval, curve %.1f ns/eval (sink %.1f)"), LutNs, CurveNs, Sink));
+    return true;
+}
+
+bool FPACS_Heli_BankSpec::RunTest(const FString& Parameters)
+{
+    UWorld* World = GWorld;
+    TestNotNull(TEXT("World available"), World);
+    if (!World) return false;
+
+    auto* Pawn = PACSHeliTest::SpawnCandidate(World, FVector::ZeroVector);
+    TestNotNull(TEXT("Spawned candidate"), Pawn);
+    if (!Pawn) return false;
+
+    auto* CMC = Cast<UPACS_HeliMovementComponent>(Pawn->GetCharacterMovement());
+    TestNotNull(TEXT("Has heli CMC"), CMC);
+    if (!CMC) return false;
+
+    UPACS_CandidateHelicopterData* Data = NewObject<UPACS_CandidateHelicopterData>();
+    Data->MaxBankDeg = 10.f;
+    Data->BankApplyThresholdDeg = 0.05f;
+    CMC->Data = Data;
+    Pawn->Data = Data;
+
+    // BeginPlay does not run in the editor world, so apply its tick setup directly
+    Pawn->DisableActorTickIfUnused();
+    TestFalse(TEXT("Actor tick disabled"), Pawn->IsActorTickEnabled());
+
+    // Coordinated turn: 20 m/s on a 300 m radius is ~7.8 deg, inside the clamp; faster saturates
+    const float Expected = -FMath::RadiansToDegrees(FMath::Atan(2000.f * 2000.f / 30000.f / 980.665f));
+    TestTrue(TEXT("Bank target from angular velocity"), FMath::IsNearlyEqual(UPACS_HeliMovementComponent::ComputeBankTargetDeg(2000.f, 30000.f, 10.f), Expected, 0.01f));
+    TestEqual(TEXT("Bank target clamped"), UPACS_HeliMovementComponent::ComputeBankTargetDeg(6000.f, 5000.f, 10.f), -10.f);
+    TestEqual(TEXT("No bank when hovering"), UPACS_HeliMovementComponent::ComputeBankTargetDeg(0.f, 30000.f, 10.f), 0.f);
+
+    CMC->SpeedCms = 2000.f;
+    CMC->RadiusCm = 30000.f;
+    CMC->BankUpdateInterval = 0.f;
+    const float Dt = 1.f / 60.f;
+
+    // Settle: bank eases onto the target and the frame follows
+    for (int32 i = 0; i < 300; ++i) CMC->UpdateBank(Dt);
+    TestTrue(TEXT("Bank converged"), FMath::IsNearlyEqual(Pawn->CurrentBankDeg, Expected, 0.1f));
+    TestTrue(TEXT("Frame roll applied"), FMath::IsNearlyEqual(Pawn->HelicopterFrame->GetRelativeRotation().Roll, Pawn->CurrentBankDeg, Data->BankApplyThresholdDeg + 0.01f));
+
+    // Steady orbit: no further transform writes
+    const int32 UpdatesSettled = CMC->BankTransformUpdates;
+    for (int32 i = 0; i < 600; ++i) CMC->UpdateBank(Dt);
+    AddInfo(FString::Printf(TEXT("Bank transform updates: %d while settling, %d in 10 s steady"), UpdatesSettled, CMC->BankTransformUpdates - UpdatesSettled));
+    TestEqual(TEXT("No transform updates while steady"), CMC->BankTransformUpdates, UpdatesSettled);
+
+    // Speed change with a distant-proxy interval: at most 4 evaluations a second, so at most 4 writes
+    CMC->SpeedCms = 1000.f;
+    CMC->BankUpdateInterval = 0.25f;
+    const int32 UpdatesBefore = CMC->BankTransformUpdates;
+    for (int32 i = 0; i < 60; ++i) CMC->UpdateBank(Dt);
+    const int32 Throttled = CMC->BankTransformUpdates - UpdatesBefore;
+    TestTrue(TEXT("Distant interval throttles bank writes"), Throttled > 0 && Throttled <= 4);
+
+    Pawn->Destroy();
+
+    // Significance registration outlives a role change. Private game world: the editor world has no
+    // significance manager, and BeginPlay does not run there, so registration is driven directly.
+    UWorld* GameWorld = UWorld::CreateWorld(EWorldType::Game, false, TEXT("PACS_HeliSignificanceTest"));
+    FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+    WorldContext.SetCurrentWorld(GameWorld);
+
+    UPACS_CustomSignificanceManager* Manager = UPACS_CustomSignificanceManager::Get(GameWorld);
+    TestNotNull(TEXT("PACS significance manager in game world"), Manager);
+    auto* Proxy = PACSHeliTest::SpawnCandidate(GameWorld, FVector::ZeroVector);
+    if (Manager && Proxy)
+    {
+        Proxy->SetRole(ROLE_SimulatedProxy);
+        Proxy->RegisterSignificance();
+        TestTrue(TEXT("Simulated proxy registered"), Proxy->IsSignificanceRegistered() && Manager->GetManagedObject(Proxy) != nullptr);
+
+        // Possessed on this client after registering
+        Proxy->SetRole(ROLE_AutonomousProxy);
+        Proxy->UnregisterSignificance();
+        TestFalse(TEXT("Unregistered after becoming autonomous"), Proxy->IsSignificanceRegistered());
+        TestNull(TEXT("Manager no longer holds the helicopter"), Manager->GetManagedObject(Proxy));
+        TestEqual(TEXT("No budget slot left behind"), Manager->GetNumBudgetedObjects(), 0);
+    }
+
+    GEngine->DestroyWorldContext(GameWorld);
+    GameWorld->DestroyWorld(false);
     return true;
 }
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include "Tests/PACS_Heli_OrbitCenterGridSpec.h"
+#include "Tests/PACS_Heli_TestHelpers.h"
+#include "Subsystems/PACS_OrbitCenterGrid.h"
+#include "Math/RandomStream.h"
+#include "Engine/World.h"
+
+bool FPACS_Heli_OrbitCenterGridSpec::RunTest(const FString& Parameters)
+{
+    UWorld* World = GWorld;
+    TestNotNull(TEXT("World available"), World);
+    if (!World) return false;
+
+    UPACS_OrbitCenterGrid* Grid = World->GetSubsystem<UPACS_OrbitCenterGrid>();
+    TestNotNull(TEXT("Orbit centre grid subsystem"), Grid);
+    if (!Grid) return false;
+
+    // 2 km square well away from anything in the test map, with a tower, a wall and a low building
+    const FVector AreaMin(2000000.f, 2000000.f, 0.f);
+    const FVector AreaMax(2200000.f, 2200000.f, 0.f);
+    TArray<AActor*> Boxes;
+    Boxes.Add(PACSHeliTest::SpawnBlockingBox(World, AreaMin + FVector(50000.f, 50000.f, 20000.f), FVector(3000.f, 3000.f, 20000.f), TEXT("GridTower")));
+    Boxes.Add(PACSHeliTest::SpawnBlockingBox(World, AreaMin + FVector(120000.f, 100000.f, 30000.f), FVector(200.f, 60000.f, 30000.f), TEXT("GridWall")));
+    Boxes.Add(PACSHeliTest::SpawnBlockingBox(World, AreaMin + FVector(160000.f, 40000.f, 1000.f), FVector(8000.f, 8000.f, 1000.f), TEXT("GridLowBuilding")));
+
+    FPACS_OrbitCenterGridParams Params;
+    Params.CellCm = 2500.f;
+    Params.MaxCellsPerAxis = 256;
+    Params.MinZCm = 2000.f;
+    Params.MaxZCm = 50000.f;
+    Grid->Build(FBox(AreaMin, AreaMax), Params);
+
+    TestTrue(TEXT("Grid built"), Grid->IsBuilt());
+    TestEqual(TEXT("Cells per axis"), Grid->GetNumCellsX(), 80);
+    TestTrue(TEXT("Most cells open"), Grid->GetAllowedCellCount() > Grid->GetNumCellsX() * Grid->GetNumCellsY() / 2);
+
+    // Sample the area (plus a margin outside it and outside the height band) and compare with the plain overlap
+    FRandomStream Rng(40);
+    Grid->ResetCounters();
+    int32 Mismatches = 0, Rejected = 0, Samples = 0;
+    for (int32 Y = 0; Y < 60; ++Y)
+    {
+        for (int32 X = 0; X < 60; ++X)
+        {
+            const FVector P(
+                AreaMin.X - 10000.f + (X + Rng.FRand()) * (220000.f / 60.f),
+                AreaMin.Y - 10000.f + (Y + Rng.FRand()) * (220000.f / 60.f),
+                Rng.FRandRange(Params.MinZCm - 1500.f, Params.MaxZCm + 5000.f));
+
+            const bool bGrid = Grid->IsCenterValid(P);
+            const bool bOverlap = UPACS_OrbitCenterGrid::OverlapCenter(World, P);
+            ++Samples;
+            Rejected += bOverlap ? 0 : 1;
+            if (bGrid != bOverlap && Mismatches++ == 0)
+            {
+                AddError(FString::Printf(TEXT("Grid says %s, overlap says %s at %s"),
+                    bGrid ? TEXT("valid") : TEXT("blocked"), bOverlap ? TEXT("valid") : TEXT("blocked"), *P.ToString()));
+            }
+        }
+    }
+
+    AddInfo(FString::Printf(TEXT("%d samples: %d grid accepts, %d boundary overlaps, %d fallback overlaps, %d rejected"),
+        Samples, Grid->GridAccepts, Grid->BoundaryOverlaps, Grid->FallbackOverlaps, Rejected));
+    TestEqual(TEXT("Grid agrees with overlap everywhere"), Mismatches, 0);
+    TestTrue(TEXT("Some centres rejected"), Rejected > 0);
+    TestTrue(TEXT("Open cells skip the static overlap"), Grid->GridAccepts > Samples / 2);
+    TestTrue(TEXT("Boundary cells ran the overlap"), Grid->BoundaryOverlaps > 0);
+    TestTrue(TEXT("Outside the grid falls back"), Grid->FallbackOverlaps > 0);
+
+    // A blocker that appears in an open cell after the build is still rejected
+    const FVector OpenCentre = AreaMin + FVector(20000.f, 150000.f, 10000.f);
+    bool bInGrid = false;
+    TestTrue(TEXT("Late blocker cell is open"), Grid->GetCell(OpenCentre, bInGrid) == EPACS_OrbitCenterCell::Allowed && bInGrid);
+    TestTrue(TEXT("Open centre valid before the blocker"), Grid->IsCenterValid(OpenCentre));
+    AActor* LateBlocker = PACSHeliTest::SpawnBlockingBox(World, OpenCentre, FVector(500.f, 500.f, 500.f), TEXT("GridLateBlocker"));
+    TestFalse(TEXT("Late blocker rejected in an open cell"), Grid->IsCenterValid(OpenCentre));
+    TestEqual(TEXT("Grid agrees with overlap for the late blocker"), Grid->IsCenterValid(OpenCentre), UPACS_OrbitCenterGrid::OverlapCenter(World, OpenCentre));
+    if (LateBlocker) LateBlocker->Destroy();
+
+    // Static collision added later sends its cells back to the full overlap
+    const int32 AllowedBefore = Grid->GetAllowedCellCount();
+    Grid->MarkBoundary(FBox::BuildAABB(OpenCentre, FVector(500.f)));
+    TestTrue(TEXT("Marked cell needs the overlap"), Grid->GetCell(OpenCentre, bInGrid) == EPACS_OrbitCenterCell::Boundary);
+    TestTrue(TEXT("Allowed count drops"), Grid->GetAllowedCellCount() < AllowedBefore);
+
+    for (AActor* Box : Boxes)
+    {
+        if (Box) Box->Destroy();
+    }
+    Grid->BuildFromLevel();
+    return true;
+}
@@ -0,0 +1,113 @@
+#include "Tests/PACS_Heli_OrbitEditSpec.h"
+#include "Tests/PACS_Heli_TestHelpers.h"
+#include "Actors/Pawn/PACS_CandidateHelicopterCharacter.h"
+#include "Data/PACS_OrbitMessages.h"
+#include "Settings/PACS_NetPerfSettings.h"
+#include "GameFramework/PlayerState.h"
+#include "Engine/World.h"
+
+bool FPACS_Heli_OrbitEditSpec::RunTest(const FString& Parameters)
+{
+    UWorld* World = GWorld;
+    TestNotNull(TEXT("World available"), World);
+    if (!World) return false;
+
+    auto* Pawn = PACSHeliTest::SpawnCandidate(World, FVector::ZeroVector);
+    TestNotNull(TEXT("Spawned candidate"), Pawn);
+    if (!Pawn) return false;
+
+    // Server only applies edits to a selected helicopter
+    APlayerState* Assessor = World->SpawnActor<APlayerState>();
+    Pawn->SelectedBy = Assessor;
+
+    // --- Server: many edits inside one tick apply once ---
+    const uint8 Version0 = Pawn->OrbitParamsVersion;
+    const uint32 Validations0 = Pawn->OrbitCenterValidations;
+    for (int32 i = 1; i <= 10; ++i)
+    {
+        FPACS_OrbitEdit E;
+        E.bHasCenter = true; E.NewCenterCm = FVector(100.f * i, 0.f, 0.f);
+        E.bHasAlt = true;    E.NewAltCm = 20000.f + i;
+        E.TransactionId = uint16(Pawn->LastAppliedTxnId + 1);
+        Pawn->Server_ApplyOrbitParams_Implementation(E);
+    }
+    PACSHeliTest::PumpWorld(World, 1.f / 60.f);
+    Pawn->ApplyPendingOrbitEdits(); // no-op if the next-tick timer already ran
+
+    TestEqual(TEXT("One version bump per tick"), uint8(Pawn->OrbitParamsVersion - Version0), uint8(1));
+    TestEqual(TEXT("One centre validation per tick"), Pawn->OrbitCenterValidations - Validations0, 1u);
+    TestEqual(TEXT("Last altitude in the tick wins"), Pawn->OrbitTargets.AltitudeCm, 20010.f);
+
+    // --- Client -> server: 200 slider edits streamed at 100 Hz ---
+    const int32 Edits = 200;
+    const float EditDt = 0.01f;
+    const float MaxPerSecond = UPACS_NetPerfSettings::Get()->MaxOrbitEditsPerSecond;
+    const uint8  Version1 = Pawn->OrbitParamsVersion;
+    const uint32 Validations1 = Pawn->OrbitCenterValidations;
+    const uint32 Sent1 = Pawn->OrbitEditRPCsSent;
+
+    for (int32 i = 1; i <= Edits; ++i)
+    {
+        FPACS_OrbitEdit E;
+        E.bHasCenter = true; E.NewCenterCm = FVector(10.f * i, 0.f, 0.f);
+        E.bHasRadius = true; E.NewRadiusCm = 10000.f + 10.f * i;
+        Pawn->QueueOrbitEdit(E);
+        PACSHeliTest::PumpWorld(World, EditDt, EditDt);
+    }
+    // Let the trailing send and the server apply run
+    PACSHeliTest::PumpWorld(World, 2.f / MaxPerSecond);
+
+    const uint32 Sent      = Pawn->OrbitEditRPCsSent - Sent1;
+    const uint32 Overlaps  = Pawn->OrbitCenterValidations - Validations1;
+    const uint32 Versions  = uint8(Pawn->OrbitParamsVersion - Version1);
+    const uint32 MaxSends  = uint32(FMath::CeilToInt(Edits * EditDt * MaxPerSecond)) + 2;
+    AddInfo(FString::Printf(TEXT("%d edits -> %u RPCs, %u overlap tests, %u version bumps (cap %u)"), Edits, Sent, Overlaps, Versions, MaxSends));
+
+    TestTrue(TEXT("RPCs bounded by rate"), Sent > 0 && Sent <= MaxSends);
+    TestTrue(TEXT("Overlap tests bounded by RPCs"), Overlaps <= Sent);
+    TestTrue(TEXT("Version bumps bounded by RPCs"), Versions > 0 && Versions <= Sent);
+    TestEqual(TEXT("Final centre applied"), FVector(Pawn->OrbitTargets.CenterCm), FVector(10.f * Edits, 0.f, 0.f));
+    TestEqual(TEXT("Final radius applied"), Pawn->OrbitTargets.RadiusCm, 10000.f + 10.f * Edits);
+
+    // --- Transaction ids keep their order across the uint16 wrap ---
+    {
+        FPACS_OrbitEditAccumulator Accumulator;
+        uint16 Prev = 0;
+        bool bAllNewer = true;
+        bool bSkippedZero = true;
+        for (int32 i = 0; i < 70000; ++i)
+        {
+            FPACS_OrbitEdit E;
+            E.bHasAlt = true;
+            Accumulator.Add(E);
+            const uint16 Id = Accumulator.Consume(double(i)).TransactionId;
+            bSkippedZero &= Id != 0;
+            bAllNewer &= Prev == 0 || FPACS_OrbitEdit::IsNewerTransaction(Id, Prev);
+            Prev = Id;
+        }
+        TestTrue(TEXT("Client ids never 0"), bSkippedZero);
+        TestTrue(TEXT("Each client id newer than the last across the wrap"), bAllNewer);
+
+        auto SendAlt = [&](uint16 Id, float AltCm)
+        {
+            FPACS_OrbitEdit E;
+            E.bHasAlt = true; E.NewAltCm = AltCm;
+            E.TransactionId = Id;
+            Pawn->Server_ApplyOrbitParams_Implementation(E);
+            Pawn->ApplyPendingOrbitEdits();
+        };
+
+        Pawn->LastAppliedTxnId = 65534;
+        SendAlt(65535, 30000.f);
+        TestEqual(TEXT("Id before the wrap applied"), Pawn->OrbitTargets.AltitudeCm, 30000.f);
+        SendAlt(1, 31000.f);
+        TestEqual(TEXT("Id after the wrap applied"), Pawn->OrbitTargets.AltitudeCm, 31000.f);
+        SendAlt(65535, 32000.f);
+        TestEqual(TEXT("Stale id from before the wrap rejected"), Pawn->OrbitTargets.AltitudeCm, 31000.f);
+        TestEqual(TEXT("Last applied id"), Pawn->LastAppliedTxnId, uint16(1));
+    }
+
+    Pawn->Destroy();
+    if (Assessor) Assessor->Destroy();
+    return true;
+}
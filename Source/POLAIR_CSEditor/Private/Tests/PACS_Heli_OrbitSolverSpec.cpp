@@ -0,0 +1,132 @@
+#include "Tests/PACS_Heli_OrbitSolverSpec.h"
+#include "Tests/PACS_Heli_TestHelpers.h"
+#include "Actors/Pawn/PACS_CandidateHelicopterCharacter.h"
+#include "Components/PACS_HeliMovementComponent.h"
+#include "Data/Configs/PACS_CandidateHelicopterData.h"
+#include "Subsystems/PACS_HeliOrbitSolver.h"
+#include "Subsystems/PACS_ServerClockSubsystem.h"
+#include "Curves/CurveFloat.h"
+#include "Math/RandomStream.h"
+#include "Misc/App.h"
+#include "Engine/World.h"
+
+bool FPACS_Heli_OrbitSolverSpec::RunTest(const FString& Parameters)
+{
+    UWorld* World = GWorld;
+    TestNotNull(TEXT("World available"), World);
+    if (!World) return false;
+
+    UPACS_HeliOrbitSolver* Solver = World->GetSubsystem<UPACS_HeliOrbitSolver>();
+    TestNotNull(TEXT("Orbit solver subsystem"), Solver);
+    if (!Solver) return false;
+
+    // Eased curve so the LUT path is exercised from worker threads
+    UCurveFloat* Curve = NewObject<UCurveFloat>();
+    Curve->FloatCurve.AddKey(0.f, 0.f);
+    Curve->FloatCurve.AddKey(1.f, 1.f);
+    for (auto It = Curve->FloatCurve.GetKeyHandleIterator(); It; ++It)
+    {
+        Curve->FloatCurve.SetKeyInterpMode(*It, RCIM_Cubic);
+    }
+
+    UPACS_CandidateHelicopterData* Data = NewObject<UPACS_CandidateHelicopterData>();
+    Data->CenterInterp = Curve;
+    Data->AltInterp    = Curve;
+    Data->RadiusInterp = Curve;
+    Data->SpeedInterp  = Curve;
+    Data->PrepareCurveLUTs();
+
+    const int32 N = 200;
+    FRandomStream Rng(39);
+    TArray<APACS_CandidateHelicopterCharacter*> Pawns;
+    TArray<UPACS_HeliMovementComponent*> CMCs;
+    TArray<FPACS_HeliOrbitState> States;
+
+    for (int32 i = 0; i < N; ++i)
+    {
+        const FVector Pos((i % 20) * 40000.f, (i / 20) * 40000.f, 20000.f);
+        auto* P = PACSHeliTest::SpawnCandidate(World, Pos);
+        auto* CMC = P ? Cast<UPACS_HeliMovementComponent>(P->GetCharacterMovement()) : nullptr;
+        if (!CMC) continue;
+
+        P->Data = Data;
+        CMC->Data = Data;
+        CMC->CenterCm   = Pos;
+        CMC->AltitudeCm = 20000.f;
+        CMC->RadiusCm   = 15000.f;
+        CMC->SpeedCms   = 2000.f;
+        CMC->AngleRad   = Rng.FRandRange(-PI, PI);
+
+        // Every parameter mid-interpolation with its own duration and start
+        P->OrbitTargets.CenterCm   = Pos + FVector(Rng.FRandRange(-5000.f, 5000.f), Rng.FRandRange(-5000.f, 5000.f), 0.f);
+        P->OrbitTargets.AltitudeCm = Rng.FRandRange(15000.f, 25000.f);
+        P->OrbitTargets.RadiusCm   = Rng.FRandRange(10000.f, 30000.f);
+        P->OrbitTargets.SpeedCms   = Rng.FRandRange(1000.f, 4000.f);
+        P->OrbitTargets.CenterDurS = Rng.FRandRange(2.f, 8.f);
+        P->OrbitTargets.AltDurS    = Rng.FRandRange(2.f, 8.f);
+        P->OrbitTargets.RadiusDurS = Rng.FRandRange(2.f, 8.f);
+        P->OrbitTargets.SpeedDurS  = Rng.FRandRange(2.f, 8.f);
+        P->OrbitAnchors.CenterStartS = Rng.FRandRange(0.f, 2.f);
+        P->OrbitAnchors.AltStartS    = Rng.FRandRange(0.f, 2.f);
+        P->OrbitAnchors.RadiusStartS = Rng.FRandRange(0.f, 2.f);
+        P->OrbitAnchors.SpeedStartS  = Rng.FRandRange(0.f, 2.f);
+        P->OrbitAnchors.OrbitStartS  = 0.f;
+        P->OrbitAnchors.AngleAtStart = CMC->AngleRad;
+
+        Pawns.Add(P);
+        CMCs.Add(CMC);
+        CMC->GatherOrbitState(States.AddDefaulted_GetRef());
+    }
+    TestEqual(TEXT("Spawned all helicopters"), CMCs.Num(), N);
+
+    // Same inputs through both paths for 4 s of 30 Hz frames; each path carries its own state forward
+    const float FrameDt = FApp::GetDeltaTime();
+    int32 Mismatches = 0;
+    for (int32 f = 0; f < 120; ++f)
+    {
+        const float NowS = f / 30.f;
+
+        for (UPACS_HeliMovementComponent* CMC : CMCs)
+        {
+            CMC->ServerNowS = NowS;
+            CMC->Eval_Server();
+            CMC->UpdateAngle_Server();
+        }
+
+        // MinParallelCount 1: always ParallelFor
+        UPACS_HeliOrbitSolver::SolveStates(States, NowS, FrameDt, 1);
+
+        for (int32 i = 0; i < CMCs.Num(); ++i)
+        {
+            const UPACS_HeliMovementComponent* CMC = CMCs[i];
+            const FPACS_HeliOrbitState& S = States[i];
+            const bool bSame = CMC->CenterCm == S.CenterCm && CMC->AltitudeCm == S.AltitudeCm && CMC->RadiusCm == S.RadiusCm
+                && CMC->SpeedCms == S.SpeedCms && CMC->AngleRad == S.AngleRad && CMC->EvalOrbitPosition() == S.PositionCm;
+            if (!bSame && Mismatches++ == 0)
+            {
+                AddError(FString::Printf(TEXT("Heli %d diverged at frame %d: %s vs %s"), i, f,
+                    *CMC->EvalOrbitPosition().ToString(), *S.PositionCm.ToString()));
+            }
+        }
+    }
+    TestEqual(TEXT("Solver matches per-component path bit for bit"), Mismatches, 0);
+
+    // Through the world: components consume the frame's solve instead of evaluating themselves
+    const bool bWasEnabled = Solver->IsEnabled();
+    Solver->SetEnabled(true);
+    PACSHeliTest::PumpWorld(World, 0.25f);
+
+    TestTrue(TEXT("All helicopters registered"), Solver->GetRegisteredCount() >= N);
+    TestTrue(TEXT("All helicopters solved in one pass"), Solver->GetLastSolveCount() >= N);
+
+    int32 Consumed = 0;
+    for (UPACS_HeliMovementComponent* CMC : CMCs)
+    {
+        Consumed += CMC->ServerNowS == (float)UPACS_ServerClockSubsystem::GetServerNowS(World) ? 1 : 0;
+    }
+    TestEqual(TEXT("Every component took this frame's solve"), Consumed, CMCs.Num());
+
+    Solver->SetEnabled(bWasEnabled);
+    for (auto* P : Pawns) P->Destroy();
+    return true;
+}
@@ -11,13 +11,13 @@ bool FPACS_Heli_PerfSpec::RunTest(const FString& Parameters)
     TestNotNull(TEXT("World"), World);
     if (!World) return false;
 
-    const int32 N = 25; // adjust if needed for local hardware
+    const int32 N = 100; // adjust if needed for local hardware
     TArray<APACS_CandidateHelicopterCharacter*> Actors;
     Actors.Reserve(N);
 
     for (int32 i=0;i<N;++i)
     {
-        auto* P = PACSHeliTest::SpawnCandidate(World, FVector(i*2000.f, 0, 20000.f));
+        auto* P = PACSHeliTest::SpawnCandidate(World, FVector((i % 10)*40000.f, (i / 10)*40000.f, 20000.f));
         TestNotNull(TEXT("Spawned"), P);
         if (P)
         {
@@ -36,5 +36,57 @@ bool FPACS_Heli_PerfSpec::RunTest(const FString& Parameters)
 
     // Loose budget: < 0.0008 s per actor per second of simulated time on dev machine
     TestTrue(TEXT("Per-actor perf budget ok"), PerActorPerSecond < 0.0008);
+
+    // Per-proxy cost: drive the simulated-proxy step directly (every actor is authority in this world)
+    // and compare it against the swept step the authority uses. Open sky, so proxies must teleport.
+    const int32 Steps = 300;
+    const float StepDt = 1.f / 60.f;
+
+    for (auto* P : Actors)
+    {
+        auto* CMC = Cast<UPACS_HeliMovementComponent>(P->GetCharacterMovement());
+        CMC->ResetProxyCounters();
+        CMC->InvalidateProxyGeometryCache();
+    }
+
+    const double P0 = FPlatformTime::Seconds();
+    for (int32 s=0; s<Steps; ++s)
+    {
+        for (auto* P : Actors)
+        {
+            Cast<UPACS_HeliMovementComponent>(P->GetCharacterMovement())->SimulateProxyStep(StepDt);
+        }
+    }
+    const double P1 = FPlatformTime::Seconds();
+
+    for (int32 s=0; s<Steps; ++s)
+    {
+        for (auto* P : Actors)
+        {
+            Cast<UPACS_HeliMovementComponent>(P->GetCharacterMovement())->StepKinematics(StepDt);
+        }
+    }
+    const double P2 = FPlatformTime::Seconds();
+
+    int32 Teleports = 0, Sweeps = 0, Checks = 0;
+    for (auto* P : Actors)
+    {
+        const auto* CMC = Cast<UPACS_HeliMovementComponent>(P->GetCharacterMovement());
+        Teleports += CMC->ProxyTeleportSteps;
+        Sweeps    += CMC->ProxySweepSteps;
+        Checks    += CMC->ProxyGeometryChecks;
+    }
+
+    const double PerProxyStepUs = (P1 - P0) * 1e6 / double(Steps * Actors.Num());
+    const double PerSweptStepUs = (P2 - P1) * 1e6 / double(Steps * Actors.Num());
+    AddInfo(FString::Printf(TEXT("%d helis: proxy %.2f us/step, swept %.2f us/step, %d geometry checks"),
+        Actors.Num(), PerProxyStepUs, PerSweptStepUs, Checks));
+
+    TestEqual(TEXT("Proxies in open sky never sweep"), Sweeps, 0);
+    TestEqual(TEXT("Every proxy step teleported"), Teleports, Steps * Actors.Num());
+    TestTrue(TEXT("Geometry check is cached between steps"), Checks < Teleports / 10);
+
+    // Loose budget: < 20 us per proxy step on dev machine
+    TestTrue(TEXT("Per-proxy perf budget ok"), PerProxyStepUs < 20.0);
     return true;
 }
\ No newline at end of file
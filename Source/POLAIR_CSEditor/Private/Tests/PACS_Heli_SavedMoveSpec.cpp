@@ -0,0 +1,63 @@
+#include "Tests/PACS_Heli_SavedMoveSpec.h"
+#include "Components/PACS_HeliMovementComponent.h"
+#include "Data/PACS_HeliSavedMove.h"
+#include "Actors/Pawn/PACS_CandidateHelicopterCharacter.h"
+#include "Engine/World.h"
+#include "Tests/PACS_Heli_TestHelpers.h"
+
+bool FPACS_Heli_SavedMoveSpec::RunTest(const FString& Parameters)
+{
+    UWorld* World = GWorld;
+    TestNotNull(TEXT("World available"), World);
+    if (!World) return false;
+
+    auto* Pawn = PACSHeliTest::SpawnCandidate(World, FVector::ZeroVector);
+    TestNotNull(TEXT("Spawned candidate"), Pawn);
+    if (!Pawn) return false;
+
+    auto* CMC = Cast<UPACS_HeliMovementComponent>(Pawn->GetCharacterMovement());
+    TestNotNull(TEXT("Has heli CMC"), CMC);
+    if (!CMC) return false;
+
+    FNetworkPredictionData_Client_HeliOrbit Pred(*CMC);
+    const int32 Prewarmed = Pred.NumAllocatedMoves;
+    TestEqual(TEXT("Free list prewarmed"), Pred.FreeMoves.Num(), Prewarmed);
+
+    // 10k moves at client tick rate with up to 12 unacknowledged in flight; acks return moves to the free list
+    const int32 Moves = 10000;
+    const int32 InFlight = 12;
+    TArray<FSavedMovePtr> Pending;
+    int32 Created = 0;
+    for (int32 i = 0; i < Moves; ++i)
+    {
+        FSavedMovePtr Move = Pred.CreateSavedMove();
+        if (!Move.IsValid()) break;
+        ++Created;
+        Pending.Add(Move);
+
+        if (Pending.Num() > InFlight)
+        {
+            Pred.FreeMove(Pending[0]);
+            Pending.RemoveAt(0);
+        }
+    }
+
+    AddInfo(FString::Printf(TEXT("%d moves, %d allocations (%d prewarmed)"), Created, Pred.NumAllocatedMoves, Prewarmed));
+    TestEqual(TEXT("All moves created"), Created, Moves);
+    TestEqual(TEXT("No allocations after prewarm"), Pred.NumAllocatedMoves, Prewarmed);
+
+    // Orbit version gates combining; centre drift within a version does not
+    FSavedMove_HeliOrbit A, B;
+    A.SavedOrbitVersion = B.SavedOrbitVersion = 3;
+    A.SavedCenterCm = FVector::ZeroVector;
+    B.SavedCenterCm = FVector(500.f, 0.f, 0.f);
+    FSavedMovePtr BPtr = MakeShared<FSavedMove_HeliOrbit>(B);
+    TestTrue(TEXT("Same version combines despite centre drift"), A.CanCombineWith(BPtr, Pawn, 1.f));
+
+    static_cast<FSavedMove_HeliOrbit*>(BPtr.Get())->SavedOrbitVersion = 4;
+    TestFalse(TEXT("Version change never combines"), A.CanCombineWith(BPtr, Pawn, 1.f));
+
+    for (const FSavedMovePtr& Move : Pending) { Pred.FreeMove(Move); }
+    Pawn->Destroy();
+    return true;
+}
@@ -0,0 +1,162 @@
+#include "Tests/PACS_Heli_ScalabilityBench.h"
+#include "Tests/PACS_Heli_TestHelpers.h"
+#include "Actors/Pawn/PACS_CandidateHelicopterCharacter.h"
+#include "Components/PACS_HeliMovementComponent.h"
+#include "Components/PACS_HeliPhaseTimings.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    const int32 HeliCounts[] = { 50, 100, 250, 500 };
+    const int32 WarmupFrames = 30;
+    const int32 MeasuredFrames = 120;
+    const float FrameDt = 1.f / 60.f;
+    const double RegressionTolerance = 0.25;
+
+    FString BaselinePath()
+    {
+        return FPaths::Combine(FPaths::GameSourceDir(), TEXT("POLAIR_CSEditor/Private/Tests/Baselines/PACS_HeliScalability_Baseline.csv"));
+    }
+
+    void DisableCCTV(APACS_CandidateHelicopterCharacter* Heli)
+    {
+        for (USceneCaptureComponent2D* Cam : { Heli->ExternalCam, Heli->ExternalCam2 })
+        {
+            if (!Cam) continue;
+            Cam->bCaptureEveryFrame = false;
+            Cam->bCaptureOnMovement = false;
+            Cam->Deactivate();
+        }
+    }
+}
+
+void FPACS_Heli_ScalabilityBench::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+    for (int32 Count : HeliCounts)
+    {
+        OutBeautifiedNames.Add(FString::Printf(TEXT("%d"), Count));
+        OutTestCommands.Add(FString::FromInt(Count));
+    }
+}
+
+bool FPACS_Heli_ScalabilityBench::RunTest(const FString& Parameters)
+{
+    const int32 N = FCString::Atoi(*Parameters);
+    TestTrue(TEXT("Helicopter count"), N > 0);
+    if (N <= 0) return false;
+
+    if (!GUsingNullRHI)
+    {
+        AddInfo(TEXT("Not running under -NullRHI; CCTV capture is disabled but other render work is included in Frame"));
+    }
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("PACS_HeliScalability"));
+    FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+    WorldContext.SetCurrentWorld(World);
+    World->InitializeActorsForPlay(FURL());
+    World->BeginPlay();
+
+    // Grid far enough apart that orbits (r = 150 m) never overlap
+    const int32 Side = FMath::CeilToInt(FMath::Sqrt(float(N)));
+    const float Spacing = 40000.f;
+    int32 Spawned = 0;
+    for (int32 i = 0; i < N; ++i)
+    {
+        const FVector Center((i % Side) * Spacing, (i / Side) * Spacing, 0.f);
+        auto* Heli = PACSHeliTest::SpawnCandidate(World, Center + FVector(0, 0, 20000.f));
+        if (!Heli) continue;
+
+        DisableCCTV(Heli);
+        if (auto* CMC = Cast<UPACS_HeliMovementComponent>(Heli->GetCharacterMovement()))
+        {
+            CMC->bRunPhysicsWithNoController = true;
+            CMC->CenterCm   = Center;
+            CMC->AltitudeCm = 20000.f;
+            CMC->RadiusCm   = 15000.f;
+            CMC->SpeedCms   = 2222.22f;
+        }
+        ++Spawned;
+    }
+    TestEqual(TEXT("All helicopters spawned"), Spawned, N);
+
+    PACSHeliTest::PumpWorld(World, WarmupFrames * FrameDt, FrameDt);
+
+    FPACS_HeliPhaseTimings::Reset();
+    FPACS_HeliPhaseTimings::bEnabled = true;
+    const double T0 = FPlatformTime::Seconds();
+    PACSHeliTest::PumpWorld(World, MeasuredFrames * FrameDt, FrameDt);
+    const double T1 = FPlatformTime::Seconds();
+    FPACS_HeliPhaseTimings::bEnabled = false;
+
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+
+    // Per helicopter per frame
+    const double HeliFrames = double(FMath::Max(Spawned, 1)) * MeasuredFrames;
+    TMap<FString, double> Measured;
+    FString Csv = TEXT("Helicopters,Phase,TotalUs,Calls,UsPerHeliFrame\n");
+    for (int32 p = 0; p < FPACS_HeliPhaseTimings::NumPhases; ++p)
+    {
+        const EPACS_HeliPhase Phase = (EPACS_HeliPhase)p;
+        const double TotalUs = FPACS_HeliPhaseTimings::GetMicroseconds(Phase);
+        const FString Name = FPACS_HeliPhaseTimings::GetPhaseName(Phase);
+        Measured.Add(Name, TotalUs / HeliFrames);
+        Csv += FString::Printf(TEXT("%d,%s,%.1f,%llu,%.3f\n"), N, *Name, TotalUs, FPACS_HeliPhaseTimings::Calls[p], TotalUs / HeliFrames);
+    }
+    const double FrameUs = (T1 - T0) * 1e6;
+    Measured.Add(TEXT("Frame"), FrameUs / HeliFrames);
+    Csv += FString::Printf(TEXT("%d,Frame,%.1f,%d,%.3f\n"), N, FrameUs, MeasuredFrames, FrameUs / HeliFrames);
+
+    const FString CsvPath = FPaths::Combine(FPaths::AutomationDir(), TEXT("PACS"), FString::Printf(TEXT("HeliScalability_%d.csv"), N));
+    if (FFileHelper::SaveStringToFile(Csv, *CsvPath))
+    {
+        AddInfo(FString::Printf(TEXT("Wrote %s"), *CsvPath));
+    }
+    AddInfo(Csv);
+
+    TestTrue(TEXT("StepKinematics ran for every helicopter"),
+        FPACS_HeliPhaseTimings::Calls[(int32)EPACS_HeliPhase::StepKinematics] >= uint64(Spawned) * MeasuredFrames);
+
+    // Baseline: "Helicopters,Phase,MaxUsPerHeliFrame"; '#' lines are comments
+    TArray<FString> Lines;
+    FFileHelper::LoadFileToStringArray(Lines, *BaselinePath());
+
+    if (FParse::Param(FCommandLine::Get(), TEXT("PACSUpdateHeliBaseline")))
+    {
+        const FString Prefix = FString::Printf(TEXT("%d,"), N);
+        Lines.RemoveAll([&Prefix](const FString& L) { return L.StartsWith(Prefix); });
+        if (Lines.Num() == 0) Lines.Add(TEXT("Helicopters,Phase,MaxUsPerHeliFrame"));
+        for (const TPair<FString, double>& It : Measured)
+        {
+            Lines.Add(FString::Printf(TEXT("%d,%s,%.2f"), N, *It.Key, It.Value));
+        }
+        FFileHelper::SaveStringArrayToFile(Lines, *BaselinePath());
+        AddInfo(FString::Printf(TEXT("Baseline updated for %d helicopters"), N));
+        return true;
+    }
+
+    int32 Compared = 0;
+    for (const FString& Line : Lines)
+    {
+        TArray<FString> Cols;
+        if (Line.StartsWith(TEXT("#")) || Line.ParseIntoArray(Cols, TEXT(",")) != 3 || FCString::Atoi(*Cols[0]) != N) continue;
+
+        const double* Value = Measured.Find(Cols[1]);
+        if (!Value) continue;
+
+        const double Budget = FCString::Atod(*Cols[2]);
+        ++Compared;
+        if (*Value > Budget * (1.0 + RegressionTolerance))
+        {
+            AddError(FString::Printf(TEXT("%s regressed at %d helicopters: %.3f us/heli/frame vs baseline %.3f"), *Cols[1], N, *Value, Budget));
+        }
+    }
+    TestTrue(TEXT("Baseline has entries for this count"), Compared > 0);
+    return true;
+}
@@ -0,0 +1,112 @@
+#include "Tests/PACS_Heli_ServerClockSpec.h"
+#include "Tests/PACS_Heli_TestHelpers.h"
+#include "Actors/Pawn/PACS_CandidateHelicopterCharacter.h"
+#include "Components/PACS_HeliMovementComponent.h"
+#include "Subsystems/PACS_ServerClockSubsystem.h"
+#include "Math/RandomStream.h"
+#include "Engine/World.h"
+
+bool FPACS_Heli_ServerClockSpec::RunTest(const FString& Parameters)
+{
+    FPACS_ServerClockParams Params;
+    Params.bSmooth = true;
+    Params.SlewRate = 0.05f;
+    Params.SnapThresholdS = 0.5f;
+
+    const double Dt = 1.0 / 60.0;
+    const double Omega = 2222.22 / 30000.0;   // default speed on a 300 m orbit, rad/s
+
+    // Client estimate = local time + offset; a new sample every 0.5 s moves the offset by up to +-60 ms
+    FRandomStream Rng(1234);
+    FPACS_SmoothedServerClock Clock;
+    double Offset = 0.1;
+    double Local = 10.0;
+    double PrevRaw = Local + Offset;
+    double PrevSmoothed = Clock.Update(PrevRaw, Local, Params);
+    const double Start = PrevSmoothed;
+
+    double MaxRawStepError = 0.0, MaxAngleStepError = 0.0;
+    bool bMonotonic = true, bStepsBounded = true;
+
+    for (int32 i = 1; i <= 20 * 60; ++i)
+    {
+        Local += Dt;
+        if (i % 30 == 0)
+        {
+            Offset = 0.1 + Rng.FRandRange(-0.06f, 0.06f);
+        }
+        const double Raw = Local + Offset;
+        const double Smoothed = Clock.Update(Raw, Local, Params);
+
+        const double Step = Smoothed - PrevSmoothed;
+        bMonotonic &= Step > 0.0;
+        bStepsBounded &= FMath::Abs(Step - Dt) <= Params.SlewRate * Dt + 1e-9;
+
+        MaxRawStepError = FMath::Max(MaxRawStepError, FMath::Abs((Raw - PrevRaw) - Dt));
+        MaxAngleStepError = FMath::Max(MaxAngleStepError, FMath::Abs(Omega * Step - Omega * Dt));
+
+        PrevRaw = Raw;
+        PrevSmoothed = Smoothed;
+    }
+
+    AddInfo(FString::Printf(TEXT("Raw step error up to %.1f ms, smoothed angle step error up to %.4f mrad (nominal %.4f mrad)"),
+        MaxRawStepError * 1000.0, MaxAngleStepError * 1000.0, Omega * Dt * 1000.0));
+    TestTrue(TEXT("Raw samples are jittery"), MaxRawStepError > 0.02);
+    TestTrue(TEXT("Smoothed clock strictly increasing"), bMonotonic);
+    TestTrue(TEXT("Smoothed steps within the slew rate"), bStepsBounded);
+    TestTrue(TEXT("Angle progression smooth"), MaxAngleStepError <= Omega * Dt * Params.SlewRate + 1e-9);
+    TestTrue(TEXT("Angle progressed"), Omega * (PrevSmoothed - Start) > Omega * 19.0);
+    TestEqual(TEXT("No snaps under jitter"), Clock.GetSnapCount(), 0);
+
+    // Drift correction: a steady 200 ms offset is slewed out (0.05 s/s -> 4 s), not jumped
+    Offset += 0.2;
+    for (int32 i = 0; i < 6 * 60; ++i)
+    {
+        Local += Dt;
+        Clock.Update(Local + Offset, Local, Params);
+    }
+    TestTrue(TEXT("Drift corrected"), FMath::Abs(Clock.GetErrorS()) < 1e-3);
+    TestEqual(TEXT("Drift slewed, not snapped"), Clock.GetSnapCount(), 0);
+
+    // Large discontinuity: taken immediately
+    Offset += 2.0;
+    Local += Dt;
+    const double AfterSnap = Clock.Update(Local + Offset, Local, Params);
+    TestEqual(TEXT("Large error snapped"), Clock.GetSnapCount(), 1);
+    TestTrue(TEXT("Snap lands on raw"), FMath::IsNearlyEqual(AfterSnap, Local + Offset, 1e-9));
+
+    // Disabled: raw passthrough
+    Params.bSmooth = false;
+    Local += Dt;
+    TestTrue(TEXT("Passthrough when disabled"), FMath::IsNearlyEqual(Clock.Update(Local + 5.0, Local, Params), Local + 5.0, 1e-9));
+
+    // World level: every helicopter reads the same cached value
+    UWorld* World = GWorld;
+    TestNotNull(TEXT("World available"), World);
+    if (!World) return false;
+
+    UPACS_ServerClockSubsystem* Subsystem = World->GetSubsystem<UPACS_ServerClockSubsystem>();
+    TestNotNull(TEXT("Server clock subsystem"), Subsystem);
+    if (!Subsystem) return false;
+
+    auto* A = PACSHeliTest::SpawnCandidate(World, FVector(0, 0, 0));
+    auto* B = PACSHeliTest::SpawnCandidate(World, FVector(100000, 0, 0));
+    TestNotNull(TEXT("Spawned A"), A);
+    TestNotNull(TEXT("Spawned B"), B);
+    if (!A || !B) return false;
+
+    PACSHeliTest::PumpWorld(World, 0.5f);
+
+    auto* CA = Cast<UPACS_HeliMovementComponent>(A->GetCharacterMovement());
+    auto* CB = Cast<UPACS_HeliMovementComponent>(B->GetCharacterMovement());
+    if (CA && CB)
+    {
+        TestEqual(TEXT("Helicopters share the frame clock"), CA->ServerNowS, CB->ServerNowS);
+        TestEqual(TEXT("Clock matches subsystem"), CA->ServerNowS, (float)Subsystem->GetServerNowS());
+    }
+    TestEqual(TEXT("Cached within a frame"), Subsystem->GetServerNowS(), Subsystem->GetServerNowS());
+
+    A->Destroy();
+    B->Destroy();
+    return true;
+}
@@ -0,0 +1,135 @@
+#include "Tests/PACS_Heli_SignificanceViewSpec.h"
+#include "Actors/Pawn/PACS_CandidateHelicopterCharacter.h"
+#include "Components/PACS_HeliMovementComponent.h"
+#include "Data/PACS_SignificanceViewpoints.h"
+
+namespace
+{
+    float Score(const FVector& Location, TArrayView<const FTransform> Views)
+    {
+        float Best = 0.f;
+        for (const FTransform& View : Views)
+        {
+            Best = FMath::Max(Best, FPACS_SignificanceViewpoints::DistanceSignificance(Location, View));
+        }
+        return Best;
+    }
+
+    // Head at the helicopter, facing along the orbit and pitched down toward the ground
+    FTransform HMDPoseAt(const FPACS_OrbitTargets& Targets, float Angle, float PitchDeg)
+    {
+        const FVector Head = UPACS_HeliMovementComponent::OrbitPositionAt(Targets.CenterCm, Targets.RadiusCm, Angle, Targets.AltitudeCm);
+        FRotator Rot = UPACS_HeliMovementComponent::OrbitTangentAt(Angle).ToOrientationRotator();
+        Rot.Pitch = PitchDeg;
+        return FTransform(Rot, Head);
+    }
+
+    FVector GroundOnOrbit(const FPACS_OrbitTargets& Targets, float Angle, float RadiusScale = 1.f)
+    {
+        return UPACS_HeliMovementComponent::OrbitPositionAt(Targets.CenterCm, Targets.RadiusCm * RadiusScale, Angle, Targets.CenterCm.Z);
+    }
+}
+
+bool FPACS_Heli_SignificanceViewSpec::RunTest(const FString& Parameters)
+{
+    // Scripted orbit: 300 m radius, 300 m up, default speed
+    FPACS_OrbitTargets Targets;
+    Targets.CenterCm = FVector::ZeroVector;
+    Targets.RadiusCm = 30000.f;
+    Targets.AltitudeCm = 30000.f;
+    Targets.SpeedCms = 2222.22f;
+
+    FPACS_HeliViewParams Params;
+    Params.LookAheadS = 10.f;
+    Params.LookAheadSamples = 4;
+    Params.ArcWeight = 2.f;
+
+    const float Omega = Targets.SpeedCms / Targets.RadiusCm;
+    const float PitchDeg = -35.f;
+    TArray<FTransform> Views;
+
+    // 1) Over a full orbit, ground just ahead on the arc outranks the mirror point behind
+    //    (equidistant from the head, so an HMD-only view cannot tell them apart)
+    const float Offset = 0.3f;
+    int32 Steps = 0, AheadWins = 0, AheadOverOutside = 0;
+    float MaxHMDOnlyGap = 0.f;
+    for (float Angle = 0.f; Angle < 2.f * PI; Angle += Omega * 0.25f, ++Steps)
+    {
+        const FTransform HMD = HMDPoseAt(Targets, Angle, PitchDeg);
+        Views.Reset();
+        FPACS_SignificanceViewpoints::BuildHeliViewpoints(HMD, Targets, Angle, Params, Views);
+
+        const FVector Ahead = GroundOnOrbit(Targets, Angle + Offset);
+        const FVector Behind = GroundOnOrbit(Targets, Angle - Offset);
+        const FVector Outside = GroundOnOrbit(Targets, Angle + Offset, 2.f);
+
+        AheadWins += Score(Ahead, Views) > Score(Behind, Views) ? 1 : 0;
+        AheadOverOutside += Score(Ahead, Views) > Score(Outside, Views) ? 1 : 0;
+        MaxHMDOnlyGap = FMath::Max(MaxHMDOnlyGap, FMath::Abs(Score(Ahead, MakeArrayView(&HMD, 1)) - Score(Behind, MakeArrayView(&HMD, 1))));
+    }
+    AddInfo(FString::Printf(TEXT("%d steps: ahead > behind %d, ahead > outside %d (HMD-only max gap %.6f)"),
+        Steps, AheadWins, AheadOverOutside, MaxHMDOnlyGap));
+    TestEqual(TEXT("Ahead on the arc outranks behind at every step"), AheadWins, Steps);
+    TestEqual(TEXT("Ahead on the arc outranks off-orbit ground at every step"), AheadOverOutside, Steps);
+    TestTrue(TEXT("HMD-only view ties ahead and behind"), MaxHMDOnlyGap < 1e-4f);
+
+    // 2) A fixed ring of ground objects under the orbit: the top-ranked one is always on the arc the
+    //    helicopter is about to fly (never behind it), within the look-ahead window
+    constexpr int32 RingCount = 72;
+    const float Spacing = 2.f * PI / RingCount;
+    TArray<FVector> Ring;
+    for (int32 i = 0; i < RingCount; ++i)
+    {
+        Ring.Add(GroundOnOrbit(Targets, i * Spacing));
+    }
+
+    auto Rank = [&Ring, &Views]()
+    {
+        TArray<int32> Order;
+        for (int32 i = 0; i < Ring.Num(); ++i)
+        {
+            Order.Add(i);
+        }
+        Order.Sort([&Ring, &Views](int32 A, int32 B) { return Score(Ring[A], Views) > Score(Ring[B], Views); });
+        return Order;
+    };
+
+    const float Window = Omega * Params.LookAheadS + Spacing * 0.5f;
+    int32 TopOutsideWindow = 0;
+    for (float Angle = 0.f; Angle < 2.f * PI; Angle += Omega * 0.25f)
+    {
+        Views.Reset();
+        FPACS_SignificanceViewpoints::BuildHeliViewpoints(HMDPoseAt(Targets, Angle, PitchDeg), Targets, Angle, Params, Views);
+        const int32 Top = Rank()[0];
+        const float Ahead = FMath::Fmod(Top * Spacing - Angle + 4.f * PI, 2.f * PI);
+        TopOutsideWindow += (Ahead > 0.f && Ahead <= Window) ? 0 : 1;
+    }
+    TestEqual(TEXT("Top-ranked ground object is always on the upcoming arc"), TopOutsideWindow, 0);
+
+    // 3) Same pose relative to the ring gives the same ranking relative to the helicopter
+    TArray<int32> Reference;
+    int32 Mismatches = 0;
+    for (int32 k = 0; k < RingCount; k += 6)
+    {
+        const float Angle = k * Spacing;
+        Views.Reset();
+        FPACS_SignificanceViewpoints::BuildHeliViewpoints(HMDPoseAt(Targets, Angle, PitchDeg), Targets, Angle, Params, Views);
+        const TArray<int32> Order = Rank();
+
+        TArray<int32> Relative;
+        for (int32 i = 0; i < 10; ++i)
+        {
+            Relative.Add((Order[i] - k + RingCount) % RingCount);
+        }
+        if (Reference.Num() == 0)
+        {
+            Reference = Relative;
+        }
+        Mismatches += (Relative == Reference) ? 0 : 1;
+    }
+    AddInfo(FString::Printf(TEXT("Top 10 relative ring slots: %s"),
+        *FString::JoinBy(Reference, TEXT(","), [](int32 Slot) { return FString::FromInt(Slot); })));
+    TestEqual(TEXT("Top 10 ranking is the same at every ring slot"), Mismatches, 0);
+
+    return true;
+}
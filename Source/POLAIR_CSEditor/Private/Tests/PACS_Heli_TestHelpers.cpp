@@ -33,6 +33,7 @@ AActor* PACSHeliTest::SpawnBlockingBox(UWorld* World, const FVector& Location, c
     UBoxComponent* Box = NewObject<UBoxComponent>(A);
     A->SetRootComponent(Box);
     Box->RegisterComponent();
+    Box->SetWorldLocation(Location);
     Box->SetBoxExtent(Extent);
     Box->SetCollisionProfileName(TEXT("BlockAll"));
     A->SetActorLabel(Name.ToString());
@@ -0,0 +1,106 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Components/PACS_HoverProbeComponent.h"
+#include "Components/PACS_SelectionPlaneComponent.h"
+#include "Core/PACS_HoverScreenBucket.h"
+#include "UObject/Package.h"
+
+namespace PACSHoverTest
+{
+    // Scripted cursor path at 30Hz: 60 samples idle, 60 across empty space, 60 across two selectables
+    void BuildCursorPath(TArray<FVector2D>& OutPath)
+    {
+        for (int32 i = 0; i < 60; ++i) OutPath.Add(FVector2D(100.f, 100.f));
+        for (int32 i = 0; i < 60; ++i) OutPath.Add(FVector2D(100.f + i * 5.f, 100.f));
+        for (int32 i = 0; i < 60; ++i) OutPath.Add(FVector2D(450.f + i * 5.f, 100.f));
+    }
+
+    // A (near) spans x 500-700, B (far) spans x 600-800; the overlap belongs to A
+    void FillBucket(UPACS_HoverProbeComponent* Probe, UPACS_SelectionPlaneComponent* A, UPACS_SelectionPlaneComponent* B)
+    {
+        FPACS_HoverScreenBucket& Bucket = Probe->GetScreenBucket();
+        Bucket.Reset(GFrameCounter);
+        Bucket.Add(FBox2D(FVector2D(500.f, 50.f), FVector2D(700.f, 150.f)), 1000.f, A);
+        Bucket.Add(FBox2D(FVector2D(600.f, 50.f), FVector2D(800.f, 150.f)), 2000.f, B);
+    }
+
+    // Runs the path with a fixed camera and returns the number of cursor traces issued
+    int32 RunPath(UPACS_HoverProbeComponent* Probe, const TArray<FVector2D>& Path, TArray<UPACS_SelectionPlaneComponent*>* OutHovered = nullptr)
+    {
+        Probe->ResetProbeCounters();
+        for (int32 i = 0; i < Path.Num(); ++i)
+        {
+            Probe->ProbeAtScreenPosition(Path[i], FVector(0, 0, 5000.f), FRotator(-60.f, 0, 0), i / 30.0);
+            if (OutHovered)
+            {
+                OutHovered->Add(Probe->GetCurrentHoverPlane());
+            }
+        }
+        return Probe->GetTraceCount();
+    }
+}
+
+// ------- Spec: traces issued over a scripted cursor path -------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_HoverCacheSpec,
+    "PACS.Selection.Hover.TraceCount",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPACS_HoverCacheSpec::RunTest(const FString& Parameters)
+{
+    UPACS_SelectionPlaneComponent* PlaneA = NewObject<UPACS_SelectionPlaneComponent>(GetTransientPackage());
+    UPACS_SelectionPlaneComponent* PlaneB = NewObject<UPACS_SelectionPlaneComponent>(GetTransientPackage());
+
+    TArray<FVector2D> Path;
+    PACSHoverTest::BuildCursorPath(Path);
+
+    // Legacy: object query + SelectionTrace fallback on every probe
+    {
+        UPACS_HoverProbeComponent* Probe = NewObject<UPACS_HoverProbeComponent>(GetTransientPackage());
+        Probe->HoverObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_GameTraceChannel2));
+        Probe->bUseHoverCache = false;
+
+        const int32 Traces = PACSHoverTest::RunPath(Probe, Path);
+        TestEqual(TEXT("Legacy traces every probe"), Traces, Path.Num() * 2);
+    }
+
+    // Cached with visibility confirmation: a trace per new candidate under the cursor. Without a
+    // viewport every confirmation misses, so the candidates count as occluded and are re-confirmed
+    // once per probe interval (10 Hz here) instead of being cached until the candidate changes
+    {
+        UPACS_HoverProbeComponent* Probe = NewObject<UPACS_HoverProbeComponent>(GetTransientPackage());
+        Probe->HoverObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_GameTraceChannel2));
+        Probe->bConfirmVisibility = true;
+        Probe->RateHz = 10.0f;
+        PACSHoverTest::FillBucket(Probe, PlaneA, PlaneB);
+
+        // Samples 130-179 (x 500-745) have a candidate: 50 probes at 30 Hz, 2 candidate changes
+        const int32 Traces = PACSHoverTest::RunPath(Probe, Path);
+        AddInfo(FString::Printf(TEXT("Occluded candidates: %d traces over 50 candidate probes"), Traces));
+        TestTrue(TEXT("Occluded candidate re-confirmed"), Traces > 2);
+        TestTrue(TEXT("Re-confirmation bounded by the probe interval"), Traces <= 2 + 50 / 3 + 2);
+        TestTrue(FString::Printf(TEXT("Idle probes skipped (%d)"), Probe->GetSkippedProbeCount()),
+            Probe->GetSkippedProbeCount() >= 40);
+    }
+
+    // Cached without confirmation: bucket resolves hovers with no traces at all
+    {
+        UPACS_HoverProbeComponent* Probe = NewObject<UPACS_HoverProbeComponent>(GetTransientPackage());
+        Probe->bConfirmVisibility = false;
+        PACSHoverTest::FillBucket(Probe, PlaneA, PlaneB);
+
+        TArray<UPACS_SelectionPlaneComponent*> Hovered;
+        const int32 Traces = PACSHoverTest::RunPath(Probe, Path, &Hovered);
+        TestEqual(TEXT("No traces when bucket resolves hover"), Traces, 0);
+
+        // Sample 120 + k sits at x = 450 + 5k
+        TestNull(TEXT("Empty space not hovered"), Hovered[100]);
+        TestTrue(TEXT("x=550 hovers A"), Hovered[120 + 20] == PlaneA);
+        TestTrue(TEXT("x=650 overlap hovers nearer A"), Hovered[120 + 40] == PlaneA);
+        TestTrue(TEXT("x=740 hovers B"), Hovered[120 + 58] == PlaneB);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
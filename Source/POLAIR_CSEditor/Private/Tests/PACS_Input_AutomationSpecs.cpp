@@ -6,6 +6,17 @@
 
 #include "Data/Configs/PACS_InputMappingConfig.h"
 #include "Data/PACS_InputTypes.h" // EPACS_* types, FPACS_InputReceiverEntry, PACS_InputLimits, etc.
+#include "Data/PACS_InputActionIds.h"
+#include "Components/PACS_InputHandlerComponent.h"
+#include "PACS_TestReceiver.h"
+#include "PACS_TestInputHandler.h"
+#include "Tests/PACS_Heli_TestHelpers.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
 
 // ------- Spec 1: Config validity & identifier lookup -------
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_InputConfigValiditySpec,
@@ -76,4 +87,430 @@ bool FPACS_ReceiverOrderingSpec::RunTest(const FString& Parameters)
     return true;
 }
 
+// ------- Spec 3: Per-action dispatch (20 receivers, 40 actions) -------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_InputDispatchBenchmarkSpec,
+    "PACS.Input.Receivers.DispatchBenchmark",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPACS_InputDispatchBenchmarkSpec::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumReceivers = 20;
+    constexpr int32 NumActions = 40;
+    constexpr int32 Iterations = 2000;
+
+    TArray<FName> Actions;
+    for (int32 i = 0; i < NumActions; ++i)
+    {
+        Actions.Add(FName(*FString::Printf(TEXT("Bench.Action%02d"), i)));
+    }
+
+    // Same receivers twice: subscribed to two actions each, and subscribed to everything (the old routing)
+    UPACS_InputHandlerComponent* Subscribed = NewObject<UPACS_InputHandlerComponent>(GetTransientPackage());
+    UPACS_InputHandlerComponent* Wildcard   = NewObject<UPACS_InputHandlerComponent>(GetTransientPackage());
+    TArray<UPACS_TestReceiver*> SubscribedReceivers, WildcardReceivers;
+
+    for (int32 r = 0; r < NumReceivers; ++r)
+    {
+        const int32 Priority = PACS_InputPriority::Gameplay + (r % 3) * 100;
+
+        UPACS_TestReceiver* S = NewObject<UPACS_TestReceiver>(GetTransientPackage());
+        S->Subscriptions = { Actions[2 * r], Actions[2 * r + 1] };
+        Subscribed->RegisterReceiver(S, Priority);
+        SubscribedReceivers.Add(S);
+
+        UPACS_TestReceiver* W = NewObject<UPACS_TestReceiver>(GetTransientPackage());
+        Wildcard->RegisterReceiver(W, Priority);
+        WildcardReceivers.Add(W);
+    }
+
+    TestEqual(TEXT("One subscriber per action"), Subscribed->GetDispatchReceiverCount(Actions[7]), 1);
+    TestEqual(TEXT("Wildcard receivers see every action"), Wildcard->GetDispatchReceiverCount(Actions[7]), NumReceivers);
+    TestEqual(TEXT("Unsubscribed action reaches nobody"), Subscribed->GetDispatchReceiverCount(TEXT("Bench.Unknown")), 0);
+
+    const FInputActionValue Value(1.0f);
+    auto RunBench = [&](UPACS_InputHandlerComponent* Handler)
+    {
+        const double Start = FPlatformTime::Seconds();
+        for (int32 It = 0; It < Iterations; ++It)
+        {
+            for (const FName& Action : Actions)
+            {
+                Handler->DispatchAction(Action, Value);
+            }
+        }
+        return FPlatformTime::Seconds() - Start;
+    };
+
+    const double SubscribedS = RunBench(Subscribed);
+    const double WildcardS = RunBench(Wildcard);
+
+    int32 SubscribedCalls = 0, WildcardCalls = 0;
+    for (const UPACS_TestReceiver* R : SubscribedReceivers) SubscribedCalls += R->CallCount;
+    for (const UPACS_TestReceiver* R : WildcardReceivers) WildcardCalls += R->CallCount;
+
+    const double Routes = double(Iterations) * NumActions;
+    AddInfo(FString::Printf(TEXT("%d receivers, %d actions: subscribed %.3f us/route (%d calls), wildcard %.3f us/route (%d calls)"),
+        NumReceivers, NumActions, SubscribedS * 1e6 / Routes, SubscribedCalls, WildcardS * 1e6 / Routes, WildcardCalls));
+
+    TestEqual(TEXT("Each route reaches only its subscriber"), SubscribedCalls, Iterations * NumActions);
+    TestEqual(TEXT("Wildcard routes reach every receiver"), WildcardCalls, Iterations * NumActions * NumReceivers);
+    TestEqual(TEXT("Subscriber saw its own action"), SubscribedReceivers[3]->LastAction, Actions[7]);
+
+    // A wildcard receiver above everyone is merged into every list in priority order and consumes first
+    UPACS_TestReceiver* Overlay = NewObject<UPACS_TestReceiver>(GetTransientPackage());
+    Overlay->Response = EPACS_InputHandleResult::HandledConsume;
+    Subscribed->RegisterReceiver(Overlay, PACS_InputPriority::UI);
+    TestEqual(TEXT("Wildcard merged into subscribed list"), Subscribed->GetDispatchReceiverCount(Actions[7]), 2);
+
+    const int32 CallsBefore = SubscribedReceivers[3]->CallCount;
+    TestEqual(TEXT("Higher priority wildcard consumes"), Subscribed->DispatchAction(Actions[7], Value), EPACS_InputHandleResult::HandledConsume);
+    TestEqual(TEXT("Subscriber behind consumer not called"), SubscribedReceivers[3]->CallCount, CallsBefore);
+
+    Subscribed->UnregisterReceiver(Overlay);
+    TestEqual(TEXT("Table rebuilt on unregister"), Subscribed->GetDispatchReceiverCount(Actions[7]), 1);
+
+    return true;
+}
+
+// ------- Spec 4: Action IDs are stable and route like their names -------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_InputActionIdSpec,
+    "PACS.Input.ActionIds.StableAssignment",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPACS_InputActionIdSpec::RunTest(const FString& Parameters)
+{
+    // Natives are registered at static init, in list order
+    TestNotEqual(TEXT("Native ID assigned"), (int32)PACS_InputActions::VRSeat_Center, (int32)FPACS_InputActionRegistry::InvalidId);
+    TestEqual(TEXT("Native IDs are dense"), PACS_InputActions::Deselect - PACS_InputActions::VRSeat_Center, 17);
+    TestEqual(TEXT("Config name resolves to the native ID"), FPACS_InputActionRegistry::FindOrAdd(TEXT("RightClick")), PACS_InputActions::RightClick.GetId());
+    TestEqual(TEXT("ID round-trips to its name"), FPACS_InputActionRegistry::GetName(PACS_InputActions::Cam2_ZoomToggle), FName(TEXT("Cam2.ZoomToggle")));
+    TestEqual(TEXT("None has no ID"), FPACS_InputActionRegistry::FindOrAdd(NAME_None), FPACS_InputActionRegistry::InvalidId);
+
+    // Two configs listing the same identifiers in opposite order resolve to the same IDs
+    UInputAction* IA_A = NewObject<UInputAction>(GetTransientPackage());
+    UInputAction* IA_B = NewObject<UInputAction>(GetTransientPackage());
+    FPACS_InputActionMapping MapA; MapA.InputAction = IA_A; MapA.ActionIdentifier = TEXT("IdTest.A");
+    FPACS_InputActionMapping MapB; MapB.InputAction = IA_B; MapB.ActionIdentifier = TEXT("IdTest.B");
+
+    UPACS_InputMappingConfig* ConfigAB = NewObject<UPACS_InputMappingConfig>(GetTransientPackage());
+    ConfigAB->ActionMappings = { MapA, MapB };
+    UPACS_InputMappingConfig* ConfigBA = NewObject<UPACS_InputMappingConfig>(GetTransientPackage());
+    ConfigBA->ActionMappings = { MapB, MapA };
+
+    UPACS_InputHandlerComponent* HandlerAB = NewObject<UPACS_InputHandlerComponent>(GetTransientPackage());
+    HandlerAB->InputConfig = ConfigAB;
+    UPACS_InputHandlerComponent* HandlerBA = NewObject<UPACS_InputHandlerComponent>(GetTransientPackage());
+    HandlerBA->InputConfig = ConfigBA;
+
+    const uint16 IdA = HandlerAB->ResolveActionId(IA_A);
+    const uint16 IdB = HandlerAB->ResolveActionId(IA_B);
+    TestNotEqual(TEXT("Config action resolved"), (int32)IdA, (int32)FPACS_InputActionRegistry::InvalidId);
+    TestNotEqual(TEXT("Distinct identifiers, distinct IDs"), IdA, IdB);
+    TestEqual(TEXT("Same ID regardless of config order (A)"), HandlerBA->ResolveActionId(IA_A), IdA);
+    TestEqual(TEXT("Same ID regardless of config order (B)"), HandlerBA->ResolveActionId(IA_B), IdB);
+    TestEqual(TEXT("Unconfigured action has no ID"), HandlerAB->ResolveActionId(NewObject<UInputAction>(GetTransientPackage())), FPACS_InputActionRegistry::InvalidId);
+
+    // Routing by ID and by name reach the same receiver with the same ID
+    UPACS_TestReceiver* Receiver = NewObject<UPACS_TestReceiver>(GetTransientPackage());
+    Receiver->Subscriptions = { TEXT("IdTest.B") };
+    Receiver->Response = EPACS_InputHandleResult::HandledConsume;
+    HandlerAB->RegisterReceiver(Receiver, PACS_InputPriority::Gameplay);
+
+    const FInputActionValue Value(1.0f);
+    TestEqual(TEXT("Dispatch by name"), HandlerAB->DispatchAction(TEXT("IdTest.B"), Value), EPACS_InputHandleResult::HandledConsume);
+    TestEqual(TEXT("Receiver saw the ID"), Receiver->LastActionId, (int32)IdB);
+    TestEqual(TEXT("Dispatch by ID"), HandlerAB->DispatchActionId(IdB, Value), EPACS_InputHandleResult::HandledConsume);
+    TestEqual(TEXT("Receiver saw the name"), Receiver->LastAction, FName(TEXT("IdTest.B")));
+    TestEqual(TEXT("Both routes delivered"), Receiver->CallCount, 2);
+
+    TestEqual(TEXT("Other ID not delivered"), HandlerAB->DispatchActionId(IdA, Value), EPACS_InputHandleResult::NotHandled);
+    const uint16 PastTable = (uint16)(FPACS_InputActionRegistry::GetTableSize() + 5);
+    TestEqual(TEXT("Unknown ID reaches wildcards only"), HandlerAB->DispatchActionId(PastTable, Value), EPACS_InputHandleResult::NotHandled);
+    TestEqual(TEXT("Subscriber not called for others"), Receiver->CallCount, 2);
+
+    return true;
+}
+
+// ------- Spec 5: Hot-path log sampling (1000-action replay) -------
+namespace
+{
+    // Counts lines that were actually formatted and emitted for one category
+    struct FPACS_LogLineCounter : public FOutputDevice
+    {
+        FName Category;
+        int32 Lines = 0;
+
+        explicit FPACS_LogLineCounter(FName InCategory) : Category(InCategory) {}
+
+        virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& InCategory) override
+        {
+            if (InCategory == Category)
+            {
+                ++Lines;
+            }
+        }
+
+        virtual bool CanBeUsedOnMultipleThreads() const override { return true; }
+    };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_InputHotLogSpec,
+    "PACS.Input.Logging.HotPathSampling",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPACS_InputHotLogSpec::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumActions = 1000;
+
+    IConsoleVariable* HotCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("pacs.Log.Hot"));
+    if (!TestNotNull(TEXT("pacs.Log.Hot registered"), HotCVar))
+    {
+        return false;
+    }
+    const int32 SavedRate = HotCVar->GetInt();
+
+    UPACS_InputHandlerComponent* Handler = NewObject<UPACS_InputHandlerComponent>(GetTransientPackage());
+    UPACS_TestReceiver* Receiver = NewObject<UPACS_TestReceiver>(GetTransientPackage());
+    Receiver->Subscriptions = { TEXT("LogTest.Action") };
+    Receiver->Response = EPACS_InputHandleResult::HandledConsume;
+    Handler->RegisterReceiver(Receiver, PACS_InputPriority::Gameplay);
+
+    const FInputActionValue Value(1.0f);
+    auto Replay = [&](int32 Rate)
+    {
+        HotCVar->Set(Rate, ECVF_SetByCode);
+
+        FPACS_LogLineCounter Counter(LogPACSInput.GetCategoryName());
+        GLog->AddOutputDevice(&Counter);
+        for (int32 i = 0; i < NumActions; ++i)
+        {
+            Handler->DispatchAction(TEXT("LogTest.Action"), Value);
+        }
+        GLog->Flush();
+        GLog->RemoveOutputDevice(&Counter);
+        return Counter.Lines;
+    };
+
+    const int32 LinesOff = Replay(0);
+    const int32 LinesSampled = Replay(10);
+    const int32 LinesAll = Replay(1);
+    HotCVar->Set(SavedRate, ECVF_SetByCode);
+
+    AddInfo(FString::Printf(TEXT("%d routed actions: %d lines off, %d lines at 1/10, %d lines at 1/1"),
+        NumActions, LinesOff, LinesSampled, LinesAll));
+
+    TestEqual(TEXT("Every action routed"), Receiver->CallCount, 3 * NumActions);
+    TestEqual(TEXT("No lines formatted with hot logging off"), LinesOff, 0);
+
+    if (UE_LOG_ACTIVE(LogPACSInput, Log))
+    {
+        // One hot line per route in RouteActionInternal
+        TestEqual(TEXT("Every line at 1/1"), LinesAll, NumActions);
+        TestEqual(TEXT("One in ten at 1/10"), LinesSampled, NumActions / 10);
+    }
+    else
+    {
+        AddInfo(TEXT("LogPACSInput below Log in this build; only the off case is checked"));
+    }
+
+    return true;
+}
+
+// ------- Spec 6: Event-driven initialization (no retry timers) -------
+namespace
+{
+    // FTimerHandle packs a global serial number above a 24-bit index; a fresh handle's serial
+    // minus the previous one is the number of timers created in between, by anyone
+    uint64 ProbeTimerSerial(FTimerManager& TimerManager)
+    {
+        FTimerHandle Probe;
+        TimerManager.SetTimer(Probe, FTimerDelegate::CreateLambda([]() {}), 1.0f, false);
+        const uint64 Serial = FCString::Strtoui64(*Probe.ToString(), nullptr, 10) >> 24;
+        TimerManager.ClearTimer(Probe);
+        return Serial;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_InputEventDrivenInitSpec,
+    "PACS.Input.Handler.EventDrivenInit",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPACS_InputEventDrivenInitSpec::RunTest(const FString& Parameters)
+{
+    UWorld* World = GWorld;
+    if (!TestNotNull(TEXT("World"), World))
+    {
+        return false;
+    }
+
+    UPACS_InputMappingConfig* Config = NewObject<UPACS_InputMappingConfig>(GetTransientPackage());
+    Config->GameplayContext = NewObject<UInputMappingContext>(GetTransientPackage());
+    Config->MenuContext = NewObject<UInputMappingContext>(GetTransientPackage());
+    Config->UIContext = NewObject<UInputMappingContext>(GetTransientPackage());
+    FPACS_InputActionMapping MapMove;
+    MapMove.InputAction = NewObject<UInputAction>(GetTransientPackage());
+    MapMove.ActionIdentifier = TEXT("Move");
+    Config->ActionMappings = { MapMove };
+
+    APlayerController* PC = World->SpawnActor<APlayerController>(APlayerController::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator);
+    if (!TestNotNull(TEXT("PlayerController"), PC))
+    {
+        return false;
+    }
+    UPACS_TestInputHandler* Handler = NewObject<UPACS_TestInputHandler>(PC);
+    Handler->InputConfig = Config;
+    Handler->RegisterComponent();
+
+    int32 ReadyBroadcasts = 0;
+    uint64 ReadyFrame = 0;
+    Handler->OnInputReady.AddLambda([&ReadyBroadcasts, &ReadyFrame](UPACS_InputHandlerComponent*)
+    {
+        ++ReadyBroadcasts;
+        ReadyFrame = GFrameCounter;
+    });
+
+    FTimerManager& TimerManager = World->GetTimerManager();
+    const uint64 SerialBefore = ProbeTimerSerial(TimerManager);
+
+    // Events before the prerequisites are met do nothing and schedule nothing
+    Handler->NotifyLocalPlayerReady();
+    Handler->OnSubsystemAvailable();
+    TestFalse(TEXT("Not ready without a local player"), Handler->IsHealthy());
+
+    const uint64 SerialWaiting = ProbeTimerSerial(TimerManager);
+
+    // Readiness alone is not polled for: only an event initializes
+    Handler->bLocalPlayerReady = true;
+    PACSHeliTest::PumpWorld(World, 10.0f / 60.0f, 1.0f / 60.0f);
+    TestFalse(TEXT("No initialization without an event"), Handler->IsHealthy());
+    TestEqual(TEXT("No broadcast without an event"), ReadyBroadcasts, 0);
+
+    const uint64 SerialReady = ProbeTimerSerial(TimerManager);
+    const uint64 EventFrame = GFrameCounter;
+    Handler->NotifyLocalPlayerReady();
+    TestTrue(TEXT("Initialized inside the readiness event"), Handler->IsHealthy());
+    TestEqual(TEXT("OnInputReady fired once"), ReadyBroadcasts, 1);
+    TestEqual(TEXT("Initialized in the readiness frame"), ReadyFrame, EventFrame);
+
+    // Later events do not initialize again
+    Handler->NotifyLocalPlayerReady();
+    Handler->OnSubsystemAvailable();
+    TestEqual(TEXT("Still one broadcast"), ReadyBroadcasts, 1);
+
+    const uint64 SerialAfter = ProbeTimerSerial(TimerManager);
+    TestEqual(TEXT("No timers while waiting"), SerialWaiting - SerialBefore, uint64(1));
+    TestEqual(TEXT("No timers while initializing"), SerialAfter - SerialReady, uint64(1));
+
+    Handler->DestroyComponent();
+    PC->Destroy();
+    return true;
+}
+
+// ------- Spec 7: Overlay context diffing and end-of-frame batching (50 push/pop) -------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_InputOverlayBatchingSpec,
+    "PACS.Input.Handler.OverlayContextBatching",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPACS_InputOverlayBatchingSpec::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumOps = 50;
+
+    UPACS_InputMappingConfig* Config = NewObject<UPACS_InputMappingConfig>(GetTransientPackage());
+    Config->GameplayContext = NewObject<UInputMappingContext>(GetTransientPackage());
+    Config->MenuContext = NewObject<UInputMappingContext>(GetTransientPackage());
+    Config->UIContext = NewObject<UInputMappingContext>(GetTransientPackage());
+    FPACS_InputActionMapping MapMove;
+    MapMove.InputAction = NewObject<UInputAction>(GetTransientPackage());
+    MapMove.ActionIdentifier = TEXT("Move");
+    Config->ActionMappings = { MapMove };
+
+    TArray<UInputMappingContext*> Overlays;
+    for (int32 i = 0; i < 4; ++i)
+    {
+        Overlays.Add(NewObject<UInputMappingContext>(GetTransientPackage()));
+    }
+
+    UPACS_TestInputHandler* Handler = NewObject<UPACS_TestInputHandler>(GetTransientPackage());
+    Handler->InputConfig = Config;
+    Handler->bLocalPlayerReady = true;
+    Handler->NotifyLocalPlayerReady();
+    if (!TestTrue(TEXT("Handler initialized"), Handler->IsHealthy()))
+    {
+        return false;
+    }
+    TestEqual(TEXT("Base context applied at initialization"), Handler->GetContextRebuildRequests(), 1);
+
+    auto Reset = [Handler]()
+    {
+        Handler->ContextAdds = 0;
+        Handler->ContextRemoves = 0;
+        return Handler->GetContextRebuildRequests();
+    };
+
+    // One frame: 47 alternating push/pop of the same overlay, then two pushes and a pop
+    int32 Before = Reset();
+    for (int32 i = 0; i < NumOps - 3; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            Handler->PushOverlay(Overlays[0]);
+        }
+        else
+        {
+            Handler->PopOverlay();
+        }
+    }
+    Handler->PushOverlay(Overlays[1]);
+    Handler->PushOverlay(Overlays[2]);
+    Handler->PopOverlay();
+    TestEqual(TEXT("Nothing applied before end of frame"), Handler->GetContextRebuildRequests(), Before);
+
+    Handler->FlushContextChanges();
+    const int32 OneFrameRequests = Handler->GetContextRebuildRequests() - Before;
+    TestEqual(TEXT("One rebuild request for the frame"), OneFrameRequests, 1);
+    TestEqual(TEXT("Only the net overlays added"), Handler->ContextAdds, 2);
+    TestEqual(TEXT("Nothing removed"), Handler->ContextRemoves, 0);
+
+    Handler->FlushContextChanges();
+    TestEqual(TEXT("Flush with nothing pending is free"), Handler->GetContextRebuildRequests() - Before, 1);
+
+    // One operation per frame: each request carries just that overlay, never the base or the others
+    Before = Reset();
+    for (int32 i = 0; i < NumOps; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            Handler->PushOverlay(Overlays[3]);
+        }
+        else
+        {
+            Handler->PopOverlay();
+        }
+        Handler->FlushContextChanges();
+    }
+    const int32 PerFrameRequests = Handler->GetContextRebuildRequests() - Before;
+    TestEqual(TEXT("One request per frame with a change"), PerFrameRequests, NumOps);
+    TestEqual(TEXT("One add per push"), Handler->ContextAdds, NumOps / 2);
+    TestEqual(TEXT("One remove per pop"), Handler->ContextRemoves, NumOps / 2);
+    const int32 PerFrameCalls = Handler->ContextAdds + Handler->ContextRemoves;
+
+    // Same context back at another priority in one frame: re-added only
+    Before = Reset();
+    Handler->PopOverlay();
+    Handler->PushOverlay(Overlays[1], EPACS_OverlayType::Blocking, 1200);
+    Handler->FlushContextChanges();
+    TestEqual(TEXT("Priority change is one request"), Handler->GetContextRebuildRequests() - Before, 1);
+    TestEqual(TEXT("Priority change re-adds"), Handler->ContextAdds, 1);
+    TestEqual(TEXT("Priority change does not remove"), Handler->ContextRemoves, 0);
+
+    // Removing and re-adding base + two resident overlays on every operation, plus the toggled one
+    const int32 FullRebuildCalls = NumOps * (2 * 3 + 1);
+    AddInfo(FString::Printf(TEXT("%d ops in one frame: %d request(s); one op per frame: %d requests, %d subsystem calls (remove-all/re-add: %d)"),
+        NumOps, OneFrameRequests, PerFrameRequests, PerFrameCalls, FullRebuildCalls));
+
+    Handler->PopAllOverlays();
+    Handler->FlushContextChanges();
+    return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
@@ -0,0 +1,63 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Components/PACS_EdgeScrollComponent.h"
+#include "Tests/PACS_Heli_TestHelpers.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+// ------- Spec: no per-frame Slate queries while the cursor rests away from the edges -------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_EdgeScrollIdleSpec,
+    "PACS.Input.EdgeScroll.IdleQueries",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPACS_EdgeScrollIdleSpec::RunTest(const FString& Parameters)
+{
+    UWorld* World = GWorld;
+    if (!TestNotNull(TEXT("World"), World))
+    {
+        return false;
+    }
+
+    AActor* Owner = World->SpawnActor<AActor>(AActor::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator);
+    UPACS_EdgeScrollComponent* EdgeScroll = NewObject<UPACS_EdgeScrollComponent>(Owner);
+    EdgeScroll->RegisterComponent();
+    EdgeScroll->SetViewportMetrics(FVector2D(1920.f, 1080.f), 1.0f);
+
+    TestFalse(TEXT("Tick starts disabled"), EdgeScroll->IsComponentTickEnabled());
+
+    // Cursor at rest in the centre
+    EdgeScroll->ProcessCursor(FVector2D(960.f, 540.f));
+    TestFalse(TEXT("Centre keeps the tick off"), EdgeScroll->IsComponentTickEnabled());
+
+    EdgeScroll->ResetCounters();
+    PACSHeliTest::PumpWorld(World, 2.0f);
+    TestEqual(TEXT("No ticks at rest"), EdgeScroll->GetActiveTickCount(), 0);
+    TestEqual(TEXT("No Slate queries at rest"), EdgeScroll->GetSlateQueryCount(), 0);
+
+    // Cursor inside the margin wakes the tick, back in the centre puts it to sleep
+    EdgeScroll->ProcessCursor(FVector2D(2.f, 540.f));
+    TestTrue(TEXT("Edge enables the tick"), EdgeScroll->IsComponentTickEnabled());
+    EdgeScroll->ProcessCursor(FVector2D(960.f, 540.f));
+    TestFalse(TEXT("Leaving the edge disables the tick"), EdgeScroll->IsComponentTickEnabled());
+
+    // A mouse-move event re-enables it; the tick reads the cursor and goes back to sleep
+    EdgeScroll->NotifyCursorActivity();
+    TestTrue(TEXT("Mouse move enables the tick"), EdgeScroll->IsComponentTickEnabled());
+    PACSHeliTest::PumpWorld(World, 1.0f / 60.0f);
+    TestFalse(TEXT("Tick disabled again after one evaluation"), EdgeScroll->IsComponentTickEnabled());
+
+    const int32 QueriesAfterWake = EdgeScroll->GetSlateQueryCount();
+    const int32 TicksAfterWake = EdgeScroll->GetActiveTickCount();
+    PACSHeliTest::PumpWorld(World, 2.0f);
+    AddInfo(FString::Printf(TEXT("Wake: %d tick(s), %d query(ies); then %d over 120 idle frames"),
+        TicksAfterWake, QueriesAfterWake, EdgeScroll->GetSlateQueryCount() - QueriesAfterWake));
+    TestEqual(TEXT("No further ticks at rest"), EdgeScroll->GetActiveTickCount(), TicksAfterWake);
+    TestEqual(TEXT("No further Slate queries at rest"), EdgeScroll->GetSlateQueryCount(), QueriesAfterWake);
+
+    Owner->Destroy();
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,95 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Core/PACS_PlayerController.h"
+#include "Tests/PACS_Heli_TestHelpers.h"
+
+// ------- Spec: no marquee queries while idle, bounded queries while dragging -------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_MarqueeQuerySpec,
+    "PACS.Input.Marquee.InputDrivenQueries",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPACS_MarqueeQuerySpec::RunTest(const FString& Parameters)
+{
+    UWorld* World = GWorld;
+    if (!TestNotNull(TEXT("World"), World))
+    {
+        return false;
+    }
+
+    APACS_PlayerController* PC = World->SpawnActor<APACS_PlayerController>(APACS_PlayerController::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator);
+    if (!TestNotNull(TEXT("PlayerController"), PC))
+    {
+        return false;
+    }
+
+    constexpr float FrameS = 1.0f / 60.0f;
+    PC->MarqueeDragThreshold = 5.0f;
+    PC->MarqueeUpdateRate = 30.0f;
+    const float RateHz = PC->MarqueeUpdateRate;
+
+    // The controller's input entry points; the world tick runs the held-back query timer
+    FVector2D Cursor(400.f, 300.f);
+    auto RunFrames = [&](float Seconds, int32 MovesPerFrame, const FVector2D& Step)
+    {
+        const int32 Frames = FMath::RoundToInt(Seconds / FrameS);
+        for (int32 f = 0; f < Frames; ++f)
+        {
+            for (int32 m = 0; m < MovesPerFrame; ++m)
+            {
+                Cursor += Step;
+                PC->MoveMarquee(Cursor);
+            }
+            PACSHeliTest::PumpWorld(World, FrameS, FrameS);
+        }
+    };
+
+    // 5 s with the button up: stray moves are ignored
+    RunFrames(5.0f, 1, FVector2D(3.f, 1.f));
+    TestEqual(TEXT("Idle: no queries"), PC->GetMarqueeQueryCount(), 0);
+
+    // 5 s pressed with sub-threshold jitter: still a potential click
+    PC->BeginMarqueePress(Cursor);
+    const FVector2D Start = PC->GetMarqueeStartPos();
+    for (int32 i = 0; i < 300; ++i)
+    {
+        Cursor = Start + FVector2D((i % 2) ? 2.f : -2.f, 1.f);
+        PC->MoveMarquee(Cursor);
+        PACSHeliTest::PumpWorld(World, FrameS, FrameS);
+    }
+    TestFalse(TEXT("Pressed below threshold is not a drag"), PC->IsMarqueeActive());
+    TestEqual(TEXT("Pressed: no queries"), PC->GetMarqueeQueryCount(), 0);
+
+    // Scripted drag: 2 s of 120 Hz mouse moves
+    constexpr float DragS = 2.0f;
+    RunFrames(DragS, 2, FVector2D(2.f, 1.f));
+    const int32 DragQueries = PC->GetMarqueeQueryCount();
+    TestTrue(TEXT("Dragging"), PC->IsMarqueeActive());
+    TestTrue(TEXT("Drag queries bounded by the rate"), DragQueries <= FMath::CeilToInt(DragS * RateHz) + 1);
+    TestTrue(TEXT("Drag keeps the rect current"), DragQueries >= FMath::FloorToInt(DragS * RateHz / 2.0f));
+
+    // 5 s holding still mid-drag: at most the trailing query for the last held-back move
+    RunFrames(5.0f, 0, FVector2D::ZeroVector);
+    const int32 HoldQueries = PC->GetMarqueeQueryCount() - DragQueries;
+    TestTrue(TEXT("Motionless drag: at most the trailing query"), HoldQueries <= 1);
+
+    // Release: the final query ignores the rate; no PlayerState here, so nothing is selected
+    AddExpectedError(TEXT("no PlayerState"), EAutomationExpectedErrorFlags::Contains, 1);
+    const int32 BeforeRelease = PC->GetMarqueeQueryCount();
+    PC->ReleaseMarquee(Cursor + FVector2D(1.f, 0.f));
+    TestEqual(TEXT("Release runs the final query"), PC->GetMarqueeQueryCount(), BeforeRelease + 1);
+    TestFalse(TEXT("Released"), PC->IsMarqueeActive());
+
+    RunFrames(5.0f, 1, FVector2D(-3.f, 2.f));
+    TestEqual(TEXT("Idle after release: no queries"), PC->GetMarqueeQueryCount(), BeforeRelease + 1);
+
+    AddInfo(FString::Printf(TEXT("Drag %.0f s at 120 Hz moves: %d queries (cap %.0f Hz); motionless 5 s: %d; idle 10 s: 0"),
+        DragS, DragQueries, RateHz, HoldQueries));
+
+    PC->Destroy();
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,119 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Subsystems/PACS_GroupMoveSubsystem.h"
+#include "AIController.h"
+#include "GameFramework/Character.h"
+#include "NavigationSystem.h"
+#include "Engine/World.h"
+
+// ------- Spec 1: Formation slot layout -------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_GroupMoveFormationSpec,
+    "PACS.NPC.GroupMove.FormationOffsets",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPACS_GroupMoveFormationSpec::RunTest(const FString& Parameters)
+{
+    const float Spacing = 150.f;
+    const EPACS_FormationType Formations[] = { EPACS_FormationType::Grid, EPACS_FormationType::Wedge, EPACS_FormationType::Column };
+
+    for (EPACS_FormationType Formation : Formations)
+    {
+        TArray<FVector2D> Offsets;
+        UPACS_GroupMoveSubsystem::BuildFormationOffsets(Formation, 50, Spacing, Offsets);
+        TestEqual(TEXT("One slot per member"), Offsets.Num(), 50);
+
+        // No two slots closer than the spacing
+        float MinDist = TNumericLimits<float>::Max();
+        for (int32 i = 0; i < Offsets.Num(); ++i)
+        {
+            for (int32 j = i + 1; j < Offsets.Num(); ++j)
+            {
+                MinDist = FMath::Min(MinDist, FVector2D::Distance(Offsets[i], Offsets[j]));
+            }
+        }
+        TestTrue(FString::Printf(TEXT("Formation %d slots separated by spacing"), int32(Formation)), MinDist >= Spacing - KINDA_SMALL_NUMBER);
+
+        // Slot 0 is in the front rank
+        float MaxX = -TNumericLimits<float>::Max();
+        for (const FVector2D& Offset : Offsets) { MaxX = FMath::Max(MaxX, Offset.X); }
+        TestTrue(TEXT("Slot 0 in front rank"), FMath::IsNearlyEqual(Offsets[0].X, MaxX));
+    }
+
+    TArray<FVector2D> Empty;
+    UPACS_GroupMoveSubsystem::BuildFormationOffsets(EPACS_FormationType::Grid, 0, Spacing, Empty);
+    TestEqual(TEXT("Zero members -> zero slots"), Empty.Num(), 0);
+    return true;
+}
+
+// ------- Spec 2: 50 NPCs, navigation query count -------
+// Requires a map with a built navmesh around the origin (LV_TestMap has a NavMeshBoundsVolume).
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_GroupMoveQueryCountSpec,
+    "PACS.NPC.GroupMove.QueryCount50",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPACS_GroupMoveQueryCountSpec::RunTest(const FString& Parameters)
+{
+    UWorld* World = GWorld;
+    TestNotNull(TEXT("World available"), World);
+    if (!World) return false;
+
+    UPACS_GroupMoveSubsystem* GroupMove = World->GetSubsystem<UPACS_GroupMoveSubsystem>();
+    TestNotNull(TEXT("Group move subsystem"), GroupMove);
+    if (!GroupMove) return false;
+
+    UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+    FNavLocation Origin;
+    if (!NavSys || !NavSys->ProjectPointToNavigation(FVector::ZeroVector, Origin, FVector(5000.f, 5000.f, 5000.f)))
+    {
+        AddError(TEXT("No navmesh near the origin - run this spec on a map with a navmesh"));
+        return false;
+    }
+
+    FNavLocation Target;
+    if (!NavSys->GetRandomReachablePointInRadius(Origin.Location, 5000.f, Target))
+    {
+        AddError(TEXT("No reachable target on navmesh"));
+        return false;
+    }
+
+    const int32 N = 50;
+    TArray<AActor*> NPCs;
+    FActorSpawnParameters Params;
+    Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    for (int32 i = 0; i < N; ++i)
+    {
+        const FVector Loc = Origin.Location + FVector((i % 10) * 100.f, (i / 10) * 100.f, 100.f);
+        ACharacter* NPC = World->SpawnActor<ACharacter>(ACharacter::StaticClass(), Loc, FRotator::ZeroRotator, Params);
+        if (!NPC) continue;
+        NPC->AIControllerClass = AAIController::StaticClass();
+        NPC->SpawnDefaultController();
+        NPCs.Add(NPC);
+    }
+    TestEqual(TEXT("Spawned NPCs"), NPCs.Num(), N);
+
+    GroupMove->ResetStats();
+    const int32 Moved = GroupMove->IssueGroupMove(NPCs, Target.Location, EPACS_FormationType::Grid);
+    const FPACS_GroupMoveStats& Stats = GroupMove->GetStats();
+
+    AddInfo(FString::Printf(TEXT("PathQueries=%d Projections=%d Shared=%d Fallback=%d NavRaycasts=%d LegPaths=%d"),
+        Stats.PathQueries, Stats.Projections, Stats.SharedPathMoves, Stats.FallbackMoves, Stats.NavRaycasts, Stats.LegPathQueries));
+
+    TestEqual(TEXT("All NPCs received a move"), Moved, N);
+    TestEqual(TEXT("One corridor query for the group"), Stats.PathQueries, 1);
+    TestTrue(TEXT("Projections bounded by N + 2"), Stats.Projections <= N + 2);
+    TestEqual(TEXT("Every NPC used the shared corridor"), Stats.SharedPathMoves, N);
+    TestTrue(TEXT("At most two leg checks per NPC"), Stats.NavRaycasts <= 2 * N);
+
+    for (AActor* NPC : NPCs)
+    {
+        if (APawn* Pawn = Cast<APawn>(NPC))
+        {
+            if (AController* C = Pawn->GetController()) { C->Destroy(); }
+        }
+        NPC->Destroy();
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,96 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Core/PACS_MoveCommandQueue.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+
+// ------- Spec: 100 move RPCs in one frame -> bounded path requests -------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_MoveCommandQueueSpec,
+    "PACS.NPC.MoveCommands.CoalesceAndRateLimit",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPACS_MoveCommandQueueSpec::RunTest(const FString& Parameters)
+{
+    UWorld* World = GWorld;
+    TestNotNull(TEXT("World available"), World);
+    if (!World) return false;
+
+    // 10 NPCs; NPC set k = { NPC[k], NPC[(k+1)%10] }
+    TArray<AActor*> NPCs;
+    for (int32 i = 0; i < 10; ++i)
+    {
+        NPCs.Add(World->SpawnActor<AActor>(AActor::StaticClass(), FVector(i * 100.f, 0, 0), FRotator::ZeroRotator));
+    }
+
+    const int32 Burst = 5;
+    const int32 MaxPending = 8;
+    FPACS_MoveCommandQueue Queue;
+    Queue.Configure(10.f, Burst, MaxPending);
+
+    // Set key ignores selection order
+    TestEqual(TEXT("Set key is order independent"),
+        FPACS_MoveCommandQueue::MakeSetKey({ NPCs[0], NPCs[1] }),
+        FPACS_MoveCommandQueue::MakeSetKey({ NPCs[1], NPCs[0] }));
+
+    // Same frame: 100 RPCs cycling through 10 distinct sets
+    const double Now = 10.0;
+    for (int32 i = 0; i < 100; ++i)
+    {
+        const int32 k = i % 10;
+        Queue.Enqueue({ NPCs[k], NPCs[(k + 1) % 10] }, FVector(float(i), 0, 0), Now);
+    }
+    TestEqual(TEXT("Pending capped at MaxPending"), Queue.GetPendingCount(), MaxPending);
+
+    TArray<FPACS_PendingMoveCommand> Ready;
+    Queue.Flush(Now, Ready);
+    TestEqual(TEXT("Flush bounded by burst"), Ready.Num(), Burst);
+
+    int32 PathRequests = 0;
+    for (const FPACS_PendingMoveCommand& Command : Ready)
+    {
+        PathRequests += Command.NPCs.Num();
+    }
+    TestTrue(FString::Printf(TEXT("Path requests bounded (%d)"), PathRequests), PathRequests <= Burst * 2);
+
+    // Latest target wins for every coalesced set
+    for (const FPACS_PendingMoveCommand& Command : Ready)
+    {
+        TestEqual(TEXT("Coalesced to latest"), Command.CoalescedCount, 9);
+        TestTrue(TEXT("Latest target kept"), Command.TargetLocation.X >= 90.f);
+    }
+
+    int32 Coalesced = 0, Rejected = 0;
+    Queue.ConsumeDropStats(Coalesced, Rejected);
+    TestEqual(TEXT("Coalesced count"), Coalesced, 8 * 9);
+    TestEqual(TEXT("Rejected count"), Rejected, 2 * 10);
+
+    // Remaining sets drain once tokens refill
+    TestTrue(TEXT("Waiting for token"), Queue.GetTimeUntilNextToken(Now) > 0.f);
+    Ready.Reset();
+    Queue.Flush(Now + 1.0, Ready);
+    TestEqual(TEXT("Remaining sets flushed after refill"), Ready.Num(), MaxPending - Burst);
+    TestFalse(TEXT("Queue drained"), Queue.HasPending());
+
+    // Same set 100 times in one frame collapses to a single command
+    Queue.Reset();
+    for (int32 i = 0; i < 100; ++i)
+    {
+        Queue.Enqueue(NPCs, FVector(float(i), 0, 0), Now);
+    }
+    Ready.Reset();
+    Queue.Flush(Now, Ready);
+    TestEqual(TEXT("One command for one set"), Ready.Num(), 1);
+    if (Ready.Num() == 1)
+    {
+        TestEqual(TEXT("Final target"), Ready[0].TargetLocation.X, 99.0);
+    }
+
+    for (AActor* NPC : NPCs)
+    {
+        if (NPC) NPC->Destroy();
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,187 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Data/Settings/PACS_CustomSignificanceManager.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+namespace PACSNPCThrottleTest
+{
+    // What the NPC was authored with, read straight off the components
+    struct FRecorded
+    {
+        float ActorInterval = 0.f;
+        float MeshInterval = 0.f;
+        float MovementInterval = 0.f;
+        EVisibilityBasedAnimTickOption AnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPose;
+        bool bUpdateRateOptimizations = false;
+        ENetworkSmoothingMode SmoothingMode = ENetworkSmoothingMode::Exponential;
+    };
+
+    FRecorded Record(const ACharacter* NPC)
+    {
+        FRecorded Out;
+        Out.ActorInterval = NPC->GetActorTickInterval();
+        Out.MeshInterval = NPC->GetMesh()->GetComponentTickInterval();
+        Out.MovementInterval = NPC->GetCharacterMovement()->GetComponentTickInterval();
+        Out.AnimTickOption = NPC->GetMesh()->VisibilityBasedAnimTickOption;
+        Out.bUpdateRateOptimizations = NPC->GetMesh()->bEnableUpdateRateOptimizations;
+        Out.SmoothingMode = NPC->GetCharacterMovement()->NetworkSmoothingMode;
+        return Out;
+    }
+}
+
+// ------- Spec: tick intervals assigned to simulated NPCs across distance bands (runs under -NullRHI) -------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_NPCSignificanceThrottleSpec,
+    "PACS.NPC.Significance.TickBands",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPACS_NPCSignificanceThrottleSpec::RunTest(const FString& Parameters)
+{
+    using namespace PACSNPCThrottleTest;
+
+    UWorld* World = GWorld;
+    if (!TestNotNull(TEXT("World"), World))
+    {
+        return false;
+    }
+
+    FPACS_NPCThrottleParams Params = FPACS_NPCThrottleParams::FromSettings();
+    if (!Params.bEnabled)
+    {
+        AddInfo(TEXT("bThrottleNPCTicks is off in settings; checking that every band stays at full rate"));
+    }
+
+    UPACS_CustomSignificanceManager* Manager = NewObject<UPACS_CustomSignificanceManager>(World);
+    Manager->SetUpdateBudget(0, 0.f);
+
+    // One NPC in the middle of each band, nearest first
+    const TArray<float> Distances = {
+        Params.NearDistanceCm * 0.5f,
+        (Params.NearDistanceCm + Params.MidDistanceCm) * 0.5f,
+        (Params.MidDistanceCm + Params.FarDistanceCm) * 0.5f,
+        Params.FarDistanceCm * 2.0f };
+    const EPACS_NPCSignificanceBand ExpectedBands[] = {
+        EPACS_NPCSignificanceBand::Near, EPACS_NPCSignificanceBand::Mid,
+        EPACS_NPCSignificanceBand::Far, EPACS_NPCSignificanceBand::Distant };
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    TArray<ACharacter*> NPCs;
+    TArray<FRecorded> Originals;
+    for (float Distance : Distances)
+    {
+        ACharacter* NPC = World->SpawnActor<ACharacter>(ACharacter::StaticClass(), FVector(Distance, 0.f, 0.f), FRotator::ZeroRotator, SpawnParams);
+        if (!NPC)
+        {
+            continue;
+        }
+        // Throttling of actor tick and movement is reserved for simulated proxies
+        NPC->SetRole(ROLE_SimulatedProxy);
+        if (NPCs.Num() == 0)
+        {
+            // The near NPC is authored cheaper than the character defaults; Near must not undo that
+            NPC->GetMesh()->SetComponentTickInterval(0.02f);
+            NPC->GetMesh()->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+            NPC->GetMesh()->bEnableUpdateRateOptimizations = true;
+            NPC->GetCharacterMovement()->NetworkSmoothingMode = ENetworkSmoothingMode::Linear;
+        }
+        Originals.Add(Record(NPC));
+        Manager->RegisterNPC(NPC);
+        NPCs.Add(NPC);
+    }
+    if (!TestEqual(TEXT("Spawned NPCs"), NPCs.Num(), Distances.Num()))
+    {
+        return false;
+    }
+
+    const FTransform Viewpoint(FVector::ZeroVector);
+    Manager->Update(MakeArrayView(&Viewpoint, 1));
+
+    const float BandRates[] = { 0.f, Params.MidTickRate, Params.FarTickRate, Params.DistantTickRate };
+    float PreviousInterval = -1.f;
+    for (int32 i = 0; i < NPCs.Num(); ++i)
+    {
+        ACharacter* NPC = NPCs[i];
+        const FRecorded& Original = Originals[i];
+        const EPACS_NPCSignificanceBand Expected = Params.bEnabled ? ExpectedBands[i] : EPACS_NPCSignificanceBand::Near;
+        const USkeletalMeshComponent* Mesh = NPC->GetMesh();
+        const UCharacterMovementComponent* Movement = NPC->GetCharacterMovement();
+
+        AddInfo(FString::Printf(TEXT("%.0f cm: band %d, actor %.3fs, mesh %.3fs, movement %.3fs"),
+            Distances[i], int32(Manager->GetNPCBand(NPC)), NPC->GetActorTickInterval(),
+            Mesh->GetComponentTickInterval(), Movement->GetComponentTickInterval()));
+
+        TestEqual(FString::Printf(TEXT("Band at %.0f cm"), Distances[i]), int32(Manager->GetNPCBand(NPC)), int32(Expected));
+        if (Expected == EPACS_NPCSignificanceBand::Near)
+        {
+            // Near keeps exactly what the NPC was authored with
+            TestNearlyEqual(TEXT("Near keeps the actor interval"), NPC->GetActorTickInterval(), Original.ActorInterval);
+            TestNearlyEqual(TEXT("Near keeps the mesh interval"), Mesh->GetComponentTickInterval(), Original.MeshInterval);
+            TestNearlyEqual(TEXT("Near keeps the movement interval"), Movement->GetComponentTickInterval(), Original.MovementInterval);
+            TestEqual(TEXT("Near keeps the anim tick option"), int32(Mesh->VisibilityBasedAnimTickOption), int32(Original.AnimTickOption));
+            TestEqual(TEXT("Near keeps URO"), bool(Mesh->bEnableUpdateRateOptimizations), Original.bUpdateRateOptimizations);
+            TestEqual(TEXT("Near keeps smoothing"), int32(Movement->NetworkSmoothingMode), int32(Original.SmoothingMode));
+        }
+        else
+        {
+            // Throttled to the band rate, never below what the NPC was authored with
+            const float BandInterval = FMath::Max(1.f / FMath::Max(BandRates[i], 0.1f), Original.ActorInterval);
+            TestNearlyEqual(TEXT("Actor tick interval"), NPC->GetActorTickInterval(), BandInterval);
+            TestNearlyEqual(TEXT("Mesh tick interval"), Mesh->GetComponentTickInterval(), FMath::Max(BandInterval, Original.MeshInterval));
+            TestNearlyEqual(TEXT("Movement tick interval"), Movement->GetComponentTickInterval(), FMath::Max(BandInterval, Original.MovementInterval));
+            TestTrue(TEXT("Throttled bands use URO"), bool(Mesh->bEnableUpdateRateOptimizations));
+            TestTrue(TEXT("Anim ticks no more than authored"),
+                Mesh->VisibilityBasedAnimTickOption != EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones
+                || Original.AnimTickOption == EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones);
+        }
+
+        TestTrue(TEXT("Intervals never shrink with distance"), NPC->GetActorTickInterval() >= PreviousInterval);
+        PreviousInterval = NPC->GetActorTickInterval();
+    }
+
+    if (Params.bEnabled)
+    {
+        TestTrue(TEXT("Distant band is throttled"), NPCs.Last()->GetActorTickInterval() > 0.f);
+    }
+
+    // Walking the distant NPC into the near band restores its own settings on the next update
+    ACharacter* Walker = NPCs.Last();
+    const FRecorded& WalkerOriginal = Originals.Last();
+    Walker->SetActorLocation(FVector(Params.NearDistanceCm * 0.25f, 100.f, 0.f));
+    Manager->Update(MakeArrayView(&Viewpoint, 1));
+    TestEqual(TEXT("Band follows the NPC"), int32(Manager->GetNPCBand(Walker)), int32(EPACS_NPCSignificanceBand::Near));
+    TestNearlyEqual(TEXT("Actor interval restored"), Walker->GetActorTickInterval(), WalkerOriginal.ActorInterval);
+    TestNearlyEqual(TEXT("Mesh interval restored"), Walker->GetMesh()->GetComponentTickInterval(), WalkerOriginal.MeshInterval);
+    TestEqual(TEXT("Anim tick option restored"), int32(Walker->GetMesh()->VisibilityBasedAnimTickOption), int32(WalkerOriginal.AnimTickOption));
+    TestEqual(TEXT("URO restored"), bool(Walker->GetMesh()->bEnableUpdateRateOptimizations), WalkerOriginal.bUpdateRateOptimizations);
+    TestEqual(TEXT("Smoothing restored"), int32(Walker->GetCharacterMovement()->NetworkSmoothingMode), int32(WalkerOriginal.SmoothingMode));
+
+    // Selected/hovered NPCs use the Full band, which is the NPC's own settings too
+    const FPACS_NPCTickSettings Captured = FPACS_NPCTickSettings::Capture(NPCs[0]);
+    const FPACS_NPCTickSettings Full = UPACS_CustomSignificanceManager::GetNPCTickSettings(EPACS_NPCSignificanceBand::Full, Params, Captured);
+    TestNearlyEqual(TEXT("Full band keeps the authored mesh interval"), Full.MeshTickInterval, Originals[0].MeshInterval);
+    TestEqual(TEXT("Full band keeps the authored anim tick option"), int32(Full.AnimTickOption), int32(Originals[0].AnimTickOption));
+    TestEqual(TEXT("Full band keeps the authored smoothing"), int32(Full.SmoothingMode), int32(Originals[0].SmoothingMode));
+
+    // Unregistering hands every NPC back as it was authored
+    for (int32 i = 0; i < NPCs.Num(); ++i)
+    {
+        Manager->UnregisterNPC(NPCs[i]);
+        const FRecorded After = Record(NPCs[i]);
+        TestNearlyEqual(TEXT("Unregister restores the actor interval"), After.ActorInterval, Originals[i].ActorInterval);
+        TestNearlyEqual(TEXT("Unregister restores the mesh interval"), After.MeshInterval, Originals[i].MeshInterval);
+        TestNearlyEqual(TEXT("Unregister restores the movement interval"), After.MovementInterval, Originals[i].MovementInterval);
+        TestEqual(TEXT("Unregister restores the anim tick option"), int32(After.AnimTickOption), int32(Originals[i].AnimTickOption));
+        TestEqual(TEXT("Unregister restores URO"), After.bUpdateRateOptimizations, Originals[i].bUpdateRateOptimizations);
+        TestEqual(TEXT("Unregister restores smoothing"), int32(After.SmoothingMode), int32(Originals[i].SmoothingMode));
+        NPCs[i]->Destroy();
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
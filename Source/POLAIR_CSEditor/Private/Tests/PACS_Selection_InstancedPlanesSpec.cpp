@@ -0,0 +1,120 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Subsystems/PACS_SelectionPlaneManager.h"
+#include "Components/PACS_SelectionPlaneComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Materials/MaterialInterface.h"
+
+// ------- Spec: instance bookkeeping for instanced selection planes (runs under -NullRHI) -------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_InstancedPlanesSpec,
+    "PACS.Selection.Planes.InstancedBookkeeping",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPACS_InstancedPlanesSpec::RunTest(const FString& Parameters)
+{
+    UStaticMesh* PlaneMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Plane.Plane"));
+    UMaterialInterface* MaterialA = LoadObject<UMaterialInterface>(nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial"));
+    UMaterialInterface* MaterialB = LoadObject<UMaterialInterface>(nullptr, TEXT("/Engine/EngineMaterials/DefaultMaterial.DefaultMaterial"));
+    TestNotNull(TEXT("Plane mesh"), PlaneMesh);
+    TestNotNull(TEXT("Material A"), MaterialA);
+    TestNotNull(TEXT("Material B"), MaterialB);
+    if (!PlaneMesh || !MaterialA || !MaterialB) return false;
+
+    // Private game world so the manager and its host actor do not leak into the editor level
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("PACS_InstancedPlanesTest"));
+    FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+    WorldContext.SetCurrentWorld(World);
+
+    UPACS_SelectionPlaneManager* Manager = World->GetSubsystem<UPACS_SelectionPlaneManager>();
+    TestNotNull(TEXT("Plane manager created for non-dedicated world"), Manager);
+    if (!Manager)
+    {
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+        return false;
+    }
+
+    // 200 NPCs on material A, 100 on material B
+    const int32 NumA = 200;
+    const int32 NumB = 100;
+    const FTransform PlaneOffset(FRotator::ZeroRotator, FVector(0, 0, 2.f));
+
+    TArray<AActor*> Actors;
+    TArray<UPACS_SelectionPlaneComponent*> Planes;
+    for (int32 i = 0; i < NumA + NumB; ++i)
+    {
+        AStaticMeshActor* Actor = World->SpawnActor<AStaticMeshActor>(FVector(i * 200.f, 0, 0), FRotator::ZeroRotator);
+        Actor->SetMobility(EComponentMobility::Movable);
+        UPACS_SelectionPlaneComponent* Plane = NewObject<UPACS_SelectionPlaneComponent>(Actor);
+        Plane->RegisterComponent();
+
+        Manager->AddOrUpdatePlane(Plane, PlaneMesh, i < NumA ? MaterialA : MaterialB, PlaneOffset);
+        Actors.Add(Actor);
+        Planes.Add(Plane);
+    }
+
+    const int32 BatchA = Manager->FindBatchIndex(PlaneMesh, MaterialA);
+    const int32 BatchB = Manager->FindBatchIndex(PlaneMesh, MaterialB);
+    TestEqual(TEXT("One component per material"), Manager->GetComponentCount(), 2);
+    TestEqual(TEXT("Total instances"), Manager->GetInstanceCount(), NumA + NumB);
+    TestEqual(TEXT("Batch A instances"), Manager->GetBatchComponent(BatchA)->GetInstanceCount(), NumA);
+    TestEqual(TEXT("Batch B instances"), Manager->GetBatchComponent(BatchB)->GetInstanceCount(), NumB);
+    TestNull(TEXT("No per-NPC mesh component"), Planes[0]->GetSelectionPlane());
+
+    // Custom data on the last instance of A survives the swap-remove of an earlier one
+    UPACS_SelectionPlaneComponent* LastA = Planes[NumA - 1];
+    Manager->SetPlaneCustomData(LastA, FLinearColor(0.25f, 0.5f, 0.75f, 1.f), 3.f, 2);
+    Manager->RemovePlane(Planes[10]);
+
+    UInstancedStaticMeshComponent* ISMA = Manager->GetBatchComponent(BatchA);
+    const int32 N = UPACS_SelectionPlaneManager::NumCustomDataFloats;
+    TestEqual(TEXT("Removed from batch A"), ISMA->GetInstanceCount(), NumA - 1);
+    TestEqual(TEXT("Last instance moved into freed slot"), Manager->GetInstanceIndex(LastA), 10);
+    TestTrue(TEXT("Slot owner updated"), Manager->GetInstanceOwner(BatchA, 10) == LastA);
+    TestEqual(TEXT("Moved brightness"), ISMA->PerInstanceSMCustomData[10 * N + 3], 3.f);
+    TestEqual(TEXT("Moved state"), ISMA->PerInstanceSMCustomData[10 * N + 5], 2.f);
+    TestFalse(TEXT("Removed plane untracked"), Manager->HasPlane(Planes[10]));
+
+    // Every tracked plane maps to an instance that maps back to it
+    int32 Consistent = 0;
+    for (UPACS_SelectionPlaneComponent* Plane : Planes)
+    {
+        if (!Manager->HasPlane(Plane)) continue;
+        const int32 Index = Manager->GetInstanceIndex(Plane);
+        if (Manager->GetInstanceOwner(BatchA, Index) == Plane || Manager->GetInstanceOwner(BatchB, Index) == Plane)
+        {
+            ++Consistent;
+        }
+    }
+    TestEqual(TEXT("Bookkeeping consistent"), Consistent, NumA + NumB - 1);
+
+    // Only NPCs that moved get a transform update
+    TestEqual(TEXT("Nothing moved"), Manager->UpdateMovedInstances(), 0);
+    for (int32 i = 0; i < 7; ++i)
+    {
+        Actors[NumA + i]->SetActorLocation(FVector(i * 200.f, 5000.f, 0));
+    }
+    TestEqual(TEXT("Moved NPCs updated"), Manager->UpdateMovedInstances(), 7);
+    TestEqual(TEXT("No repeat updates"), Manager->UpdateMovedInstances(), 0);
+
+    FTransform InstanceTransform;
+    Manager->GetBatchComponent(BatchB)->GetInstanceTransform(Manager->GetInstanceIndex(Planes[NumA]), InstanceTransform, true);
+    TestTrue(TEXT("Instance follows NPC"), InstanceTransform.GetLocation().Equals(FVector(0, 5000.f, 2.f), 0.1f));
+
+    // Changing material moves the instance between batches without adding components
+    Manager->AddOrUpdatePlane(Planes[0], PlaneMesh, MaterialB, PlaneOffset);
+    TestEqual(TEXT("Still two components"), Manager->GetComponentCount(), 2);
+    TestEqual(TEXT("Batch A shrank"), Manager->GetBatchInstanceCount(BatchA), NumA - 2);
+    TestEqual(TEXT("Batch B grew"), Manager->GetBatchInstanceCount(BatchB), NumB + 1);
+
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,144 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Subsystems/PACS_SelectionPlaneBudgeter.h"
+#include "Subsystems/PACS_SelectionPlaneManager.h"
+#include "Subsystems/PACS_SelectableRegistrySubsystem.h"
+#include "Components/PACS_SelectionPlaneComponent.h"
+#include "Settings/PACS_NetPerfSettings.h"
+#include "Data/Settings/PACS_CustomSignificanceManager.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Materials/MaterialInterface.h"
+
+// ------- Spec: 400 planes -> visible count and update cadence follow NetPerf settings -------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_PlaneBudgetSpec,
+    "PACS.Selection.Planes.Budget400",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPACS_PlaneBudgetSpec::RunTest(const FString& Parameters)
+{
+    const FPACS_PlaneBudgetParams Params = FPACS_PlaneBudgetParams::FromSettings();
+
+    // Pure ranking: nearest MaxVisible plus every selected plane
+    {
+        TArray<FPACS_PlaneBudgetInput> Inputs;
+        for (int32 i = 0; i < 400; ++i)
+        {
+            const float Distance = i * 50.f;
+            Inputs.Add({ 1.f / (1.f + Distance * 0.001f), Distance, i == 399 });
+        }
+        TArray<FPACS_PlaneBudgetResult> Results;
+        UPACS_SelectionPlaneBudgeter::ComputeBudget(Inputs, Params, Results);
+
+        int32 Visible = 0;
+        for (const FPACS_PlaneBudgetResult& Result : Results) Visible += Result.bVisible ? 1 : 0;
+        TestEqual(TEXT("Ranking keeps MaxVisible plus selected"), Visible, Params.MaxVisible + 1);
+        TestTrue(TEXT("Nearest visible"), Results[0].bVisible);
+        TestFalse(TEXT("First plane past the budget hidden"), Results[Params.MaxVisible].bVisible);
+        TestTrue(TEXT("Selected far plane visible"), Results[399].bVisible);
+    }
+
+    UStaticMesh* PlaneMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Plane.Plane"));
+    UMaterialInterface* Material = LoadObject<UMaterialInterface>(nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial"));
+    TestNotNull(TEXT("Plane mesh"), PlaneMesh);
+    if (!PlaneMesh) return false;
+
+    // Instanced planes are opt-in; enable them with a stand-in material for the duration of the test
+    UPACS_NetPerfSettings* MutableSettings = GetMutableDefault<UPACS_NetPerfSettings>();
+    TGuardValue<bool> InstancedGuard(MutableSettings->bUseInstancedSelectionPlanes, true);
+    TGuardValue<TSoftObjectPtr<UMaterialInterface>> MaterialGuard(MutableSettings->InstancedSelectionPlaneMaterial, TSoftObjectPtr<UMaterialInterface>(Material));
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("PACS_PlaneBudgetTest"));
+    FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+    WorldContext.SetCurrentWorld(World);
+
+    UPACS_SelectableRegistrySubsystem* Registry = World->GetSubsystem<UPACS_SelectableRegistrySubsystem>();
+    UPACS_SelectionPlaneManager* Manager = World->GetSubsystem<UPACS_SelectionPlaneManager>();
+    UPACS_SelectionPlaneBudgeter* Budgeter = World->GetSubsystem<UPACS_SelectionPlaneBudgeter>();
+
+    // 400 NPCs in a line, 50cm apart, camera at the origin
+    TArray<AActor*> Actors;
+    TArray<UPACS_SelectionPlaneComponent*> Planes;
+    for (int32 i = 0; Registry && Manager && Budgeter && i < 400; ++i)
+    {
+        AStaticMeshActor* Actor = World->SpawnActor<AStaticMeshActor>(FVector(i * 50.f, 0, 0), FRotator::ZeroRotator);
+        Actor->SetMobility(EComponentMobility::Movable);
+
+        UPACS_SelectionPlaneComponent* Plane = NewObject<UPACS_SelectionPlaneComponent>(Actor);
+        Plane->RegisterComponent();
+        Plane->InitializeSelectionPlane();
+        Plane->ApplyPlaneAssets(PlaneMesh, Material, FTransform::Identity);
+        Registry->Register(Plane);
+
+        Actors.Add(Actor);
+        Planes.Add(Plane);
+    }
+
+    if (Planes.Num() == 0 || !Planes[0]->IsInstancedPlane())
+    {
+        AddWarning(TEXT("Selection plane subsystems missing - skipping world checks"));
+    }
+    else
+    {
+        // Three selected NPCs far away (one beyond SelectionPlaneMaxDistance)
+        const int32 SelectedIdx[] = { 300, 350, 399 };
+        for (int32 Idx : SelectedIdx)
+        {
+            Planes[Idx]->SetSelectionState(ESelectionVisualState::Selected);
+        }
+
+        // The first pass registers the planes for significance; the per-frame update then scores them
+        const FTransform View(FRotator::ZeroRotator, FVector::ZeroVector);
+        Budgeter->RunBudget(MakeArrayView(&View, 1));
+        if (UPACS_CustomSignificanceManager* Significance = UPACS_CustomSignificanceManager::Get(World))
+        {
+            Significance->Update(MakeArrayView(&View, 1));
+            Budgeter->RunBudget(MakeArrayView(&View, 1));
+        }
+
+        int32 Visible = 0;
+        for (UPACS_SelectionPlaneComponent* Plane : Planes)
+        {
+            Visible += Manager->IsPlaneVisible(Plane) ? 1 : 0;
+        }
+        TestEqual(TEXT("Visible planes = MaxVisible + selected"), Visible, Params.MaxVisible + 3);
+        TestEqual(TEXT("Budgeter visible count"), Budgeter->GetVisibleCount(), Visible);
+        for (int32 Idx : SelectedIdx)
+        {
+            TestTrue(FString::Printf(TEXT("Selected plane %d visible"), Idx), Manager->IsPlaneVisible(Planes[Idx]));
+        }
+
+        // One second at 120Hz with every NPC moving
+        TArray<int32> Before;
+        for (UPACS_SelectionPlaneComponent* Plane : Planes) Before.Add(Manager->GetPlaneUpdateCount(Plane));
+
+        const int32 TickRate = 120;
+        for (int32 Tick = 0; Tick < TickRate; ++Tick)
+        {
+            for (AActor* Actor : Actors)
+            {
+                Actor->AddActorWorldOffset(FVector(0, 1.f, 0));
+            }
+            Manager->UpdateMovedInstances(10.0 + double(Tick) / TickRate);
+        }
+
+        auto UpdatesFor = [&](int32 Idx) { return Manager->GetPlaneUpdateCount(Planes[Idx]) - Before[Idx]; };
+        const float NearRate = Params.bThrottleUpdates ? FMath::Min(Params.NearUpdateRate, float(TickRate)) : float(TickRate);
+        const float FarRate = Params.bThrottleUpdates ? FMath::Min(Params.FarUpdateRate, float(TickRate)) : float(TickRate);
+
+        TestTrue(FString::Printf(TEXT("Near plane ~%.0f updates (%d)"), NearRate, UpdatesFor(0)),
+            FMath::Abs(UpdatesFor(0) - NearRate) <= NearRate * 0.1f + 2.f);
+        TestTrue(FString::Printf(TEXT("Far selected plane ~%.0f updates (%d)"), FarRate, UpdatesFor(399)),
+            FMath::Abs(UpdatesFor(399) - FarRate) <= FarRate * 0.1f + 2.f);
+        TestEqual(TEXT("Hidden plane never updates"), UpdatesFor(Params.MaxVisible + 10), 0);
+    }
+
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
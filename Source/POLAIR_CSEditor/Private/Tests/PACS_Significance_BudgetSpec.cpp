@@ -0,0 +1,147 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Data/Settings/PACS_CustomSignificanceManager.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include <atomic>
+
+namespace PACSSignificanceTest
+{
+    static const FName Tag(TEXT("PACS.Test.Budget"));
+
+    float Expected(const USceneComponent* Component, const FVector& ViewLocation)
+    {
+        return 1.f / (1.f + FVector::Dist(Component->GetComponentLocation(), ViewLocation) * 0.001f);
+    }
+}
+
+// ------- Spec: budgeted slices, bucket-change re-scoring and eventual consistency -------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_SignificanceBudgetSpec,
+    "PACS.Significance.Budget.RoundRobin",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPACS_SignificanceBudgetSpec::RunTest(const FString& Parameters)
+{
+    using namespace PACSSignificanceTest;
+
+    UWorld* World = GWorld;
+    if (!TestNotNull(TEXT("World"), World))
+    {
+        return false;
+    }
+
+    constexpr int32 NumObjects = 2000;
+    constexpr int32 Budget = 100;
+
+    UPACS_CustomSignificanceManager* Manager = NewObject<UPACS_CustomSignificanceManager>(World);
+    Manager->SetUpdateBudget(Budget, 0.f);
+
+    // Objects along X every 10 cm: 0 .. 20000 cm, spanning every distance bucket
+    std::atomic<int32> ScoreCalls{ 0 };
+    TArray<USceneComponent*> Objects;
+    for (int32 i = 0; i < NumObjects; ++i)
+    {
+        USceneComponent* Component = NewObject<USceneComponent>(GetTransientPackage());
+        Component->SetWorldLocation(FVector(i * 10.f, 0.f, 0.f));
+        Objects.Add(Component);
+
+        Manager->RegisterObject(Component, Tag,
+            [&ScoreCalls](USignificanceManager::FManagedObjectInfo* Info, const FTransform& Viewpoint)
+            {
+                ++ScoreCalls;
+                return PACSSignificanceTest::Expected(Cast<USceneComponent>(Info->GetObject()), Viewpoint.GetLocation());
+            });
+    }
+    TestEqual(TEXT("All objects budgeted"), Manager->GetNumBudgetedObjects(), NumObjects);
+
+    auto RunFrame = [&](const FVector& ViewLocation)
+    {
+        ScoreCalls = 0;
+        const FTransform Viewpoint(ViewLocation);
+        Manager->Update(MakeArrayView(&Viewpoint, 1));
+    };
+
+    auto CountStale = [&](const FVector& ViewLocation)
+    {
+        int32 Stale = 0;
+        for (USceneComponent* Component : Objects)
+        {
+            const USignificanceManager::FManagedObjectInfo* Info = Manager->GetManagedObject(Component);
+            if (!Info || !FMath::IsNearlyEqual(Info->GetSignificance(), Expected(Component, ViewLocation), 1e-5f))
+            {
+                ++Stale;
+            }
+        }
+        return Stale;
+    };
+
+    // First update scores every new registration once
+    FVector View(0.f, 0.f, 0.f);
+    RunFrame(View);
+    TestEqual(TEXT("New registrations scored on first update"), Manager->GetLastScoredCount(), NumObjects);
+    TestEqual(TEXT("Consistent after first update"), CountStale(View), 0);
+
+    // Static view: exactly one slice per frame, nothing else
+    RunFrame(View);
+    TestEqual(TEXT("Static view scores one slice"), Manager->GetLastScoredCount(), Budget);
+    TestEqual(TEXT("Static view calls the function once per sliced object"), ScoreCalls.load(), Budget);
+    TestEqual(TEXT("No bucket changes with a static view"), Manager->GetLastBucketRescoreCount(), 0);
+
+    // Small move inside buckets for most objects: stale until their slice comes round
+    View = FVector(0.f, 600.f, 0.f);
+    int32 MaxSliceScored = 0;
+    int32 TotalBucketRescores = 0;
+    const int32 FramesForFullPass = NumObjects / Budget;
+    for (int32 Frame = 0; Frame < FramesForFullPass; ++Frame)
+    {
+        RunFrame(View);
+        TestEqual(TEXT("Function calls match scored objects"), ScoreCalls.load(), Manager->GetLastScoredCount());
+        MaxSliceScored = FMath::Max(MaxSliceScored, Manager->GetLastScoredCount() - Manager->GetLastBucketRescoreCount());
+        TotalBucketRescores += Manager->GetLastBucketRescoreCount();
+    }
+    AddInfo(FString::Printf(TEXT("%d objects, budget %d: max %d sliced per frame, %d bucket re-scores over %d frames"),
+        NumObjects, Budget, MaxSliceScored, TotalBucketRescores, FramesForFullPass));
+    TestTrue(TEXT("Slice never exceeds the budget"), MaxSliceScored <= Budget);
+    TestEqual(TEXT("Eventually consistent after one full round robin"), CountStale(View), 0);
+
+    // An object jumping to another bucket is re-scored on the very next update
+    USceneComponent* Jumper = Objects[NumObjects / 2];
+    const int32 BucketBefore = Manager->GetDistanceBucket(FVector::Dist(Jumper->GetComponentLocation(), View));
+    Jumper->SetWorldLocation(FVector(-50000.f, 0.f, 0.f));
+    TestNotEqual(TEXT("Jumper changed bucket"), Manager->GetDistanceBucket(FVector::Dist(Jumper->GetComponentLocation(), View)), BucketBefore);
+    RunFrame(View);
+    TestEqual(TEXT("Bucket change re-scored immediately"), Manager->GetLastBucketRescoreCount(), 1);
+    TestNearlyEqual(TEXT("Jumper significance is current"),
+        Manager->GetManagedObject(Jumper)->GetSignificance(), Expected(Jumper, View), 1e-5f);
+
+    // Unregistering keeps the round robin intact
+    Manager->UnregisterObject(Objects[0]);
+    TestEqual(TEXT("Slot released"), Manager->GetNumBudgetedObjects(), NumObjects - 1);
+    RunFrame(View);
+    TestEqual(TEXT("Slice still on budget after unregister"), Manager->GetLastScoredCount(), Budget);
+
+    // Unregistering through the base class leaves a slot until the next update drops it
+    USignificanceManager* BaseManager = Manager;
+    BaseManager->UnregisterObject(Objects[1]);
+    RunFrame(View);
+    TestEqual(TEXT("Stale slot dropped on update"), Manager->GetNumBudgetedObjects(), NumObjects - 2);
+
+    // ... after which it can be registered again
+    Manager->RegisterObject(Objects[1], Tag,
+        [](USignificanceManager::FManagedObjectInfo* Info, const FTransform& Viewpoint)
+        {
+            return PACSSignificanceTest::Expected(Cast<USceneComponent>(Info->GetObject()), Viewpoint.GetLocation());
+        });
+    TestNotNull(TEXT("Re-registered after a base unregister"), Manager->GetManagedObject(Objects[1]));
+    TestEqual(TEXT("Re-registered slot budgeted"), Manager->GetNumBudgetedObjects(), NumObjects - 1);
+
+    for (int32 i = 1; i < Objects.Num(); ++i)
+    {
+        Manager->UnregisterObject(Objects[i]);
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
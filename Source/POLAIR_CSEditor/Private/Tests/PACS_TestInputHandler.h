@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/PACS_InputHandlerComponent.h"
+#include "PACS_TestInputHandler.generated.h"
+
+// Input handler whose local player and Enhanced Input subsystem are stood in for by the test
+UCLASS()
+class UPACS_TestInputHandler : public UPACS_InputHandlerComponent
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    bool bLocalPlayerReady = false;
+
+    // Subsystem calls the handler would have made
+    UPROPERTY()
+    int32 ContextAdds = 0;
+
+    UPROPERTY()
+    int32 ContextRemoves = 0;
+
+protected:
+    virtual bool IsLocalPlayerReady() const override
+    {
+        return bLocalPlayerReady;
+    }
+
+    virtual bool ApplyContextDiff(const FPACS_InputContextDiff& Diff) override
+    {
+        ContextAdds += Diff.Adds.Num();
+        ContextRemoves += Diff.Removes.Num();
+        return true;
+    }
+};
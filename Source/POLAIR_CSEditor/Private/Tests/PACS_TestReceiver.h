@@ -23,12 +23,34 @@ public:
     UPROPERTY()
     FInputActionValue LastValue;
 
+    // Declared at registration; empty = every action
+    UPROPERTY()
+    TArray<FName> Subscriptions;
+
+    UPROPERTY()
+    int32 CallCount = 0;
+
+    UPROPERTY()
+    int32 LastActionId = 0;
+
+    virtual EPACS_InputHandleResult HandleInputActionId(uint16 ActionId, FName ActionName, const FInputActionValue& Value) override
+    {
+        LastActionId = ActionId;
+        return HandleInputAction(ActionName, Value);
+    }
+
     virtual EPACS_InputHandleResult HandleInputAction(FName ActionName, const FInputActionValue& Value) override
     {
         LastAction = ActionName;
         LastValue = Value;
+        ++CallCount;
         return Response;
     }
+
+    virtual void GetSubscribedActions(TArray<FName>& OutActions) const override
+    {
+        OutActions.Append(Subscriptions);
+    }
     
     virtual int32 GetInputPriority() const override 
     { 
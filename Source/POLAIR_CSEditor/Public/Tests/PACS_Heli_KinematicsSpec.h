@@ -2,4 +2,10 @@
 #include "Misc/AutomationTest.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_Heli_KinematicsSpec, "PACS.Heli.Kinematics.SpeedInvariance",
+EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_Heli_CurveLUTSpec, "PACS.Heli.Kinematics.CurveLUT",
+EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_Heli_BankSpec, "PACS.Heli.Kinematics.BankVisual",
 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
\ No newline at end of file
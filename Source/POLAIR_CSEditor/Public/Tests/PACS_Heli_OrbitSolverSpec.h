@@ -0,0 +1,5 @@
+#pragma once
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPACS_Heli_OrbitSolverSpec, "PACS.Heli.Kinematics.OrbitSolverDeterminism",
+EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
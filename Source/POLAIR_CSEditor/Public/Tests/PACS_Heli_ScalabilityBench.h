@@ -0,0 +1,6 @@
+#pragma once
+#include "Misc/AutomationTest.h"
+
+// Parameterized per helicopter count (50/100/250/500). Intended for -NullRHI runs; see Scripts/RunHeliScalabilityBenchmark.bat.
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FPACS_Heli_ScalabilityBench, "PACS.Heli.Perf.Scalability",
+EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter);